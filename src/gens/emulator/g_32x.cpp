@@ -24,6 +24,7 @@
 #include "gens_core/cpu/z80/cpu_z80.h"
 #include "mdZ80/mdZ80.h"
 #include "gens_core/cpu/sh2/cpu_sh2.h"
+#include "gens_core/cpu/sh2/sh2_idle.h"
 #include "gens_core/vdp/vdp_io.h"
 #include "gens_core/io/io.h"
 #include "util/file/save.hpp"
@@ -36,6 +37,10 @@
 
 #include "util/sound/wave.h"
 #include "util/sound/gym.hpp"
+#ifdef GENS_ZLIB
+#include "util/video/avi.hpp"
+#endif
+#include "util/gfx/imageutil.hpp"
 
 #include "libgsft/gsft_byteswap.h"
 #include "macros/force_inline.h"
@@ -54,10 +59,21 @@
 #include "fw/bios32xs.bin.h"
 
 
-#define SH2_EXEC(cycM, cycS)		\
-do {					\
-	SH2_Exec(&M_SH2, cycM);		\
-	SH2_Exec(&S_SH2, cycS);		\
+// Idle loop skipping for the current game.
+static bool _32X_Idle_Skip = false;
+
+#define SH2_EXEC(cycM, cycS)			\
+do {						\
+	if (_32X_Idle_Skip)			\
+	{					\
+		SH2_Exec_Idle(&M_SH2, cycM);	\
+		SH2_Exec_Idle(&S_SH2, cycS);	\
+	}					\
+	else					\
+	{					\
+		SH2_Exec(&M_SH2, cycM);		\
+		SH2_Exec(&S_SH2, cycS);		\
+	}					\
 } while (0)
 
 
@@ -143,6 +159,10 @@ int Init_32X(ROM_t* MD_ROM)
 #endif
 	Init_Genesis_SRAM(MD_ROM);
 	
+	// Check if idle loop skipping is allowed for this game.
+	_32X_Idle_Skip = Idle_Loop_Skip_Allowed(MD_ROM);
+	Z80_Idle_Skip = _32X_Idle_Skip;
+	
 	// Check what country code should be used.
 	// TODO: Get rid of magic numbers.
 	switch (Country)
@@ -346,7 +366,7 @@ static FORCE_INLINE void T_gens_do_32X_line(void)
 	
 	// TODO: Precalculate these values somewhere else.
 	int CPL_PWM = CPL_M68K * 3;
-	p_i = 84;
+	p_i = LINE_32X_STEP_M68K;
 	p_j = (p_i * CPL_MSH2) / CPL_M68K;
 	p_k = (p_i * CPL_SSH2) / CPL_M68K;
 	p_l = p_i * 3;
@@ -463,7 +483,7 @@ static FORCE_INLINE void T_gens_do_32X_line(void)
 			
 			_32X_Set_FB();
 			
-			while (i < (Cycles_M68K - 360))
+			while (i < (Cycles_M68K - LINE_M68K_VINT))
 			{
 				main68k_exec(i);
 				SH2_EXEC(j, k);
@@ -474,8 +494,8 @@ static FORCE_INLINE void T_gens_do_32X_line(void)
 				l += p_l;
 			}
 			
-			main68k_exec(Cycles_M68K - 360);
-			Z80_EXEC(168);
+			main68k_exec(Cycles_M68K - LINE_M68K_VINT);
+			Z80_EXEC(LINE_Z80_VINT);
 			
 			VDP_Status &= ~0x0004;		// HBlank = 0
 			_32X_VDP.State &= ~0x4000;
@@ -673,6 +693,16 @@ static FORCE_INLINE int T_gens_do_32X_frame(void)
 	
 	EventMgr::RaiseEvent(MDP_EVENT_POST_FRAME, &post_frame);
 	
+#ifdef GENS_ZLIB
+	// If an AVI is being dumped, queue the frame.
+	if (AVI_Dumping)
+		avi_dump_update(&post_frame);
+#endif
+	
+	// Burst screenshots.
+	if (VDP && ImageUtil::BurstFrames > 0)
+		ImageUtil::UpdateBurst();
+	
 	return 1;
 }
 
@@ -29,6 +29,7 @@
 
 // libgsft includes.
 #include "libgsft/gsft_szprintf.h"
+#include "libgsft/gsft_file.h"
 
 // C includes.
 #include <stdint.h>
@@ -55,6 +56,7 @@ using std::string;
 #include "util/file/config_file.hpp"
 #include "gens_core/vdp/vdp_io.h"
 #include "util/sound/gym.hpp"
+#include "util/gfx/imageutil.hpp"
 #include "gens_core/mem/mem_m68k.h"
 #include "gens_core/sound/ym2612.hpp"
 #include "parse.hpp"
@@ -125,6 +127,9 @@ int Country = -1;
 int Country_Order[3];
 int Intro_Style = 2;
 int SegaCD_Accurate = 0;
+int SegaCD_Adaptive_Sync = 1;
+int Idle_Loop_Skip = 1;
+char Idle_Loop_Skip_Disable[1024] = "";
 int Quick_Exit = 0;
 #if 0// TODO: Replace with MDP "exclusive mode" later.
 int Net_Play = 0;
@@ -297,6 +302,9 @@ void End_All(void)
 	End_CD_Driver();
 #endif
 	
+	// Finish writing any queued screenshots.
+	ImageUtil::End();
+	
 	// Shut down the Plugin Manager.
 	PluginMgr::end();
 	
@@ -409,6 +417,32 @@ void check_startup_mode(Gens_StartupInfo_t *startup)
 			break;
 #endif
 		
+		case GSM_GYM_TO_WAV:
+		{
+			// Render a GYM file to WAV, then exit.
+			string wav_filename = startup->filename;
+			size_t dot_pos = wav_filename.rfind('.');
+			size_t sep_pos = wav_filename.rfind(GSFT_DIR_SEP_CHR);
+			if (dot_pos != string::npos && (sep_pos == string::npos || dot_pos > sep_pos))
+				wav_filename.erase(dot_pos);
+			wav_filename += ".wav";
+			
+			int ret = gym_render_wav(startup->filename, wav_filename.c_str());
+			if (ret != 0)
+			{
+				LOG_MSG(gens, LOG_MSG_LEVEL_ERROR,
+					"Failed to render GYM '%s' to WAV. (Error %d)", startup->filename, ret);
+			}
+			else
+			{
+				LOG_MSG(gens, LOG_MSG_LEVEL_INFO,
+					"Rendered GYM '%s' to '%s'.", startup->filename, wav_filename.c_str());
+			}
+			
+			close_gens();
+			break;
+		}
+		
 		case GSM_IDLE:
 		case GSM_MAX:
 		default:
@@ -76,6 +76,7 @@ typedef struct _Gens_PathNames_t
 	
 	char Dump_WAV_Dir[GENS_PATH_MAX];
 	char Dump_GYM_Dir[GENS_PATH_MAX];
+	char Dump_AVI_Dir[GENS_PATH_MAX];
 	char Screenshot_Dir[GENS_PATH_MAX];
 	
 #ifdef GENS_OS_WIN32
@@ -146,6 +147,9 @@ extern int Country;
 extern int Country_Order[3];
 extern int Intro_Style;
 extern int SegaCD_Accurate;
+extern int SegaCD_Adaptive_Sync;
+extern int Idle_Loop_Skip;
+extern char Idle_Loop_Skip_Disable[1024];
 extern int Quick_Exit;
 extern int fast_forward;
 
@@ -60,6 +60,9 @@ using std::list;
 // Video, Input.
 #include "video/vdraw_sdl.h"
 #include "video/vdraw_cpp.hpp"
+#ifdef GENS_OPENGL
+#include "video/vdraw_gl.h"
+#endif /* GENS_OPENGL */
 #include "input/input_sdl.h"
 
 #include "gens/gens_window.h"
@@ -137,6 +140,12 @@ int main(int argc, char *argv[])
 	// Initialize the PRNG.
 	Init_PRNG();
 	
+#ifdef GENS_OPENGL
+	// The OpenGL backend presents frames on a separate thread.
+	// This must be done before the UI opens the display.
+	vdraw_gl_init_threads();
+#endif /* GENS_OPENGL */
+	
 	// Initialize the UI.
 	Settings.showMenuBar = 1;
 	GensUI::init(&argc, &argv);
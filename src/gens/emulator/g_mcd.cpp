@@ -28,6 +28,7 @@ using std::string;
 #include "gens_core/sound/ym2612.hpp"
 #include "gens_core/sound/psg.h"
 #include "gens_core/cpu/68k/cpu_68k.h"
+#include "gens_core/cpu/68k/cpu_68k_idle.h"
 #include "gens_core/cpu/z80/cpu_z80.h"
 #include "mdZ80/mdZ80.h"
 #include "gens_core/vdp/vdp_io.h"
@@ -49,6 +50,10 @@ using std::string;
 
 #include "util/sound/wave.h"
 #include "util/sound/gym.hpp"
+#ifdef GENS_ZLIB
+#include "util/video/avi.hpp"
+#endif
+#include "util/gfx/imageutil.hpp"
 
 #include "libgsft/gsft_byteswap.h"
 #include "macros/force_inline.h"
@@ -66,6 +71,9 @@ using std::string;
 // Used for hard reset to know the game name.
 static unsigned char SegaCD_Header[512];
 
+// Idle loop skipping for the Sub 68000.
+static bool MCD_Idle_Skip = false;
+
 
 /**
  * Detect_Country_SegaCD(): Detect the country code of a SegaCD game.
@@ -119,6 +127,10 @@ int Init_SegaCD(const char* iso_name)
 		return 0;
 	}
 	
+	// The disc header has the same layout as an MD ROM header.
+	MCD_Idle_Skip = Idle_Loop_Skip_Allowed((const ROM_t*)SegaCD_Header);
+	Z80_Idle_Skip = MCD_Idle_Skip;
+	
 	// Check what BIOS should be used.
 	// TODO: Get rid of magic numbers.
 	switch (Country)
@@ -229,6 +241,11 @@ int Init_SegaCD(const char* iso_name)
 		Update_Frame = Do_SegaCD_Frame_Cycle_Accurate;
 		Update_Frame_Fast = Do_SegaCD_Frame_No_VDP_Cycle_Accurate;
 	}
+	else if (SegaCD_Adaptive_Sync)
+	{
+		Update_Frame = Do_SegaCD_Frame_Adaptive;
+		Update_Frame_Fast = Do_SegaCD_Frame_No_VDP_Adaptive;
+	}
 	else
 	{
 		Update_Frame = Do_SegaCD_Frame;
@@ -258,6 +275,8 @@ int Reload_SegaCD(const char* iso_name)
 	// Update the CD-ROM name.
 	Reset_CD((char*)SegaCD_Header, iso_name);
 	ROM::updateCDROMName(SegaCD_Header, Game_Mode);
+	MCD_Idle_Skip = Idle_Loop_Skip_Allowed((const ROM_t*)SegaCD_Header);
+	Z80_Idle_Skip = MCD_Idle_Skip;
 	
 	// Update the window title with the game name.
 	Options::setGameName(1);
@@ -360,6 +379,8 @@ static FORCE_INLINE void T_Draw_SegaCD_LED(pixel* screen, pixel color, unsigned
 	*(line2 + 1)	= color;
 	*(line2 + 2)	= color;
 	*(line2 + 3)	= color;
+	
+	VDP_Dirty_Lines_Mark(bottom_line - 4, 3);
 }
 
 
@@ -405,13 +426,97 @@ static void SegaCD_Display_LED(void)
 }
 
 
+/**
+ * MCD_Sync_t: Main/sub 68000 synchronization modes.
+ */
+typedef enum
+{
+	MCD_SYNC_NORMAL		= 0,	// Sync once per line.
+	MCD_SYNC_PERFECT	= 1,	// Interleave every 24/39 cycles.
+	MCD_SYNC_ADAPTIVE	= 2,	// Interleave only around shared register accesses.
+} MCD_Sync_t;
+
+// Adaptive sync: Number of main 68000 cycles to keep interleaving
+// the CPUs after the last access to a shared gate array register.
+#define MCD_SYNC_WINDOW_CYCLES (488 * 2)
+static int MCD_Sync_Window = 0;
+
+
+/**
+ * MCD_Exec_S68K(): Run the Sub 68000 until the odometer reaches the specified value.
+ * The Sub 68000 skips idle loops if the Main 68000 won't run until this returns.
+ * @param odo Odometer value.
+ */
+static FORCE_INLINE void MCD_Exec_S68K(int odo)
+{
+	if (MCD_Idle_Skip)
+		S68K_Exec_Idle(odo);
+	else
+		sub68k_exec(odo);
+}
+
+
+/**
+ * mcd_sync_adaptive(): Run both 68000s to a point in the current line.
+ * The CPUs run in large timeslices until one of them accesses a shared
+ * gate array register, which ends its timeslice early. The CPUs are then
+ * interleaved in 24/39-cycle steps, same as Perfect Sync, until
+ * MCD_SYNC_WINDOW_CYCLES pass without another access.
+ * @param m_end Main 68000 cycle to run to.
+ * @param s_end Sub 68000 cycle to run to.
+ */
+static void mcd_sync_adaptive(const int m_end, const int s_end)
+{
+	int m = (int)main68k_readOdometer();
+	
+	while (m < m_end)
+	{
+		MCD_Sync_Touch = 0;
+		
+		if (MCD_Sync_Window > 0)
+		{
+			// Fine-grained interleaving.
+			m += 24;
+			if (m > m_end)
+				m = m_end;
+			
+			main68k_exec(m);
+			sub68k_exec(s_end - ((m_end - m) * 39 / 24));
+			MCD_Sync_Window -= 24;
+		}
+		else
+		{
+			// Large timeslice.
+			// The main 68000 stops early if it accesses a shared register.
+			// The sub 68000 then runs to the same point in time.
+			MCD_Sync_Release = 1;
+			main68k_exec(m_end);
+			
+			const int m_cur = (int)main68k_readOdometer();
+			if (m_cur > m && m_cur < m_end)
+				m = m_cur;
+			else
+				m = m_end;
+			
+			MCD_Exec_S68K(s_end - ((m_end - m) * 39 / 24));
+			MCD_Sync_Release = 0;
+		}
+		
+		if (MCD_Sync_Touch)
+			MCD_Sync_Window = MCD_SYNC_WINDOW_CYCLES;
+	}
+	
+	MCD_Exec_S68K(s_end);
+}
+
+
 /**
  * T_gens_do_MCD_line(): Do an MCD line.
  * @param LineType Line type.
  * @param VDP If true, VDP is updated.
- * @param perfect_sync If true, use perfect synchronization.
+ * @param sync Main/sub 68000 synchronization mode.
  */
-template<LineType_t LineType, bool VDP, bool perfect_sync>
+template<LineType_t LineType, bool VDP, MCD_Sync_t sync>
 static FORCE_INLINE void T_gens_do_MCD_line(void)
 {
 	int *buf[2], i, j;
@@ -425,7 +530,7 @@ static FORCE_INLINE void T_gens_do_MCD_line(void)
 	PSG_Len += Sound_Extrapol[VDP_Lines.Display.Current][1];
 	Update_CDC_TRansfert();
 	
-	if (perfect_sync)
+	if (sync == MCD_SYNC_PERFECT)
 	{
 		i = Cycles_M68K + 24;
 		j = Cycles_S68K + 39;
@@ -446,29 +551,34 @@ static FORCE_INLINE void T_gens_do_MCD_line(void)
 			// In visible area.
 			VDP_Status |= 0x0004;	// HBlank = 1
 			
-			if (!perfect_sync)
+			if (sync == MCD_SYNC_NORMAL)
 			{
 				// Perfect Sync is disabled.
-				main68k_exec(Cycles_M68K - 404);
+				main68k_exec(Cycles_M68K - LINE_M68K_HBLANK_END);
+			}
+			else if (sync == MCD_SYNC_ADAPTIVE)
+			{
+				// Adaptive sync is enabled.
+				mcd_sync_adaptive(Cycles_M68K - LINE_M68K_HBLANK_END, Cycles_S68K - LINE_S68K_HBLANK_END);
 			}
 			else
 			{
 				// Perfect sync is enabled.
 				// Use instruction by instruction execution.
-				while (i < (Cycles_M68K - 404))
+				while (i < (Cycles_M68K - LINE_M68K_HBLANK_END))
 				{
 					main68k_exec(i);
 					i += 24;
 					
-					if (j < (Cycles_S68K - 658))
+					if (j < (Cycles_S68K - LINE_S68K_HBLANK_END))
 					{
 						sub68k_exec(j);
 						j += 39;
 					}
 				}
 				
-				main68k_exec(Cycles_M68K - 404);
-				sub68k_exec(Cycles_S68K - 658);
+				main68k_exec(Cycles_M68K - LINE_M68K_HBLANK_END);
+				sub68k_exec(Cycles_S68K - LINE_S68K_HBLANK_END);
 			}
 			
 			VDP_Status &= ~0x0004;	// HBlank = 0
@@ -486,7 +596,12 @@ static FORCE_INLINE void T_gens_do_MCD_line(void)
 				VDP_Render_Line();
 			}
 			
-			if (perfect_sync)
+			if (sync == MCD_SYNC_ADAPTIVE)
+			{
+				// Adaptive sync is enabled.
+				mcd_sync_adaptive(Cycles_M68K, Cycles_S68K);
+			}
+			else if (sync == MCD_SYNC_PERFECT)
 			{
 				// Perfect sync is enabled.
 				// Use instruction by instruction execution.
@@ -515,16 +630,21 @@ static FORCE_INLINE void T_gens_do_MCD_line(void)
 			
 			VDP_Status |= 0x000C;		// VBlank = 1 et HBlank = 1 (retour de balayage vertical en cours)
 			
-			if (perfect_sync)
+			if (sync == MCD_SYNC_ADAPTIVE)
+			{
+				// Adaptive sync is enabled.
+				mcd_sync_adaptive(Cycles_M68K - LINE_M68K_VINT, Cycles_S68K - LINE_S68K_VINT);
+			}
+			else if (sync == MCD_SYNC_PERFECT)
 			{
 				// Perfect sync is enabled.
 				// Use instruction by instruction execution.
-				while (i < (Cycles_M68K - 360))
+				while (i < (Cycles_M68K - LINE_M68K_VINT))
 				{
 					main68k_exec(i);
 					i += 24;
 					
-					if (j < (Cycles_S68K - 586))
+					if (j < (Cycles_S68K - LINE_S68K_VINT))
 					{
 						sub68k_exec(j);
 						j += 39;
@@ -532,9 +652,9 @@ static FORCE_INLINE void T_gens_do_MCD_line(void)
 				}
 			}
 			
-			main68k_exec(Cycles_M68K - 360);
-			sub68k_exec(Cycles_S68K - 586);
-			Z80_EXEC(168);
+			main68k_exec(Cycles_M68K - LINE_M68K_VINT);
+			MCD_Exec_S68K(Cycles_S68K - LINE_S68K_VINT);
+			Z80_EXEC(LINE_Z80_VINT);
 			
 			VDP_Status &= ~0x0004;		// HBlank = 0
 			VDP_Status |=  0x0080;		// V Int happened
@@ -548,7 +668,12 @@ static FORCE_INLINE void T_gens_do_MCD_line(void)
 				VDP_Render_Line();
 			}
 			
-			if (perfect_sync)
+			if (sync == MCD_SYNC_ADAPTIVE)
+			{
+				// Adaptive sync is enabled.
+				mcd_sync_adaptive(Cycles_M68K, Cycles_S68K);
+			}
+			else if (sync == MCD_SYNC_PERFECT)
 			{
 				// Perfect sync is enabled.
 				// Use instruction by instruction execution.
@@ -579,30 +704,37 @@ static FORCE_INLINE void T_gens_do_MCD_line(void)
 				VDP_Render_Line();
 			}
 			
-			if (!perfect_sync)
+			if (sync == MCD_SYNC_NORMAL)
+			{
+				// Perfect Sync is disabled.
+				main68k_exec(Cycles_M68K - LINE_M68K_HBLANK_END);
+				VDP_Status &= ~0x0004;	// HBlank = 0
+			}
+			else if (sync == MCD_SYNC_ADAPTIVE)
 			{
-				// Perfect sync is disabled.
-				main68k_exec(Cycles_M68K - 404);
+				// Adaptive sync is enabled.
+				mcd_sync_adaptive(Cycles_M68K - LINE_M68K_HBLANK_END, Cycles_S68K - LINE_S68K_HBLANK_END);
 				VDP_Status &= ~0x0004;	// HBlank = 0
+				mcd_sync_adaptive(Cycles_M68K, Cycles_S68K);
 			}
 			else
 			{
 				// Perfect sync is enabled.
 				// Use instruction by instruction execution.
-				while (i < (Cycles_M68K - 404))
+				while (i < (Cycles_M68K - LINE_M68K_HBLANK_END))
 				{
 					main68k_exec(i);
 					i += 24;
 					
-					if (j < (Cycles_S68K - 658))
+					if (j < (Cycles_S68K - LINE_S68K_HBLANK_END))
 					{
 						sub68k_exec(j);
 						j += 39;
 					}
 				}
 				
-				main68k_exec(Cycles_M68K - 404);
-				sub68k_exec(Cycles_S68K - 658);
+				main68k_exec(Cycles_M68K - LINE_M68K_HBLANK_END);
+				sub68k_exec(Cycles_S68K - LINE_S68K_HBLANK_END);
 				
 				VDP_Status &= ~0x0004;	// HBlank = 0
 				
@@ -623,7 +755,7 @@ static FORCE_INLINE void T_gens_do_MCD_line(void)
 	}
 	
 	main68k_exec(Cycles_M68K);
-	sub68k_exec(Cycles_S68K);
+	MCD_Exec_S68K(Cycles_S68K);
 	Z80_EXEC(0);
 	
 	Update_SegaCD_Timer();
@@ -633,9 +765,9 @@ static FORCE_INLINE void T_gens_do_MCD_line(void)
 /**
  * T_gens_do_MCD_frame(): Do an MCD frame.
  * @param VDP If true, VDP is updated.
- * @param perfect_sync If true, use perfect synchronization.
+ * @param sync Main/sub 68000 synchronization mode.
  */
-template<bool VDP, bool perfect_sync>
+template<bool VDP, MCD_Sync_t sync>
 static FORCE_INLINE int T_gens_do_MCD_frame(void)
 {
 	// Initialize VDP_Lines.Display.
@@ -680,7 +812,7 @@ static FORCE_INLINE int T_gens_do_MCD_frame(void)
 	     VDP_Lines.Visible.Current < 0;
 	     VDP_Lines.Display.Current++, VDP_Lines.Visible.Current++)
 	{
-		T_gens_do_MCD_line<LINETYPE_BORDER, VDP, perfect_sync>();
+		T_gens_do_MCD_line<LINETYPE_BORDER, VDP, sync>();
 	}
 	
 	/** Visible line 0. **/
@@ -692,18 +824,18 @@ static FORCE_INLINE int T_gens_do_MCD_frame(void)
 	     VDP_Lines.Visible.Current < VDP_Lines.Visible.Total;
 	     VDP_Lines.Display.Current++, VDP_Lines.Visible.Current++)
 	{
-		T_gens_do_MCD_line<LINETYPE_ACTIVEDISPLAY, VDP, perfect_sync>();
+		T_gens_do_MCD_line<LINETYPE_ACTIVEDISPLAY, VDP, sync>();
 	}
 	
 	/** Loop 2: VBlank line. **/
-	T_gens_do_MCD_line<LINETYPE_VBLANKLINE, VDP, perfect_sync>();
+	T_gens_do_MCD_line<LINETYPE_VBLANKLINE, VDP, sync>();
 	
 	/** Loop 3: Bottom border. **/
 	for (VDP_Lines.Display.Current++, VDP_Lines.Visible.Current++;
 	     VDP_Lines.Display.Current < VDP_Lines.Display.Total;
 	     VDP_Lines.Display.Current++, VDP_Lines.Visible.Current++)
 	{
-		T_gens_do_MCD_line<LINETYPE_BORDER, VDP, perfect_sync>();
+		T_gens_do_MCD_line<LINETYPE_BORDER, VDP, sync>();
 	}
 	
 	// Update the PSG and YM2612 output.
@@ -744,23 +876,41 @@ static FORCE_INLINE int T_gens_do_MCD_frame(void)
 	
 	EventMgr::RaiseEvent(MDP_EVENT_POST_FRAME, &post_frame);
 	
+#ifdef GENS_ZLIB
+	// If an AVI is being dumped, queue the frame.
+	if (AVI_Dumping)
+		avi_dump_update(&post_frame);
+#endif
+	
+	// Burst screenshots.
+	if (VDP && ImageUtil::BurstFrames > 0)
+		ImageUtil::UpdateBurst();
+	
 	return 1;
 }
 
 
 int Do_SegaCD_Frame_No_VDP(void)
 {
-	return T_gens_do_MCD_frame<false, false>();
+	return T_gens_do_MCD_frame<false, MCD_SYNC_NORMAL>();
 }
 int Do_SegaCD_Frame_No_VDP_Cycle_Accurate(void)
 {
-	return T_gens_do_MCD_frame<false, true>();
+	return T_gens_do_MCD_frame<false, MCD_SYNC_PERFECT>();
+}
+int Do_SegaCD_Frame_No_VDP_Adaptive(void)
+{
+	return T_gens_do_MCD_frame<false, MCD_SYNC_ADAPTIVE>();
 }
 int Do_SegaCD_Frame(void)
 {
-	return T_gens_do_MCD_frame<true, false>();
+	return T_gens_do_MCD_frame<true, MCD_SYNC_NORMAL>();
 }
 int Do_SegaCD_Frame_Cycle_Accurate(void)
 {
-	return T_gens_do_MCD_frame<true, true>();
+	return T_gens_do_MCD_frame<true, MCD_SYNC_PERFECT>();
+}
+int Do_SegaCD_Frame_Adaptive(void)
+{
+	return T_gens_do_MCD_frame<true, MCD_SYNC_ADAPTIVE>();
 }
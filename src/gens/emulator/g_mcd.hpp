@@ -20,6 +20,8 @@ int Do_SegaCD_Frame_No_VDP(void);
 int Do_SegaCD_Frame(void);
 int Do_SegaCD_Frame_Cycle_Accurate(void);
 int Do_SegaCD_Frame_No_VDP_Cycle_Accurate(void);
+int Do_SegaCD_Frame_Adaptive(void);
+int Do_SegaCD_Frame_No_VDP_Adaptive(void);
 
 #ifdef __cplusplus
 }
@@ -12,6 +12,7 @@
 
 // C includes.
 #include <string.h>
+#include <ctype.h>
 
 #include "gens.hpp"
 #include "g_md.hpp"
@@ -21,6 +22,7 @@
 #include "gens_core/sound/ym2612.hpp"
 #include "gens_core/sound/psg.h"
 #include "gens_core/cpu/68k/cpu_68k.h"
+#include "gens_core/cpu/68k/cpu_68k_idle.h"
 #include "gens_core/cpu/z80/cpu_z80.h"
 #include "mdZ80/mdZ80.h"
 #include "gens_core/vdp/vdp_io.h"
@@ -37,6 +39,10 @@
 
 #include "util/sound/wave.h"
 #include "util/sound/gym.hpp"
+#ifdef GENS_ZLIB
+#include "util/video/avi.hpp"
+#endif
+#include "util/gfx/imageutil.hpp"
 
 #include "libgsft/gsft_byteswap.h"
 #include "macros/force_inline.h"
@@ -53,6 +59,9 @@
 
 int congratulations = 0;
 
+// Idle loop skipping for the current game.
+static bool MD_Idle_Skip = false;
+
 
 /**
  * Detect_Country_Genesis(): Detect the country code of a Genesis game.
@@ -256,6 +265,54 @@ void Init_Genesis_SRAM(ROM_t* MD_ROM)
 }
 
 
+/**
+ * Idle_Loop_Skip_Allowed(): Check if idle loop skipping is allowed for a game.
+ * Idle_Loop_Skip_Disable is a list of ROM serial numbers, separated by commas.
+ * @param MD_ROM ROM header. (Sega CD games use the disc header.)
+ * @return Non-zero if idle loop skipping is allowed.
+ */
+int Idle_Loop_Skip_Allowed(const ROM_t* MD_ROM)
+{
+	if (!Idle_Loop_Skip)
+		return 0;
+	if (!MD_ROM)
+		return 1;
+	
+	// Get the serial number without padding.
+	const char *serial = MD_ROM->Serial_Number;
+	int serial_len = sizeof(MD_ROM->Serial_Number);
+	while (serial_len > 0 && isspace((unsigned char)*serial))
+	{
+		serial++;
+		serial_len--;
+	}
+	while (serial_len > 0 && (isspace((unsigned char)serial[serial_len - 1]) || serial[serial_len - 1] == 0))
+		serial_len--;
+	if (serial_len == 0)
+		return 1;
+	
+	const char *entry = Idle_Loop_Skip_Disable;
+	while (*entry)
+	{
+		while (*entry == ',' || isspace((unsigned char)*entry))
+			entry++;
+		
+		int len = 0;
+		while (entry[len] && entry[len] != ',')
+			len++;
+		int cmp_len = len;
+		while (cmp_len > 0 && isspace((unsigned char)entry[cmp_len - 1]))
+			cmp_len--;
+		
+		if (cmp_len == serial_len && !strncasecmp(entry, serial, serial_len))
+			return 0;
+		entry += len;
+	}
+	
+	return 1;
+}
+
+
 /**
  * Init_Genesis(): Initialize the Genesis with the specified ROM image.
  * @param MD_ROM ROM image struct.
@@ -317,6 +374,10 @@ int Init_Genesis(ROM_t* MD_ROM)
 	be16_to_cpu_array(Rom_Data.u8, Rom_Size);
 	ROM_ByteSwap_State |= ROM_BYTESWAPPED_MD_ROM;
 	
+	// Check if idle loop skipping is allowed for this game.
+	MD_Idle_Skip = Idle_Loop_Skip_Allowed(MD_ROM);
+	Z80_Idle_Skip = MD_Idle_Skip;
+	
 	// Reset all CPUs and other components.
 	M68K_Reset(0);
 	Z80_Reset();
@@ -444,6 +505,19 @@ do {									\
 } while (0)
 
 
+/**
+ * MD_Exec_M68K(): Run the Main 68000 until the odometer reaches the specified value.
+ * @param odo Odometer value.
+ */
+static FORCE_INLINE void MD_Exec_M68K(int odo)
+{
+	if (MD_Idle_Skip)
+		M68K_Exec_Idle(odo);
+	else
+		main68k_exec(odo);
+}
+
+
 /**
  * T_gens_do_MD_line(): Do an MD line.
  * @param LineType Line type.
@@ -470,7 +544,7 @@ static FORCE_INLINE void T_gens_do_MD_line(void)
 		case LINETYPE_ACTIVEDISPLAY:
 			// In visible area.
 			VDP_Status |=  0x0004;	// HBlank = 1
-			main68k_exec(Cycles_M68K - 404);
+			MD_Exec_M68K(Cycles_M68K - LINE_M68K_HBLANK_END);
 			VDP_Status &= ~0x0004;	// HBlank = 0
 			
 			if (--VDP_Reg.HInt_Counter < 0)
@@ -496,8 +570,8 @@ static FORCE_INLINE void T_gens_do_MD_line(void)
 			if (VDP_Lines.NTSC_V30.VBlank_Div != 0)
 				VDP_Status &= ~0x0008;
 			
-			main68k_exec(Cycles_M68K - 360);
-			Z80_EXEC(168);
+			MD_Exec_M68K(Cycles_M68K - LINE_M68K_VINT);
+			Z80_EXEC(LINE_Z80_VINT);
 			CONGRATULATIONS_POSTCHECK();
 			
 			VDP_Status &= ~0x0004;		// HBlank = 0
@@ -524,7 +598,7 @@ static FORCE_INLINE void T_gens_do_MD_line(void)
 		VDP_Render_Line();
 	}
 		
-	main68k_exec(Cycles_M68K);
+	MD_Exec_M68K(Cycles_M68K);
 	Z80_EXEC(0);
 }
 
@@ -626,6 +700,16 @@ static FORCE_INLINE void T_gens_do_MD_frame(void)
 		post_frame.md_screen = &MD_Screen.u16[screen_offset];
 	
 	EventMgr::RaiseEvent(MDP_EVENT_POST_FRAME, &post_frame);
+	
+#ifdef GENS_ZLIB
+	// If an AVI is being dumped, queue the frame.
+	if (AVI_Dumping)
+		avi_dump_update(&post_frame);
+#endif
+	
+	// Burst screenshots.
+	if (VDP && ImageUtil::BurstFrames > 0)
+		ImageUtil::UpdateBurst();
 }
 
 
@@ -14,6 +14,7 @@ extern "C" {
 extern int congratulations;
 
 void Detect_Country_Genesis(ROM_t* MD_ROM);
+int Idle_Loop_Skip_Allowed(const ROM_t* MD_ROM);
 
 void Init_Genesis_Bios(void);
 void Init_Genesis_SRAM(ROM_t* MD_ROM);
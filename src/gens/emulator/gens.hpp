@@ -16,16 +16,39 @@
 
 // Z80 includes. (mem_m68k.h contains Z80_State.)
 #include "gens_core/mem/mem_m68k.h"
+#include "gens_core/cpu/z80/cpu_z80_idle.h"
 #include "mdZ80/mdZ80.h"
 
+/**
+ * Line timing: Position of each event within a line, in cycles before the end
+ * of the line. Every system runs its CPUs up to these points and then handles
+ * the event. The Sub 68000 and Z80 values are the Main 68000 values scaled
+ * by the NTSC clock ratios.
+ */
+#define LINE_M68K_HBLANK_END	404	// HBlank ends. (Main 68000)
+#define LINE_S68K_HBLANK_END	658	// HBlank ends. (Sub 68000)
+#define LINE_M68K_VINT		360	// VInt is raised. (Main 68000)
+#define LINE_S68K_VINT		586	// VInt is raised. (Sub 68000)
+#define LINE_Z80_VINT		168	// VInt is raised. (Z80)
+
+// 32X: The Main 68000, the SH2s, and the PWM timer run
+// in steps of this many Main 68000 cycles.
+#define LINE_32X_STEP_M68K	84
+
 /**
  * Z80_EXEC(): Z80 execution macro.
+ * Idle loops are skipped if Z80_Idle_Skip is set.
  * @param cyclesSubtract Cycles to subtract from Cycles_Z80.
  */
 #define Z80_EXEC(cyclesSubtract)					\
 do {									\
 	if (Z80_State == (Z80_STATE_ENABLED | Z80_STATE_BUSREQ))	\
-		z80_Exec(&M_Z80, Cycles_Z80 - (cyclesSubtract));	\
+	{								\
+		if (Z80_Idle_Skip)					\
+			Z80_Exec_Idle(Cycles_Z80 - (cyclesSubtract));	\
+		else							\
+			z80_Exec(&M_Z80, Cycles_Z80 - (cyclesSubtract));	\
+	}								\
 	else								\
 		mdZ80_set_odo(&M_Z80, Cycles_Z80 - (cyclesSubtract));	\
 } while (0)
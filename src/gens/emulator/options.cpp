@@ -70,6 +70,7 @@ using std::list;
 // Video, Audio.
 #include "video/vdraw.h"
 #include "video/vdraw_cpp.hpp"
+#include "video/vdraw_present.h"
 #include "audio/audio.h"
 
 // WAV dumping.
@@ -902,11 +903,22 @@ void Options::setSegaCD_PerfectSync(const bool newSegaCD_PerfectSync)
 		// SegaCD Perfect Sync disabled.
 		if (SegaCD_Started)
 		{
-			Update_Frame = Do_SegaCD_Frame;
-			Update_Frame_Fast = Do_SegaCD_Frame_No_VDP;
+			if (SegaCD_Adaptive_Sync)
+			{
+				Update_Frame = Do_SegaCD_Frame_Adaptive;
+				Update_Frame_Fast = Do_SegaCD_Frame_No_VDP_Adaptive;
+			}
+			else
+			{
+				Update_Frame = Do_SegaCD_Frame;
+				Update_Frame_Fast = Do_SegaCD_Frame_No_VDP;
+			}
 		}
-	
-		vdraw_text_write("SegaCD normal mode", 1500);
+		
+		if (SegaCD_Adaptive_Sync)
+			vdraw_text_write("SegaCD adaptive sync mode", 1500);
+		else
+			vdraw_text_write("SegaCD normal mode", 1500);
 	}
 	else
 	{
@@ -1060,8 +1072,12 @@ void Options::setVSync(const bool newVSync)
 		vdraw_text_write("Vertical Sync Disabled", 1000);
 	
 	// Update VSync.
+	// The rendering context has to be current on this thread.
 	if (vdraw_update_vsync)
+	{
+		vdraw_present_end();
 		vdraw_update_vsync(0);
+	}
 }
 
 
@@ -1171,6 +1187,9 @@ void Options::setOpenGL_LinearFilter(bool newFilter)
 	if (Video.GL.glLinearFilter == newFilter)
 		return;
 	
+	// The presentation thread reads the filter setting.
+	// It's restarted by the next vdraw_flip().
+	vdraw_present_end();
 	Video.GL.glLinearFilter = newFilter;
 	
 	if (Video.GL.glLinearFilter)
@@ -1210,7 +1229,10 @@ void Options::setOpenGL_OrthographicProjection(bool newOrthoProj)
 	
 	// If OpenGL is in use, reinitialize the renderer.
 	if (vdraw_cur_backend_id == VDRAW_BACKEND_SDL_GL)
+	{
+		vdraw_present_end();
 		vdraw_cur_backend->update_renderer();
+	}
 	
 	// Synchronize the Graphics Menu.
 	Sync_Gens_Window_GraphicsMenu();
@@ -73,6 +73,7 @@
 
 // Video, Audio, Input.
 #include "video/vdraw.h"
+#include "video/vdraw_mt.h"
 #include "audio/audio.h"
 #include "input/input.h"
 
@@ -102,6 +103,7 @@ static const opt1arg_str_t opt1arg_str[] =
 	{"brampath",		"pathname",	"Path where to save your BRAM files"},
 	{"dumpwavpath",		"pathname",	"Path where to save your WAV files"},
 	{"dumpgympath",		"pathname",	"Path where to save your GYM files"},
+	{"dumpavipath",		"pathname",	"Path where to save your AVI files"},
 	{"screenshotpath",	"pathname",	"Path where to save your screenshot files"},
 	{"patchpath",		"pathname",	"Path where to save your patch files"},
 	{"genesisbios",		"filename",	"Genesis BIOS"},
@@ -118,6 +120,9 @@ static const opt1arg_str_t opt1arg_str[] =
 	{"msh2-speed",		"percentage",	"Master SH2 Speed"},
 	{"ssh2-speed",		"percentage",	"Slave SH2 Speed"},
 	{"ramcart-size",	"number",	"SegaCD RAM cart size"},
+	{"gym2wav",		"filename",	"Render a GYM file to WAV as fast as possible, then exit"},
+	{"screenshot-burst",	"frames",	"Save a screenshot of each of the first N frames"},
+	{"render-threads",	"number",	"Render threads for band-safe renderers (0 [Auto] -> 16)"},
 	{NULL, NULL, NULL}
 };
 
@@ -130,7 +135,9 @@ enum opt1arg_enum
 	OPT1_BRAMPATH,
 	OPT1_DUMPWAVPATH,
 	OPT1_DUMPGYMPATH,
+	OPT1_DUMPAVIPATH,
 	OPT1_SCREENSHOTPATH,
+	OPT1_PATCHPATH,
 	OPT1_GENESISBIOS,
 	OPT1_USACDBIOS,
 	OPT1_EUROPECDBIOS,
@@ -145,6 +152,9 @@ enum opt1arg_enum
 	OPT1_MSH2_SPEED,
 	OPT1_SSH2_SPEED,
 	OPT1_RAMCART_SIZE,
+	OPT1_GYM2WAV,
+	OPT1_SCREENSHOT_BURST,
+	OPT1_RENDER_THREADS,
 	OPT1_TOTAL
 };
 
@@ -227,6 +237,8 @@ static const optBarg_str_t optBarg_str[] =
 	OPTBARG_STR("pwm",		"PWM"),
 	OPTBARG_STR("cdda",		"CDDA"),
 	OPTBARG_STR("perfect-sync",	"SegaCD Perfect Sync"),
+	OPTBARG_STR("adaptive-sync",	"SegaCD Adaptive Sync"),
+	OPTBARG_STR("idle-skip",	"Idle Loop Skipping"),
 	OPTBARG_STR("fastblur",		"Fast Blur"),
 	OPTBARG_STR("fps",		"FPS counter"),
 	OPTBARG_STR("message",		"Message Display"),
@@ -257,6 +269,8 @@ enum optBarg_enum
 	OPTB_PWM,
 	OPTB_CDDA,
 	OPTB_PERFECT_SYNC,
+	OPTB_ADAPTIVE_SYNC,
+	OPTB_IDLE_SKIP,
 	OPTB_FASTBLUR,
 	OPTB_FPS,
 	OPTB_MSG,
@@ -286,6 +300,7 @@ static const struct option long_options[] =
 	LONGOPT_1ARG(OPT1_BRAMPATH),
 	LONGOPT_1ARG(OPT1_DUMPWAVPATH),
 	LONGOPT_1ARG(OPT1_DUMPGYMPATH),
+	LONGOPT_1ARG(OPT1_DUMPAVIPATH),
 	LONGOPT_1ARG(OPT1_SCREENSHOTPATH),
 	LONGOPT_1ARG(OPT1_GENESISBIOS),
 	LONGOPT_1ARG(OPT1_USACDBIOS),
@@ -301,6 +316,9 @@ static const struct option long_options[] =
 	LONGOPT_1ARG(OPT1_MSH2_SPEED),
 	LONGOPT_1ARG(OPT1_SSH2_SPEED),
 	LONGOPT_1ARG(OPT1_RAMCART_SIZE),
+	LONGOPT_1ARG(OPT1_GYM2WAV),
+	LONGOPT_1ARG(OPT1_SCREENSHOT_BURST),
+	LONGOPT_1ARG(OPT1_RENDER_THREADS),
 	
 	// 0-argument parameters.
 	LONGOPT_0ARG(OPT0_HELP),
@@ -337,6 +355,8 @@ static const struct option long_options[] =
 	LONGOPT_BARG(OPTB_PWM),
 	LONGOPT_BARG(OPTB_CDDA),
 	LONGOPT_BARG(OPTB_PERFECT_SYNC),
+	LONGOPT_BARG(OPTB_ADAPTIVE_SYNC),
+	LONGOPT_BARG(OPTB_IDLE_SKIP),
 	LONGOPT_BARG(OPTB_FASTBLUR),
 	LONGOPT_BARG(OPTB_FPS),
 	LONGOPT_BARG(OPTB_MSG),
@@ -520,6 +540,31 @@ Gens_StartupInfo_t* parse_args(int argc, char *argv[])
 			continue;
 		}
 		
+		if (!strcmp(long_options[option_index].name, opt1arg_str[OPT1_GYM2WAV].option))
+		{
+			// Render a GYM file to WAV.
+			if (optarg && optarg[0] != 0x00)
+			{
+				strlcpy(startup->filename, optarg, sizeof(startup->filename));
+				startup->mode = GSM_GYM_TO_WAV;
+			}
+			continue;
+		}
+		
+		if (!strcmp(long_options[option_index].name, opt1arg_str[OPT1_SCREENSHOT_BURST].option))
+		{
+			// Burst screenshots.
+			ImageUtil::StartBurst(optarg ? atoi(optarg) : 0);
+			continue;
+		}
+		
+		if (!strcmp(long_options[option_index].name, opt1arg_str[OPT1_RENDER_THREADS].option))
+		{
+			// Render threads.
+			vdraw_mt_set_threads(optarg ? atoi(optarg) : 0);
+			continue;
+		}
+		
 		// Test string options.
 		TEST_OPTION_STRING(opt1arg_str[OPT1_ROMPATH].option, Rom_Dir);
 		TEST_OPTION_STRING(opt1arg_str[OPT1_SAVEPATH].option, State_Dir);
@@ -527,6 +572,7 @@ Gens_StartupInfo_t* parse_args(int argc, char *argv[])
 		TEST_OPTION_STRING(opt1arg_str[OPT1_BRAMPATH].option, BRAM_Dir);
 		TEST_OPTION_STRING(opt1arg_str[OPT1_DUMPWAVPATH].option, PathNames.Dump_WAV_Dir);
 		TEST_OPTION_STRING(opt1arg_str[OPT1_DUMPGYMPATH].option, PathNames.Dump_GYM_Dir);
+		TEST_OPTION_STRING(opt1arg_str[OPT1_DUMPAVIPATH].option, PathNames.Dump_AVI_Dir);
 		TEST_OPTION_STRING(opt1arg_str[OPT1_SCREENSHOTPATH].option, PathNames.Screenshot_Dir);
 		TEST_OPTION_STRING(opt1arg_str[OPT1_GENESISBIOS].option, BIOS_Filenames.MD_TMSS);
 		TEST_OPTION_STRING(opt1arg_str[OPT1_USACDBIOS].option, BIOS_Filenames.SegaCD_US);
@@ -550,6 +596,8 @@ Gens_StartupInfo_t* parse_args(int argc, char *argv[])
 		TEST_OPTION_ENABLE(optBarg_str[OPTB_PWM], PWM_Enable);
 		TEST_OPTION_ENABLE(optBarg_str[OPTB_CDDA], CDDA_Enable);
 		TEST_OPTION_ENABLE(optBarg_str[OPTB_PERFECT_SYNC], SegaCD_Accurate);
+		TEST_OPTION_ENABLE(optBarg_str[OPTB_ADAPTIVE_SYNC], SegaCD_Adaptive_Sync);
+		TEST_OPTION_ENABLE(optBarg_str[OPTB_IDLE_SKIP], Idle_Loop_Skip);
 		TEST_OPTION_NUMERIC(opt1arg_str[OPT1_MSH2_SPEED].option, MSH2_Speed);
 		TEST_OPTION_NUMERIC(opt1arg_str[OPT1_SSH2_SPEED].option, SSH2_Speed);
 		TEST_OPTION_ENABLE(optBarg_str[OPTB_LED], Show_LED);
@@ -693,7 +741,7 @@ Gens_StartupInfo_t* parse_args(int argc, char *argv[])
 		fputs("Arguments not understood.\n", stderr);
 		_usage(argv[0]);
 	}
-	else if (optind == (argc - 1))
+	else if (optind == (argc - 1) && startup->mode != GSM_GYM_TO_WAV)
 	{
 		// Startup ROM.
 		if (argv[optind] && argv[optind][0] != 0x00)
@@ -42,6 +42,7 @@ typedef enum _Gens_StartupMode_t
 #ifdef GENS_CDROM
 	GSM_BOOT_CD = 2,
 #endif
+	GSM_GYM_TO_WAV = 3,
 	GSM_MAX
 } Gens_StartupMode_t;
 
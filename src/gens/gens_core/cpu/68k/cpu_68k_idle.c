@@ -0,0 +1,491 @@
+/**
+ * Idle loop skipping for the Main 68000 and the Sub 68000.
+ *
+ * Most games wait for VBlank in a short loop that polls a RAM flag or the
+ * VDP status register, and the Sega CD BIOS waits for interrupts and
+ * commands from the Main 68000 the same way. Nothing else runs while one
+ * of the 68000s is running, so if the loop didn't exit after seeing the
+ * current memory contents, it won't exit before the end of the timeslice.
+ * The remaining iterations are skipped by adding their cycles to the odometer.
+ */
+
+#include <stdint.h>
+#include "cpu_68k_idle.h"
+#include "star_68k.h"
+
+// Maximum size of an idle loop.
+#define IDLE_LOOP_MAX_INSNS	16
+#define IDLE_LOOP_MAX_BYTES	64
+
+// Maximum number of instructions run while checking an idle loop.
+#define IDLE_PROBE_MAX_STEPS	64
+
+// Allowed non-memory source operands.
+#define IDLE_EA_DN	(1 << 0)	// Data register.
+#define IDLE_EA_IMM	(1 << 1)	// Immediate data.
+
+/**
+ * m68k_idle_cpu_t: A 68000 that can skip idle loops.
+ */
+typedef struct _m68k_idle_cpu_t
+{
+	struct S68000CONTEXT *context;
+	unsigned (*exec)(int n);
+	unsigned (*readOdometer)(void);
+	void (*addCycles)(int cycles);
+	unsigned (*readPC)(void);
+	
+	// Check if a memory read has no side effects.
+	int (*read_ok)(unsigned int address, int size);
+} m68k_idle_cpu_t;
+
+typedef struct _m68k_idle_loop_t
+{
+	unsigned int start;	// Address of the first instruction.
+	unsigned int end;	// Address of the branch back to the first instruction.
+} m68k_idle_loop_t;
+
+typedef struct _m68k_idle_insn_t
+{
+	unsigned int len;	// Length, in bytes.
+	int branch;		// 0 == not a branch; 1 == Bcc; 2 == BRA
+	unsigned int target;	// Branch target.
+	int dn_load;		// Data register loaded with a new value, or -1.
+	int dn_modify;		// Data register modified using its old value, or -1.
+} m68k_idle_insn_t;
+
+// Operand sizes, in bytes.
+static const int m68k_idle_size[4] = {1, 2, 4, 0};
+
+
+/**
+ * m68k_idle_fetch(): Read a word from the program memory map.
+ * @param ctx 68000 context.
+ * @param address Address.
+ * @return Word, or -1 if the address isn't mapped.
+ */
+static int m68k_idle_fetch(const struct S68000CONTEXT *ctx, unsigned int address)
+{
+	const struct STARSCREAM_PROGRAMREGION *region;
+
+	address &= 0xFFFFFF;
+	if (address & 1)
+		return -1;
+
+	// The fetch regions contain byteswapped words.
+	for (region = ctx->fetch; region->lowaddr != (unsigned int)-1; region++)
+	{
+		if (address >= region->lowaddr && address <= region->highaddr)
+			return *(const uint16_t*)(uintptr_t)(region->offset + address);
+	}
+
+	return -1;
+}
+
+
+/**
+ * m68k_idle_read_ok_main(): Check if a Main 68000 memory read has no side effects. (MD mode)
+ * Reading the VDP status register toggles the FIFO bits and clears the
+ * control port latch, but reading it again gives the same results.
+ * @param address Address.
+ * @param size Size, in bytes.
+ * @return Non-zero if the memory can be read.
+ */
+static int m68k_idle_read_ok_main(unsigned int address, int size)
+{
+	// 68000 RAM, including mirrors.
+	if (address >= 0xE00000)
+		return (address + size - 1 <= 0xFFFFFF);
+
+	// VDP status register. (The HV counter depends on the odometer.)
+	if (address >= 0xC00004 && address + size - 1 <= 0xC00007)
+		return 1;
+
+	return 0;
+}
+
+
+/**
+ * m68k_idle_read_ok_sub(): Check if a Sub 68000 memory read has no side effects.
+ * @param address Address.
+ * @param size Size, in bytes.
+ * @return Non-zero if the memory can be read.
+ */
+static int m68k_idle_read_ok_sub(unsigned int address, int size)
+{
+	const unsigned int last = address + size - 1;
+
+	// Program RAM and Word RAM.
+	if (last <= 0x0DFFFF)
+		return 1;
+
+	// Backup RAM.
+	if (address >= 0xFE0000 && last <= 0xFEFFFF)
+		return 1;
+
+	// Gate array registers.
+	// Reading the CDC registers (FF8006-FF8009) advances the CDC,
+	// and the subcode registers (FF8068-) are read from the CD.
+	if (address >= 0xFF8000 && last <= 0xFF8005)
+		return 1;
+	if (address >= 0xFF800A && last <= 0xFF8067)
+		return 1;
+
+	return 0;
+}
+
+
+static const m68k_idle_cpu_t m68k_idle_main =
+{
+	&main68k_context, main68k_exec, main68k_readOdometer,
+	main68k_addCycles, main68k_readPC, m68k_idle_read_ok_main
+};
+
+static const m68k_idle_cpu_t m68k_idle_sub =
+{
+	&sub68k_context, sub68k_exec, sub68k_readOdometer,
+	sub68k_addCycles, sub68k_readPC, m68k_idle_read_ok_sub
+};
+
+
+/**
+ * m68k_idle_ea(): Check a source operand.
+ * Memory operands must be at a fixed address with no read side effects.
+ * @param cpu 68000.
+ * @param addr [in/out] Address of the operand's extension words.
+ * @param ea EA field from the opcode.
+ * @param size Operand size, in bytes.
+ * @param flags Allowed non-memory operands. (IDLE_EA_*)
+ * @return Non-zero if the operand can be used in an idle loop.
+ */
+static int m68k_idle_ea(const m68k_idle_cpu_t *cpu, unsigned int *addr,
+			int ea, int size, int flags)
+{
+	const struct S68000CONTEXT *ctx = cpu->context;
+	unsigned int address;
+	int ext, ext2;
+
+	switch ((ea >> 3) & 7)
+	{
+		case 0:
+			// Dn
+			return (flags & IDLE_EA_DN);
+
+		case 2:
+			// (An)
+			address = ctx->areg[ea & 7];
+			break;
+
+		case 5:
+			// d16(An)
+			ext = m68k_idle_fetch(ctx, *addr);
+			if (ext < 0)
+				return 0;
+			address = ctx->areg[ea & 7] + (int16_t)ext;
+			*addr += 2;
+			break;
+
+		case 7:
+			switch (ea & 7)
+			{
+				case 0:
+					// abs.w
+					ext = m68k_idle_fetch(ctx, *addr);
+					if (ext < 0)
+						return 0;
+					address = (int16_t)ext;
+					*addr += 2;
+					break;
+
+				case 1:
+					// abs.l
+					ext = m68k_idle_fetch(ctx, *addr);
+					ext2 = m68k_idle_fetch(ctx, *addr + 2);
+					if (ext < 0 || ext2 < 0)
+						return 0;
+					address = ((unsigned int)ext << 16) | ext2;
+					*addr += 4;
+					break;
+
+				case 4:
+					// #imm
+					if (!(flags & IDLE_EA_IMM))
+						return 0;
+					*addr += (size == 4 ? 4 : 2);
+					return 1;
+
+				default:
+					// PC-relative modes.
+					return 0;
+			}
+			break;
+
+		default:
+			// An, (An)+, -(An) and d8(An,Xn) aren't allowed.
+			return 0;
+	}
+
+	address &= 0xFFFFFF;
+	if (size > 1 && (address & 1))
+		return 0;
+	return cpu->read_ok(address, size);
+}
+
+
+/**
+ * m68k_idle_decode(): Decode an instruction that might be part of an idle loop.
+ * Only instructions that read memory, test values, and branch are allowed.
+ * @param cpu 68000.
+ * @param addr Address of the instruction.
+ * @param insn Decoded instruction.
+ * @return Length of the instruction, in bytes; 0 if it can't be part of an idle loop.
+ */
+static unsigned int m68k_idle_decode(const m68k_idle_cpu_t *cpu, unsigned int addr,
+				     m68k_idle_insn_t *insn)
+{
+	const struct S68000CONTEXT *ctx = cpu->context;
+	const int op = m68k_idle_fetch(ctx, addr);
+	const int size = m68k_idle_size[(op >> 6) & 3];
+	unsigned int next = addr + 2;
+	int disp;
+
+	if (op < 0)
+		return 0;
+
+	insn->branch = 0;
+	insn->dn_load = -1;
+	insn->dn_modify = -1;
+
+	switch (op >> 12)
+	{
+		case 0x0:
+			if ((op & 0xFF00) == 0x0C00 && size != 0)
+			{
+				// CMPI #imm, <ea>
+				next += (size == 4 ? 4 : 2);
+				if (!m68k_idle_ea(cpu, &next, op & 0x3F, size, IDLE_EA_DN))
+					return 0;
+			}
+			else if ((op & 0xFF38) == 0x0200 && size != 0)
+			{
+				// ANDI #imm, Dn
+				next += (size == 4 ? 4 : 2);
+				insn->dn_modify = (op & 7);
+			}
+			else if ((op & 0xFFC0) == 0x0800)
+			{
+				// BTST #n, <ea>
+				next += 2;
+				if (!m68k_idle_ea(cpu, &next, op & 0x3F, 1, IDLE_EA_DN))
+					return 0;
+			}
+			else if ((op & 0xF1C0) == 0x0100)
+			{
+				// BTST Dn, <ea>
+				if (!m68k_idle_ea(cpu, &next, op & 0x3F, 1, IDLE_EA_DN))
+					return 0;
+			}
+			else
+				return 0;
+			break;
+
+		case 0x1:
+		case 0x2:
+		case 0x3:
+			// MOVE <ea>, Dn
+			if ((op & 0x01C0) != 0)
+				return 0;
+			if (!m68k_idle_ea(cpu, &next, op & 0x3F,
+					  ((op >> 12) == 1 ? 1 : ((op >> 12) == 3 ? 2 : 4)),
+					  IDLE_EA_DN | IDLE_EA_IMM))
+				return 0;
+			insn->dn_load = ((op >> 9) & 7);
+			break;
+
+		case 0x4:
+			// TST <ea>
+			if ((op & 0xFF00) != 0x4A00 || size == 0)
+				return 0;
+			if (!m68k_idle_ea(cpu, &next, op & 0x3F, size, IDLE_EA_DN))
+				return 0;
+			break;
+
+		case 0x6:
+			// Bcc, BRA. (BSR pushes the return address.)
+			if ((op & 0x0F00) == 0x0100)
+				return 0;
+			disp = (int8_t)(op & 0xFF);
+			if (disp == 0)
+			{
+				disp = m68k_idle_fetch(ctx, next);
+				if (disp < 0)
+					return 0;
+				disp = (int16_t)disp;
+				next += 2;
+			}
+			insn->branch = ((op & 0x0F00) == 0 ? 2 : 1);
+			insn->target = addr + 2 + disp;
+			break;
+
+		case 0xB:
+			// CMP <ea>, Dn
+			if ((op & 0x0100) || size == 0)
+				return 0;
+			if (!m68k_idle_ea(cpu, &next, op & 0x3F, size, IDLE_EA_DN | IDLE_EA_IMM))
+				return 0;
+			break;
+
+		case 0xC:
+			// AND <ea>, Dn
+			if ((op & 0x0100) || size == 0)
+				return 0;
+			if (!m68k_idle_ea(cpu, &next, op & 0x3F, size, IDLE_EA_DN | IDLE_EA_IMM))
+				return 0;
+			insn->dn_modify = ((op >> 9) & 7);
+			break;
+
+		default:
+			return 0;
+	}
+
+	insn->len = next - addr;
+	return insn->len;
+}
+
+
+/**
+ * m68k_idle_find_loop(): Check if the 68000 is in an idle loop.
+ * @param cpu 68000.
+ * @param pc Program counter.
+ * @param loop Idle loop.
+ * @return Non-zero if the program counter is in an idle loop.
+ */
+static int m68k_idle_find_loop(const m68k_idle_cpu_t *cpu, unsigned int pc,
+			       m68k_idle_loop_t *loop)
+{
+	m68k_idle_insn_t insn;
+	unsigned int addr = pc;
+	unsigned int loaded = 0;
+	int found_pc = 0;
+	int i;
+
+	// Find the branch back to the start of the loop.
+	for (i = 0; i < IDLE_LOOP_MAX_INSNS; i++)
+	{
+		if (!m68k_idle_decode(cpu, addr, &insn))
+			return 0;
+		if (insn.branch && insn.target <= pc)
+			break;
+		if (insn.branch == 2)
+			return 0;
+		addr += insn.len;
+	}
+	if (i == IDLE_LOOP_MAX_INSNS || addr - insn.target > IDLE_LOOP_MAX_BYTES)
+		return 0;
+
+	loop->start = insn.target;
+	loop->end = addr;
+
+	// Check the whole loop.
+	// Each iteration must do the same thing with the same memory contents,
+	// so a data register can only be modified after it's been loaded.
+	addr = loop->start;
+	for (i = 0; i < IDLE_LOOP_MAX_INSNS; i++)
+	{
+		if (addr == pc)
+			found_pc = 1;
+		if (!m68k_idle_decode(cpu, addr, &insn))
+			return 0;
+		if (addr == loop->end)
+			return found_pc;
+
+		// Other branches must exit the loop.
+		if (insn.branch == 2 ||
+		    (insn.branch && insn.target >= loop->start && insn.target <= loop->end))
+		{
+			return 0;
+		}
+
+		if (insn.dn_modify >= 0 && !(loaded & (1 << insn.dn_modify)))
+			return 0;
+		if (insn.dn_load >= 0)
+			loaded |= (1 << insn.dn_load);
+
+		addr += insn.len;
+		if (addr > loop->end)
+			return 0;
+	}
+
+	return 0;
+}
+
+
+/**
+ * m68k_idle_exec(): Run a 68000 until the odometer reaches the specified value.
+ * If the 68000 is waiting in an idle loop, the remaining loop iterations
+ * are skipped by adding their cycles to the odometer.
+ * @param cpu 68000.
+ * @param odo Odometer value.
+ */
+static void m68k_idle_exec(const m68k_idle_cpu_t *cpu, int odo)
+{
+	m68k_idle_loop_t loop;
+	unsigned int pc = cpu->readPC();
+	int laps, lap_odo, cur, steps;
+
+	if ((int)cpu->readOdometer() >= odo ||
+	    (cpu->context->interrupts[0] & 0x10) ||	// Stopped.
+	    (cpu->context->sr & 0x8000) ||		// Trace mode.
+	    !m68k_idle_find_loop(cpu, pc, &loop))
+	{
+		cpu->exec(odo);
+		return;
+	}
+
+	// Run two complete iterations to make sure the loop doesn't exit
+	// with the current memory contents. Reading the VDP status register
+	// toggles the FIFO bits, so iterations can alternate between two paths.
+	// Pending interrupts are taken by the first instruction.
+	laps = (pc == loop.start ? 0 : -1);
+	lap_odo = cpu->readOdometer();
+	for (steps = 0; steps < IDLE_PROBE_MAX_STEPS; steps++)
+	{
+		cpu->exec(cpu->readOdometer() + 1);
+		cur = cpu->readOdometer();
+		if (cur >= odo)
+			return;
+
+		pc = cpu->readPC();
+		if (pc < loop.start || pc > loop.end)
+			break;
+		if (pc != loop.start)
+			continue;
+
+		if (++laps == 0)
+			lap_odo = cur;
+		else if (laps == 2)
+		{
+			// Skip whole pairs of iterations.
+			// The last few iterations are run normally, so the 68000
+			// leaves the loop with the same PC and odometer as it would
+			// have if every iteration had been run.
+			const int pair = cur - lap_odo;
+			if (pair > 0)
+				cpu->addCycles(((odo - cur) / pair) * pair);
+			break;
+		}
+	}
+
+	cpu->exec(odo);
+}
+
+
+void M68K_Exec_Idle(int odo)
+{
+	m68k_idle_exec(&m68k_idle_main, odo);
+}
+
+void S68K_Exec_Idle(int odo)
+{
+	m68k_idle_exec(&m68k_idle_sub, odo);
+}
@@ -0,0 +1,30 @@
+#ifndef GENS_CPU_68K_IDLE_H
+#define GENS_CPU_68K_IDLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * M68K_Exec_Idle(): Run the Main 68000 until the odometer reaches the specified value.
+ * If the 68000 is waiting in an idle loop, the remaining loop iterations
+ * are skipped by adding their cycles to the odometer.
+ * This may only be used if nothing else can change the memory
+ * read by the 68000 until this function returns. (MD mode)
+ * @param odo Odometer value.
+ */
+void M68K_Exec_Idle(int odo);
+
+/**
+ * S68K_Exec_Idle(): Run the Sub 68000 until the odometer reaches the specified value.
+ * Same as M68K_Exec_Idle(), but for the Sub 68000. The Main 68000
+ * must not run until this function returns.
+ * @param odo Odometer value.
+ */
+void S68K_Exec_Idle(int odo);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GENS_CPU_68K_IDLE_H */
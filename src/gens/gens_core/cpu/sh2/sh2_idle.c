@@ -0,0 +1,609 @@
+/**
+ * Idle loop skipping for the SH2s.
+ *
+ * 32X games usually have one or both SH2s polling the communication
+ * registers, the VDP registers, or a flag in SDRAM while the other CPUs
+ * do the work. The 68000, the SH2s, and PWM run one after another in short
+ * timeslices, so the 68000 and the other SH2 can only write to the memory
+ * read by the loop between calls to SH2_Exec(). 32X interrupts are raised
+ * between timeslices, and the on-chip timers only raise interrupts when
+ * SH2_Exec() returns. If the loop didn't exit after seeing the current
+ * memory contents, it won't exit before the end of the timeslice.
+ *
+ * The remaining iterations are skipped by running the SH2 in the halted
+ * state, which updates the WDT and FRT the same way as running them.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sh2_idle.h"
+
+// SH2 status flags. (from sh2a.asm)
+#define SH2_RUNNING	0x01
+#define SH2_HALTED	0x02
+#define SH2_DISABLE	0x04
+#define SH2_FAULTED	0x10
+
+// Maximum size of an idle loop.
+#define IDLE_LOOP_MAX_INSNS	16
+
+// Maximum number of instructions run while checking an idle loop.
+#define IDLE_PROBE_MAX_STEPS	64
+
+// Register masks. R0-R15 use bits 0-15.
+#define IDLE_REG(n)	(1 << (n))
+#define IDLE_REG_T	(1 << 16)
+
+// GBR-relative memory operand.
+#define IDLE_BASE_GBR	-2
+
+typedef struct _sh2_idle_loop_t
+{
+	uint32_t start;	// Address of the first instruction.
+	uint32_t end;	// Address of the branch back to the first instruction.
+	uint32_t last;	// Address of the last instruction. (The branch's delay slot, if any.)
+} sh2_idle_loop_t;
+
+typedef struct _sh2_idle_insn_t
+{
+	int branch;		// 0 == not a branch; 1 == BT/BF; 2 == BRA
+	int delay;		// Non-zero if the branch has a delay slot.
+	uint32_t target;	// Branch target.
+	int pc_rel;		// Non-zero if the instruction reads PC-relative data.
+
+	uint32_t src;		// Registers read.
+	uint32_t dst;		// Registers written.
+
+	// Register value, if it doesn't depend on memory.
+	int rn;			// Register written, or -1.
+	int known;		// Non-zero if the value is known.
+	uint32_t value;		// Value.
+	int copy;		// If >= 0, the value is copied from this register.
+
+	// Memory read.
+	int mem_size;		// Size, in bytes; 0 if no memory is read.
+	int mem_base;		// Base register, or IDLE_BASE_GBR.
+	uint32_t mem_disp;	// Displacement.
+} sh2_idle_insn_t;
+
+
+/**
+ * sh2_idle_fetch(): Read a word from the program memory map.
+ * @param sh2 SH2 context.
+ * @param address Address.
+ * @return Word, or -1 if the address isn't mapped.
+ */
+static int sh2_idle_fetch(const SH2_CONTEXT *sh2, uint32_t address)
+{
+	const FETCHREG *region;
+	uint16_t word;
+	int i;
+
+	if (address & 1)
+		return -1;
+
+	for (i = 0; i < 0x100; i++)
+	{
+		region = &sh2->Fetch_Region[i];
+		if (region->Fetch_Reg == NULL || region->Fetch_Reg == (uint16_t*)(-1))
+			break;
+
+		if (address >= region->Low_Adr && address <= region->High_Adr)
+		{
+			// The fetch regions contain big-endian words.
+			word = *(const uint16_t*)((uintptr_t)region->Fetch_Reg + address);
+			return ((word >> 8) | (word << 8)) & 0xFFFF;
+		}
+	}
+
+	return -1;
+}
+
+
+/**
+ * sh2_idle_read_ok(): Check if an SH2 memory read has no side effects.
+ * Reading the VDP framebuffer control register toggles the FEN bit,
+ * but reading it again gives the same results.
+ * @param address Address.
+ * @param size Size, in bytes.
+ * @return Non-zero if the memory can be read.
+ */
+static int sh2_idle_read_ok(uint32_t address, int size)
+{
+	uint32_t last;
+
+	if (address & (size - 1))
+		return 0;
+
+	// Cache control and on-chip registers.
+	if (address & 0xC0000000)
+		return 0;
+
+	// Cache-through addresses are mapped the same as cached addresses.
+	address &= ~0x20000000;
+	last = address + size - 1;
+
+	switch (address >> 24)
+	{
+		case 0x04:
+			// Framebuffer.
+		case 0x06:
+			// SDRAM.
+			return 1;
+
+		case 0x00:
+			// 32X system registers.
+			// Reading the DREQ FIFO (4012) removes a word from the FIFO.
+			if (address >= 0x4000 && last <= 0x4011)
+				return 1;
+
+			// Communication registers and PWM.
+			if (address >= 0x4020 && last <= 0x4039)
+				return 1;
+
+			// VDP registers.
+			if (address >= 0x4100 && last <= 0x410B)
+				return 1;
+
+			return 0;
+
+		default:
+			return 0;
+	}
+}
+
+
+/**
+ * sh2_idle_load(): Set up a memory read.
+ * @param insn Decoded instruction.
+ * @param base Base register, or IDLE_BASE_GBR.
+ * @param disp Displacement.
+ * @param size Size, in bytes.
+ */
+static void sh2_idle_load(sh2_idle_insn_t *insn, int base, uint32_t disp, int size)
+{
+	insn->mem_size = size;
+	insn->mem_base = base;
+	insn->mem_disp = disp;
+	if (base >= 0)
+		insn->src |= IDLE_REG(base);
+}
+
+
+/**
+ * sh2_idle_decode(): Decode an instruction that might be part of an idle loop.
+ * Only instructions that read memory, test values, and branch are allowed.
+ * @param sh2 SH2 context.
+ * @param addr Address of the instruction.
+ * @param insn Decoded instruction.
+ * @return Non-zero if the instruction can be part of an idle loop.
+ */
+static int sh2_idle_decode(const SH2_CONTEXT *sh2, uint32_t addr, sh2_idle_insn_t *insn)
+{
+	const int op = sh2_idle_fetch(sh2, addr);
+	const int n = (op >> 8) & 0xF;
+	const int m = (op >> 4) & 0xF;
+	int disp, ext, ext2;
+
+	if (op < 0)
+		return 0;
+
+	insn->branch = 0;
+	insn->delay = 0;
+	insn->pc_rel = 0;
+	insn->src = 0;
+	insn->dst = 0;
+	insn->rn = -1;
+	insn->known = 0;
+	insn->copy = -1;
+	insn->mem_size = 0;
+
+	switch (op >> 12)
+	{
+		case 0x0:
+			// NOP
+			if (op != 0x0009)
+				return 0;
+			break;
+
+		case 0x2:
+			switch (op & 0xF)
+			{
+				case 0x8:
+					// TST Rm, Rn
+					insn->src = IDLE_REG(m) | IDLE_REG(n);
+					insn->dst = IDLE_REG_T;
+					break;
+
+				case 0x9:
+					// AND Rm, Rn
+					insn->src = IDLE_REG(m) | IDLE_REG(n);
+					insn->dst = IDLE_REG(n);
+					break;
+
+				default:
+					return 0;
+			}
+			break;
+
+		case 0x3:
+			switch (op & 0xF)
+			{
+				case 0x0: case 0x2: case 0x3: case 0x6: case 0x7:
+					// CMP/EQ, CMP/HS, CMP/GE, CMP/HI, CMP/GT Rm, Rn
+					insn->src = IDLE_REG(m) | IDLE_REG(n);
+					insn->dst = IDLE_REG_T;
+					break;
+
+				default:
+					return 0;
+			}
+			break;
+
+		case 0x4:
+			switch (op & 0xFF)
+			{
+				case 0x11: case 0x15:
+					// CMP/PZ, CMP/PL Rn
+					insn->src = IDLE_REG(n);
+					insn->dst = IDLE_REG_T;
+					break;
+
+				case 0x00: case 0x01:
+					// SHLL, SHLR Rn
+					insn->src = IDLE_REG(n);
+					insn->dst = IDLE_REG(n) | IDLE_REG_T;
+					break;
+
+				case 0x08: case 0x09: case 0x18: case 0x19: case 0x28: case 0x29:
+					// SHLL2, SHLR2, SHLL8, SHLR8, SHLL16, SHLR16 Rn
+					insn->src = IDLE_REG(n);
+					insn->dst = IDLE_REG(n);
+					break;
+
+				default:
+					return 0;
+			}
+			break;
+
+		case 0x5:
+			// MOV.L @(disp, Rm), Rn
+			sh2_idle_load(insn, m, (op & 0xF) * 4, 4);
+			insn->dst = IDLE_REG(n);
+			break;
+
+		case 0x6:
+			switch (op & 0xF)
+			{
+				case 0x0: case 0x1: case 0x2:
+					// MOV.B, MOV.W, MOV.L @Rm, Rn
+					sh2_idle_load(insn, m, 0, 1 << (op & 3));
+					insn->dst = IDLE_REG(n);
+					break;
+
+				case 0x3:
+					// MOV Rm, Rn
+					insn->src = IDLE_REG(m);
+					insn->dst = IDLE_REG(n);
+					insn->rn = n;
+					insn->copy = m;
+					break;
+
+				case 0xC: case 0xD: case 0xE: case 0xF:
+					// EXTU.B, EXTU.W, EXTS.B, EXTS.W Rm, Rn
+					insn->src = IDLE_REG(m);
+					insn->dst = IDLE_REG(n);
+					break;
+
+				default:
+					return 0;
+			}
+			break;
+
+		case 0x8:
+			switch (n)
+			{
+				case 0x4:
+					// MOV.B @(disp, Rm), R0
+					sh2_idle_load(insn, m, (op & 0xF), 1);
+					insn->dst = IDLE_REG(0);
+					break;
+
+				case 0x5:
+					// MOV.W @(disp, Rm), R0
+					sh2_idle_load(insn, m, (op & 0xF) * 2, 2);
+					insn->dst = IDLE_REG(0);
+					break;
+
+				case 0x8:
+					// CMP/EQ #imm, R0
+					insn->src = IDLE_REG(0);
+					insn->dst = IDLE_REG_T;
+					break;
+
+				case 0x9: case 0xB: case 0xD: case 0xF:
+					// BT, BF, BT/S, BF/S
+					insn->src = IDLE_REG_T;
+					insn->branch = 1;
+					insn->delay = (n & 4);
+					insn->target = addr + 4 + (int8_t)(op & 0xFF) * 2;
+					break;
+
+				default:
+					return 0;
+			}
+			break;
+
+		case 0x9:
+			// MOV.W @(disp, PC), Rn
+			ext = sh2_idle_fetch(sh2, addr + 4 + (op & 0xFF) * 2);
+			if (ext < 0)
+				return 0;
+			insn->pc_rel = 1;
+			insn->dst = IDLE_REG(n);
+			insn->rn = n;
+			insn->known = 1;
+			insn->value = (int16_t)ext;
+			break;
+
+		case 0xA:
+			// BRA
+			disp = (op & 0xFFF);
+			if (disp & 0x800)
+				disp -= 0x1000;
+			insn->branch = 2;
+			insn->delay = 1;
+			insn->target = addr + 4 + disp * 2;
+			break;
+
+		case 0xC:
+			switch (n)
+			{
+				case 0x4: case 0x5: case 0x6:
+					// MOV.B, MOV.W, MOV.L @(disp, GBR), R0
+					sh2_idle_load(insn, IDLE_BASE_GBR, (op & 0xFF) << (n - 4), 1 << (n - 4));
+					insn->dst = IDLE_REG(0);
+					break;
+
+				case 0x8:
+					// TST #imm, R0
+					insn->src = IDLE_REG(0);
+					insn->dst = IDLE_REG_T;
+					break;
+
+				case 0x9:
+					// AND #imm, R0
+					insn->src = IDLE_REG(0);
+					insn->dst = IDLE_REG(0);
+					break;
+
+				default:
+					return 0;
+			}
+			break;
+
+		case 0xD:
+			// MOV.L @(disp, PC), Rn
+			disp = (addr & ~3) + 4 + (op & 0xFF) * 4;
+			ext = sh2_idle_fetch(sh2, disp);
+			ext2 = sh2_idle_fetch(sh2, disp + 2);
+			if (ext < 0 || ext2 < 0)
+				return 0;
+			insn->pc_rel = 1;
+			insn->dst = IDLE_REG(n);
+			insn->rn = n;
+			insn->known = 1;
+			insn->value = ((uint32_t)ext << 16) | ext2;
+			break;
+
+		case 0xE:
+			// MOV #imm, Rn
+			insn->dst = IDLE_REG(n);
+			insn->rn = n;
+			insn->known = 1;
+			insn->value = (int8_t)(op & 0xFF);
+			break;
+
+		default:
+			return 0;
+	}
+
+	return 1;
+}
+
+
+/**
+ * sh2_idle_find_loop(): Check if the SH2 is in an idle loop.
+ * @param sh2 SH2 context.
+ * @param pc Program counter.
+ * @param loop Idle loop.
+ * @return Non-zero if the program counter is in an idle loop.
+ */
+static int sh2_idle_find_loop(const SH2_CONTEXT *sh2, uint32_t pc, sh2_idle_loop_t *loop)
+{
+	sh2_idle_insn_t insn;
+	uint32_t value[16];
+	uint32_t addr = pc;
+	uint32_t written = 0, stable, known, address;
+	int found_pc = 0, in_delay = 0;
+	int i;
+
+	// Find the branch back to the start of the loop.
+	for (i = 0; i < IDLE_LOOP_MAX_INSNS; i++, addr += 2)
+	{
+		if (!sh2_idle_decode(sh2, addr, &insn))
+			return 0;
+		if (insn.branch && insn.target <= pc)
+			break;
+		if (insn.branch == 2)
+			return 0;
+	}
+	if (i == IDLE_LOOP_MAX_INSNS)
+		return 0;
+
+	loop->start = insn.target;
+	loop->end = addr;
+	loop->last = addr + (insn.delay ? 2 : 0);
+	if ((loop->last - loop->start) / 2 >= IDLE_LOOP_MAX_INSNS)
+		return 0;
+
+	// Find the registers written by the loop.
+	for (addr = loop->start; addr <= loop->last; addr += 2)
+	{
+		if (!sh2_idle_decode(sh2, addr, &insn))
+			return 0;
+		written |= insn.dst;
+	}
+
+	// Check the whole loop.
+	// Each iteration must do the same thing with the same memory contents,
+	// so a register written by the loop can only be read after it's been
+	// written in the same iteration. Memory operands need a known address.
+	stable = ~written;
+	known = ~written & 0xFFFF;
+	for (i = 0; i < 16; i++)
+		value[i] = sh2->R[i];
+
+	for (addr = loop->start; addr <= loop->last; addr += 2)
+	{
+		if (addr == pc)
+			found_pc = 1;
+		sh2_idle_decode(sh2, addr, &insn);
+
+		// Branches can't be in delay slots, and other branches must exit the loop.
+		if (insn.branch)
+		{
+			if (in_delay)
+				return 0;
+			if (addr != loop->end &&
+			    (insn.branch == 2 || (insn.target >= loop->start && insn.target <= loop->last)))
+			{
+				return 0;
+			}
+		}
+		else if (in_delay && insn.pc_rel)
+			return 0;
+		in_delay = insn.delay;
+
+		if (insn.src & ~stable)
+			return 0;
+
+		if (insn.mem_size)
+		{
+			if (insn.mem_base == IDLE_BASE_GBR)
+				address = sh2->GBR;
+			else if (known & IDLE_REG(insn.mem_base))
+				address = value[insn.mem_base];
+			else
+				return 0;
+
+			if (!sh2_idle_read_ok(address + insn.mem_disp, insn.mem_size))
+				return 0;
+		}
+
+		if (insn.copy >= 0 && (known & IDLE_REG(insn.copy)))
+		{
+			insn.known = 1;
+			insn.value = value[insn.copy];
+		}
+
+		stable |= insn.dst;
+		known &= ~insn.dst;
+		if (insn.known)
+		{
+			value[insn.rn] = insn.value;
+			known |= IDLE_REG(insn.rn);
+		}
+	}
+
+	return found_pc;
+}
+
+
+/**
+ * sh2_idle_skip(): Skip cycles without running any instructions.
+ * The WDT and FRT are updated as if the SH2 had been running.
+ * @param sh2 SH2 context.
+ * @param cycles Number of cycles to add to the odometer.
+ * @param timer_cycles Number of cycles to add to the timers. (>= cycles)
+ */
+static void sh2_idle_skip(SH2_CONTEXT *sh2, uint32_t cycles, uint32_t timer_cycles)
+{
+	const uint32_t odo = SH2_Read_Odo(sh2);
+
+	if (timer_cycles == 0)
+		return;
+
+	// SH2_Exec() takes pending interrupts before checking if the SH2 is halted,
+	// and the interrupt has to be taken now anyway.
+	if (sh2->INT.Prio > sh2->SR.IMask)
+		return;
+
+	// The halted SH2 only runs the timers.
+	// It stops one cycle short of the odometer value, so the
+	// odometer is set afterwards.
+	sh2->Status |= SH2_HALTED;
+	SH2_Exec(sh2, odo + timer_cycles);
+	sh2->Status &= ~SH2_HALTED;
+	SH2_Write_Odo(sh2, odo + cycles);
+}
+
+
+void SH2_Exec_Idle(SH2_CONTEXT *sh2, uint32_t odo)
+{
+	sh2_idle_loop_t loop;
+	uint32_t pc = SH2_Get_PC(sh2) - 4;	// PC points to the next instruction after the current one.
+	uint32_t start_odo, lap_odo = 0, cur, ran, skip = 0;
+	int laps, steps;
+
+	if ((int)(odo - SH2_Read_Odo(sh2)) <= 0 ||
+	    (sh2->Status & (SH2_HALTED | SH2_DISABLE | SH2_FAULTED)) ||
+	    !sh2_idle_find_loop(sh2, pc, &loop))
+	{
+		SH2_Exec(sh2, odo);
+		return;
+	}
+
+	// Run two complete iterations to make sure the loop doesn't exit
+	// with the current memory contents. Reading the framebuffer control
+	// register toggles the FEN bit, so iterations can alternate between two paths.
+	// Pending interrupts are taken by the first instruction.
+	laps = (pc == loop.start ? 0 : -1);
+	start_odo = SH2_Read_Odo(sh2);
+	for (steps = 1; steps <= IDLE_PROBE_MAX_STEPS; steps++)
+	{
+		SH2_Exec(sh2, SH2_Read_Odo(sh2) + 1);
+		cur = SH2_Read_Odo(sh2);
+		if ((int)(odo - cur) <= 0 || (sh2->Status & SH2_HALTED))
+			break;
+
+		pc = SH2_Get_PC(sh2) - 4;
+		if (pc < loop.start || pc > loop.last)
+			break;
+		if (pc != loop.start)
+			continue;
+
+		if (++laps == 0)
+			lap_odo = cur;
+		else if (laps == 2)
+		{
+			// Skip whole pairs of iterations.
+			// The last few iterations are run normally, so the SH2
+			// leaves the loop with the same PC and odometer as it would
+			// have if every iteration had been run.
+			const uint32_t pair = cur - lap_odo;
+			if (pair > 0)
+				skip = ((odo - cur) / pair) * pair;
+			break;
+		}
+	}
+
+	// The timers only advance by the number of cycles requested,
+	// so single-stepping loses the extra cycles used by each instruction.
+	if (steps > IDLE_PROBE_MAX_STEPS)
+		steps = IDLE_PROBE_MAX_STEPS;
+	ran = SH2_Read_Odo(sh2) - start_odo;
+	sh2_idle_skip(sh2, skip, skip + (ran > (uint32_t)steps ? ran - steps : 0));
+
+	SH2_Exec(sh2, odo);
+}
@@ -0,0 +1,25 @@
+#ifndef GENS_SH2_IDLE_H
+#define GENS_SH2_IDLE_H
+
+#include "sh2.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * SH2_Exec_Idle(): Run an SH2 until the odometer reaches the specified value.
+ * If the SH2 is waiting in an idle loop, the remaining loop iterations
+ * are skipped. The on-chip timers are updated as if the SH2 had run them.
+ * This may only be used if nothing else can change the memory
+ * read by the SH2 until this function returns.
+ * @param sh2 SH2 context.
+ * @param odo Odometer value.
+ */
+void SH2_Exec_Idle(SH2_CONTEXT *sh2, uint32_t odo);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GENS_SH2_IDLE_H */
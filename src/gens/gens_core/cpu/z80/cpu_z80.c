@@ -2,6 +2,7 @@
 #include <string.h>
 #include "mdZ80/mdZ80.h"
 #include "cpu_z80.h"
+#include "gens_core/cpu/68k/star_68k.h"
 #include "gens_core/mem/mem_m68k.h"
 #include "gens_core/mem/mem_z80.h"
 
@@ -71,6 +72,27 @@ int Z80_Init(void)
 }
 
 
+/**
+ * Z80_Catch_Up(): Bring the Z80 up to the Main 68000's current position in the line.
+ * If the Z80 is running, it runs until that point. Otherwise, only its
+ * odometer is moved. Call this before the Main 68000 changes Z80_State.
+ */
+void Z80_Catch_Up(void)
+{
+	int cycles = Cycles_M68K - (int)main68k_readOdometer();
+	if (cycles < 0)
+		cycles = 0;
+	else if (cycles > 511)
+		cycles = 511;
+	
+	const int odo = Cycles_Z80 - Z80_M68K_Cycle_Tab[cycles];
+	if (Z80_State == (Z80_STATE_ENABLED | Z80_STATE_BUSREQ))
+		z80_Exec(&M_Z80, odo);
+	else
+		mdZ80_set_odo(&M_Z80, odo);
+}
+
+
 /** Stub functions for SegaCD debugging. **/
 
 #include "segacd/cd_sys.hpp"
@@ -7,6 +7,7 @@ extern "C" {
 
 int Z80_Init(void);
 void Z80_Reset(void);
+void Z80_Catch_Up(void);
 
 /** Stub functions for SegaCD debugging. **/
 void Write_To_Bank(int val);
@@ -0,0 +1,477 @@
+/**
+ * Idle loop skipping for the Z80.
+ *
+ * Sound drivers spend most of their time in short loops that poll the
+ * YM2612 timer flags or a command byte written to Z80 RAM by the 68000.
+ * The Z80 runs after the 68000 in each line, and the YM2612 timers are only
+ * updated between lines, so if the loop didn't exit after seeing the current
+ * memory contents, it won't exit before the end of the timeslice.
+ * The remaining iterations are skipped by adding their cycles to the odometer.
+ */
+
+#include <stdint.h>
+#include "cpu_z80_idle.h"
+#include "mdZ80/mdZ80.h"
+#include "mdZ80/mdZ80_flags.h"
+#include "gens_core/mem/mem_m68k.h"
+#include "gens_core/mem/mem_z80.h"
+
+// Set if Z80_EXEC() should skip Z80 idle loops.
+int Z80_Idle_Skip = 0;
+
+// Maximum size of an idle loop.
+#define IDLE_LOOP_MAX_INSNS	16
+#define IDLE_LOOP_MAX_BYTES	64
+
+// Maximum number of instructions run while checking an idle loop.
+#define IDLE_PROBE_MAX_STEPS	64
+
+// Registers.
+#define IDLE_REG_A	(1 << 0)
+#define IDLE_REG_F	(1 << 1)
+#define IDLE_REG_B	(1 << 2)
+#define IDLE_REG_C	(1 << 3)
+#define IDLE_REG_D	(1 << 4)
+#define IDLE_REG_E	(1 << 5)
+#define IDLE_REG_H	(1 << 6)
+#define IDLE_REG_L	(1 << 7)
+#define IDLE_REG_IX	(3 << 8)
+#define IDLE_REG_IY	(3 << 10)
+
+typedef struct _z80_idle_loop_t
+{
+	unsigned int start;	// Address of the first instruction.
+	unsigned int end;	// Address of the branch back to the first instruction.
+} z80_idle_loop_t;
+
+typedef struct _z80_idle_insn_t
+{
+	unsigned int len;	// Length, in bytes.
+	int branch;		// 0 == not a branch; 1 == conditional; 2 == JR/JP
+	unsigned int target;	// Branch target.
+	unsigned int reads;	// Registers read. (IDLE_REG_*)
+	unsigned int writes;	// Registers written. (IDLE_REG_*)
+	unsigned int addr_regs;	// Registers used to address memory. (IDLE_REG_*)
+} z80_idle_insn_t;
+
+// Registers, in opcode order. (B, C, D, E, H, L, (HL), A)
+static const unsigned int z80_idle_reg[8] =
+{
+	IDLE_REG_B, IDLE_REG_C, IDLE_REG_D, IDLE_REG_E,
+	IDLE_REG_H, IDLE_REG_L, 0, IDLE_REG_A
+};
+
+
+/**
+ * z80_idle_fetch(): Read a byte from the program memory map.
+ * @param address Address.
+ * @return Byte, or -1 if the address isn't in Z80 RAM.
+ */
+static int z80_idle_fetch(unsigned int address)
+{
+	address &= 0xFFFF;
+	if (address >= 0x4000)
+		return -1;
+	return Ram_Z80[address & 0x1FFF];
+}
+
+
+/**
+ * z80_idle_read_ok(): Check if a Z80 memory read has no side effects.
+ * The YM2612 status only changes when the YM2612 timers are updated,
+ * and 68000 memory can't change while the Z80 is running.
+ * @param address Address.
+ * @return Non-zero if the memory can be read.
+ */
+static int z80_idle_read_ok(unsigned int address)
+{
+	unsigned int m68k_address;
+
+	address &= 0xFFFF;
+
+	// Z80 RAM and the YM2612.
+	if (address < 0x6000)
+		return 1;
+
+	// Bank register, PSG, and VDP.
+	if (address < 0x8000)
+		return 0;
+
+	// 68000 ROM and RAM.
+	m68k_address = (Bank_Z80 + (address & 0x7FFF)) & 0xFFFFFF;
+	return (m68k_address < 0x400000 || m68k_address >= 0xE00000);
+}
+
+
+/**
+ * z80_idle_decode(): Decode an instruction that might be part of an idle loop.
+ * Only instructions that read memory, test values, and branch are allowed.
+ * @param addr Address of the instruction.
+ * @param insn Decoded instruction.
+ * @return Length of the instruction, in bytes; 0 if it can't be part of an idle loop.
+ */
+static unsigned int z80_idle_decode(unsigned int addr, z80_idle_insn_t *insn)
+{
+	const int op = z80_idle_fetch(addr);
+	unsigned int next = addr + 1;
+	unsigned int mem = 0;
+	int has_mem = 0;
+	int ext, ext2, r;
+
+	if (op < 0)
+		return 0;
+
+	insn->branch = 0;
+	insn->reads = 0;
+	insn->writes = 0;
+	insn->addr_regs = 0;
+
+	if (op >= 0x40 && op <= 0x7F)
+	{
+		// LD r, r'
+		if (op == 0x76 || (op & 0x38) == 0x30)
+			return 0;	// HALT; LD (HL), r
+		r = (op & 7);
+		if (r == 6)
+		{
+			mem = M_Z80.HL.w.HL;
+			has_mem = 1;
+			insn->addr_regs = IDLE_REG_H | IDLE_REG_L;
+		}
+		else
+			insn->reads = z80_idle_reg[r];
+		insn->writes = z80_idle_reg[(op >> 3) & 7];
+	}
+	else if (op >= 0x80 && op <= 0xBF)
+	{
+		// ALU A, r
+		r = (op & 7);
+		if (r == 6)
+		{
+			mem = M_Z80.HL.w.HL;
+			has_mem = 1;
+			insn->addr_regs = IDLE_REG_H | IDLE_REG_L;
+		}
+		else
+			insn->reads = z80_idle_reg[r];
+		insn->reads |= IDLE_REG_A;
+		if ((op & 0x30) == 0x10)
+			insn->reads |= IDLE_REG_F;	// ADC, SBC
+		insn->writes = IDLE_REG_F;
+		if ((op & 0x38) != 0x38)
+			insn->writes |= IDLE_REG_A;	// Not CP.
+	}
+	else if ((op & 0xC7) == 0xC6)
+	{
+		// ALU A, n
+		next++;
+		insn->reads = IDLE_REG_A;
+		if ((op & 0x30) == 0x10)
+			insn->reads |= IDLE_REG_F;	// ADC, SBC
+		insn->writes = IDLE_REG_F;
+		if ((op & 0x38) != 0x38)
+			insn->writes |= IDLE_REG_A;	// Not CP.
+	}
+	else if ((op & 0xC6) == 0x04 && (op & 0x38) != 0x30)
+	{
+		// INC r, DEC r
+		insn->reads = z80_idle_reg[(op >> 3) & 7];
+		insn->writes = insn->reads | IDLE_REG_F;
+	}
+	else if ((op & 0xC7) == 0x06 && (op & 0x38) != 0x30)
+	{
+		// LD r, n
+		next++;
+		insn->writes = z80_idle_reg[(op >> 3) & 7];
+	}
+	else
+	{
+		switch (op)
+		{
+			case 0x00:
+				// NOP
+				break;
+
+			case 0x07: case 0x0F: case 0x2F:
+				// RLCA, RRCA, CPL
+				insn->reads = IDLE_REG_A;
+				insn->writes = IDLE_REG_A | IDLE_REG_F;
+				break;
+
+			case 0x17: case 0x1F:
+				// RLA, RRA
+				insn->reads = IDLE_REG_A | IDLE_REG_F;
+				insn->writes = IDLE_REG_A | IDLE_REG_F;
+				break;
+
+			case 0x37:
+				// SCF
+				insn->writes = IDLE_REG_F;
+				break;
+
+			case 0x3F:
+				// CCF
+				insn->reads = IDLE_REG_F;
+				insn->writes = IDLE_REG_F;
+				break;
+
+			case 0x0A:
+				// LD A, (BC)
+				mem = M_Z80.BC.w.BC;
+				has_mem = 1;
+				insn->addr_regs = IDLE_REG_B | IDLE_REG_C;
+				insn->writes = IDLE_REG_A;
+				break;
+
+			case 0x1A:
+				// LD A, (DE)
+				mem = M_Z80.DE.w.DE;
+				has_mem = 1;
+				insn->addr_regs = IDLE_REG_D | IDLE_REG_E;
+				insn->writes = IDLE_REG_A;
+				break;
+
+			case 0x3A:
+				// LD A, (nn)
+				ext = z80_idle_fetch(next);
+				ext2 = z80_idle_fetch(next + 1);
+				if (ext < 0 || ext2 < 0)
+					return 0;
+				mem = (ext | (ext2 << 8));
+				has_mem = 1;
+				next += 2;
+				insn->writes = IDLE_REG_A;
+				break;
+
+			case 0xCB:
+				// BIT b, r
+				ext = z80_idle_fetch(next);
+				if (ext < 0x40 || ext > 0x7F)
+					return 0;
+				next++;
+				r = (ext & 7);
+				if (r == 6)
+				{
+					mem = M_Z80.HL.w.HL;
+					has_mem = 1;
+					insn->addr_regs = IDLE_REG_H | IDLE_REG_L;
+				}
+				else
+					insn->reads = z80_idle_reg[r];
+				insn->writes = IDLE_REG_F;
+				break;
+
+			case 0xDD:
+			case 0xFD:
+				// LD r, (IX+d); ALU A, (IX+d); BIT b, (IX+d)
+				mem = (op == 0xDD ? M_Z80.IX.w.IX : M_Z80.IY.w.IY);
+				insn->addr_regs = (op == 0xDD ? IDLE_REG_IX : IDLE_REG_IY);
+				ext = z80_idle_fetch(next);
+				ext2 = z80_idle_fetch(next + 1);
+				if (ext < 0 || ext2 < 0)
+					return 0;
+				mem += (int8_t)ext2;
+				has_mem = 1;
+				next += 2;
+
+				if ((ext & 0xC7) == 0x46 && ext != 0x76)
+				{
+					// LD r, (IX+d)
+					insn->writes = z80_idle_reg[(ext >> 3) & 7];
+				}
+				else if ((ext & 0xC7) == 0x86)
+				{
+					// ALU A, (IX+d)
+					insn->reads = IDLE_REG_A;
+					if ((ext & 0x30) == 0x10)
+						insn->reads |= IDLE_REG_F;	// ADC, SBC
+					insn->writes = IDLE_REG_F;
+					if ((ext & 0x38) != 0x38)
+						insn->writes |= IDLE_REG_A;	// Not CP.
+				}
+				else if (ext == 0xCB)
+				{
+					// BIT b, (IX+d)
+					ext = z80_idle_fetch(next);
+					if (ext < 0 || (ext & 0xC7) != 0x46)
+						return 0;
+					next++;
+					insn->writes = IDLE_REG_F;
+				}
+				else
+					return 0;
+				break;
+
+			case 0x10:
+				// DJNZ e
+				insn->reads = IDLE_REG_B;
+				insn->writes = IDLE_REG_B;
+				/* fall through */
+			case 0x18: case 0x20: case 0x28: case 0x30: case 0x38:
+				// JR e, JR cc, e
+				ext = z80_idle_fetch(next);
+				if (ext < 0)
+					return 0;
+				next++;
+				insn->branch = (op == 0x18 ? 2 : 1);
+				insn->target = (next + (int8_t)ext) & 0xFFFF;
+				if (op >= 0x20)
+					insn->reads = IDLE_REG_F;
+				break;
+
+			case 0xC3:
+			case 0xC2: case 0xCA: case 0xD2: case 0xDA:
+			case 0xE2: case 0xEA: case 0xF2: case 0xFA:
+				// JP nn, JP cc, nn
+				ext = z80_idle_fetch(next);
+				ext2 = z80_idle_fetch(next + 1);
+				if (ext < 0 || ext2 < 0)
+					return 0;
+				next += 2;
+				insn->branch = (op == 0xC3 ? 2 : 1);
+				insn->target = (ext | (ext2 << 8));
+				if (op != 0xC3)
+					insn->reads = IDLE_REG_F;
+				break;
+
+			default:
+				return 0;
+		}
+	}
+
+	if (has_mem && !z80_idle_read_ok(mem))
+		return 0;
+
+	insn->len = next - addr;
+	return insn->len;
+}
+
+
+/**
+ * z80_idle_find_loop(): Check if the Z80 is in an idle loop.
+ * @param pc Program counter.
+ * @param loop Idle loop.
+ * @return Non-zero if the program counter is in an idle loop.
+ */
+static int z80_idle_find_loop(unsigned int pc, z80_idle_loop_t *loop)
+{
+	z80_idle_insn_t insn;
+	unsigned int addr = pc;
+	unsigned int written = 0;
+	unsigned int loaded = 0;
+	int found_pc = 0;
+	int i;
+
+	// Find the branch back to the start of the loop.
+	for (i = 0; i < IDLE_LOOP_MAX_INSNS; i++)
+	{
+		if (!z80_idle_decode(addr, &insn))
+			return 0;
+		if (insn.branch && insn.target <= pc)
+			break;
+		if (insn.branch == 2)
+			return 0;
+		addr += insn.len;
+	}
+	if (i == IDLE_LOOP_MAX_INSNS || addr - insn.target > IDLE_LOOP_MAX_BYTES)
+		return 0;
+
+	loop->start = insn.target;
+	loop->end = addr;
+
+	// Find the registers written by the loop.
+	// Other branches must exit the loop.
+	addr = loop->start;
+	for (i = 0; i < IDLE_LOOP_MAX_INSNS; i++)
+	{
+		if (addr == pc)
+			found_pc = 1;
+		if (!z80_idle_decode(addr, &insn))
+			return 0;
+		written |= insn.writes;
+		if (addr == loop->end)
+			break;
+
+		if (insn.branch == 2 ||
+		    (insn.branch && insn.target >= loop->start && insn.target <= loop->end))
+		{
+			return 0;
+		}
+
+		addr += insn.len;
+		if (addr > loop->end)
+			return 0;
+	}
+	if (i == IDLE_LOOP_MAX_INSNS || !found_pc)
+		return 0;
+
+	// Each iteration must do the same thing with the same memory contents,
+	// so a register written by the loop can only be read after it's been
+	// written in the same iteration, and memory addresses must not change.
+	for (addr = loop->start; addr <= loop->end; addr += insn.len)
+	{
+		z80_idle_decode(addr, &insn);
+		if ((insn.reads & written & ~loaded) || (insn.addr_regs & written))
+			return 0;
+		loaded |= insn.writes;
+	}
+
+	return 1;
+}
+
+
+/**
+ * Z80_Exec_Idle(): Run the Z80 until the odometer reaches the specified value.
+ * If the Z80 is waiting in an idle loop, the remaining loop iterations
+ * are skipped by adding their cycles to the odometer.
+ * @param odo Odometer value.
+ */
+void Z80_Exec_Idle(int odo)
+{
+	z80_idle_loop_t loop;
+	unsigned int pc = mdZ80_get_PC(&M_Z80);
+	int laps, lap_odo, cur, steps;
+
+	if ((int)mdZ80_read_odo(&M_Z80) >= odo ||
+	    (M_Z80.Status & (Z80_STATE_HALTED | Z80_STATE_FAULTED)) ||
+	    !z80_idle_find_loop(pc, &loop))
+	{
+		z80_Exec(&M_Z80, odo);
+		return;
+	}
+
+	// Run two complete iterations to make sure the loop doesn't exit
+	// with the current memory contents.
+	// Pending interrupts are taken by the first instruction.
+	laps = (pc == loop.start ? 0 : -1);
+	lap_odo = mdZ80_read_odo(&M_Z80);
+	for (steps = 0; steps < IDLE_PROBE_MAX_STEPS; steps++)
+	{
+		z80_Exec(&M_Z80, mdZ80_read_odo(&M_Z80) + 1);
+		cur = mdZ80_read_odo(&M_Z80);
+		if (cur >= odo)
+			return;
+
+		pc = mdZ80_get_PC(&M_Z80);
+		if (pc < loop.start || pc > loop.end)
+			break;
+		if (pc != loop.start)
+			continue;
+
+		if (++laps == 0)
+			lap_odo = cur;
+		else if (laps == 2)
+		{
+			// Skip whole pairs of iterations.
+			// The last few iterations are run normally, so the Z80
+			// leaves the loop with the same PC and odometer as it would
+			// have if every iteration had been run.
+			const int pair = cur - lap_odo;
+			if (pair > 0)
+				mdZ80_add_cycles(&M_Z80, ((odo - cur) / pair) * pair);
+			break;
+		}
+	}
+
+	z80_Exec(&M_Z80, odo);
+}
@@ -0,0 +1,25 @@
+#ifndef GENS_CPU_Z80_IDLE_H
+#define GENS_CPU_Z80_IDLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Set if Z80_EXEC() should skip Z80 idle loops.
+extern int Z80_Idle_Skip;
+
+/**
+ * Z80_Exec_Idle(): Run the Z80 until the odometer reaches the specified value.
+ * If the Z80 is waiting in an idle loop, the remaining loop iterations
+ * are skipped by adding their cycles to the odometer.
+ * This may only be used if nothing else can change the memory
+ * read by the Z80 until this function returns.
+ * @param odo Odometer value.
+ */
+void Z80_Exec_Idle(int odo);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GENS_CPU_Z80_IDLE_H */
@@ -286,6 +286,7 @@ section .text align=64
 	
 	extern SYM(main68k_readOdometer)
 	extern SYM(mdZ80_reset)
+	extern SYM(Z80_Catch_Up)
 	extern z80_Exec
 	extern SYM(mdZ80_set_odo)
 	
@@ -1303,13 +1304,19 @@ section .text align=64
 	
 	.no_busreq:
 		cmp	ebx, 0xA11200
-		jne	short .no_reset_z80
+		jne	near .no_reset_z80
 		
 		test	al, 1
 		jnz	short .no_reset
 		
 		push	edx
 		
+		; Run the Z80 up to the point where it's reset.
+		test	byte [SYM(Z80_State)], Z80_STATE_RESET
+		jnz	short .reset_z80
+		call	SYM(Z80_Catch_Up)
+	
+	.reset_z80:
 		push	SYM(M_Z80)
 		call	SYM(mdZ80_reset)
 		add	esp, 4
@@ -1322,7 +1329,16 @@ section .text align=64
 		ret
 	
 	.no_reset:
+		test	byte [SYM(Z80_State)], Z80_STATE_RESET
+		jz	short .no_reset_change
+		
+		; The Z80 starts running from the current position in the line.
+		push	edx
+		call	SYM(Z80_Catch_Up)
+		pop	edx
 		and	byte [SYM(Z80_State)], ~Z80_STATE_RESET
+	
+	.no_reset_change:
 		pop	ecx
 		pop	ebx
 		ret
@@ -1920,13 +1936,19 @@ section .text align=64
 	
 	.no_busreq:
 		cmp	ebx, 0xA11200
-		jne	short .no_reset_z80
+		jne	near .no_reset_z80
 		
 		test	ah, 1
 		jnz	short .no_reset
 		
 		push	edx
 		
+		; Run the Z80 up to the point where it's reset.
+		test	byte [SYM(Z80_State)], Z80_STATE_RESET
+		jnz	short .reset_z80
+		call	SYM(Z80_Catch_Up)
+	
+	.reset_z80:
 		push	SYM(M_Z80)
 		call	SYM(mdZ80_reset)
 		add	esp, 4
@@ -1939,7 +1961,16 @@ section .text align=64
 		ret
 	
 	.no_reset:
+		test	byte [SYM(Z80_State)], Z80_STATE_RESET
+		jz	short .no_reset_change
+		
+		; The Z80 starts running from the current position in the line.
+		push	edx
+		call	SYM(Z80_Catch_Up)
+		pop	edx
 		and	byte [SYM(Z80_State)], ~Z80_STATE_RESET
+	
+	.no_reset_change:
 		pop	ecx
 		pop	ebx
 		ret
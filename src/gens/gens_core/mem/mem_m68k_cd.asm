@@ -24,6 +24,20 @@
 
 %define CYCLE_FOR_TAKE_Z80_BUS_SEGACD 32
 
+; MCD_SYNC_TOUCH: A shared gate array register was accessed.
+; If the adaptive sync loop is running this CPU in a large timeslice,
+; end the timeslice so the other CPU can catch up. (eax is preserved.)
+; %1: releaseTimeslice function for this CPU.
+%macro MCD_SYNC_TOUCH 1
+	mov	byte [SYM(MCD_Sync_Touch)], 1
+	cmp	byte [SYM(MCD_Sync_Release)], 0
+	je	short %%no_release
+	push	eax
+	call	SYM(%1)
+	pop	eax
+%%no_release:
+%endmacro
+
 section .bss align=64
 	
 	extern SYM(Ram_Prg)
@@ -83,6 +97,14 @@ section .bss align=64
 	SYM(Cycles_S68K):
 		resd 1
 	
+	; Adaptive main/sub 68000 synchronization.
+	global SYM(MCD_Sync_Touch)
+	SYM(MCD_Sync_Touch):
+		resd 1
+	global SYM(MCD_Sync_Release)
+	SYM(MCD_Sync_Release):
+		resd 1
+	
 	global SYM(Ram_Backup_Ex)
 	SYM(Ram_Backup_Ex):
 		resb 512 * 1024
@@ -234,9 +256,11 @@ section .text align=64
 	extern SYM(M68K_Set_Prg_Ram)
 	
 	extern SYM(main68k_readOdometer)
+	extern SYM(main68k_releaseTimeslice)
 	extern SYM(sub68k_reset)
 	extern SYM(sub68k_interrupt)
 	extern SYM(mdZ80_reset)
+	extern SYM(Z80_Catch_Up)
 	extern z80_Exec
 	extern SYM(mdZ80_set_odo)
 	
@@ -537,6 +561,7 @@ section .text align=64
 		cmp	ebx, 0xA1202F
 		ja	short .bad
 		
+		MCD_SYNC_TOUCH main68k_releaseTimeslice
 		and	ebx, 0x3F
 		jmp	[.Table_Extended_IO + ebx * 4]
 	
@@ -999,6 +1024,7 @@ section .text align=64
 		cmp	ebx, 0xA1202F
 		ja	short .bad
 		
+		MCD_SYNC_TOUCH main68k_releaseTimeslice
 		and	ebx, 0x3E
 		jmp	[.Table_Extended_IO + ebx * 2]
 	
@@ -1336,13 +1362,19 @@ section .text align=64
 	
 	.no_busreq:
 		cmp	ebx, 0xA11200
-		jne	short .no_reset_z80
+		jne	near .no_reset_z80
 		
 		test	al, 1
 		jnz	short .no_reset
 		
 		push	edx
 		
+		; Run the Z80 up to the point where it's reset.
+		test	byte [SYM(Z80_State)], Z80_STATE_RESET
+		jnz	short .reset_z80
+		call	SYM(Z80_Catch_Up)
+	
+	.reset_z80:
 		push	SYM(M_Z80)
 		call	SYM(mdZ80_reset)
 		add	esp, byte 4
@@ -1355,7 +1387,16 @@ section .text align=64
 		ret
 	
 	.no_reset:
+		test	byte [SYM(Z80_State)], Z80_STATE_RESET
+		jz	short .no_reset_change
+		
+		; The Z80 starts running from the current position in the line.
+		push	edx
+		call	SYM(Z80_Catch_Up)
+		pop	edx
 		and	byte [SYM(Z80_State)], ~Z80_STATE_RESET
+	
+	.no_reset_change:
 		pop	ecx
 		pop	ebx
 		ret
@@ -1419,6 +1460,7 @@ section .text align=64
 		cmp	ebx, 0xA1202F
 		ja	near M68K_Write_Bad
 		
+		MCD_SYNC_TOUCH main68k_releaseTimeslice
 		and	ebx, 0x3F
 		jmp	[.Table_Extended_IO + ebx * 4]
 	
@@ -1874,13 +1916,19 @@ section .text align=64
 	
 	.no_busreq:
 		cmp	ebx, 0xA11200
-		jne	short .no_reset_z80
+		jne	near .no_reset_z80
 		
 		test	ah, 1
 		jnz	short .no_reset
 		
 		push	edx
 		
+		; Run the Z80 up to the point where it's reset.
+		test	byte [SYM(Z80_State)], Z80_STATE_RESET
+		jnz	short .reset_z80
+		call	SYM(Z80_Catch_Up)
+	
+	.reset_z80:
 		push	SYM(M_Z80)
 		call	SYM(mdZ80_reset)
 		add	esp, byte 4
@@ -1893,7 +1941,16 @@ section .text align=64
 		ret
 	
 	.no_reset:
+		test	byte [SYM(Z80_State)], Z80_STATE_RESET
+		jz	short .no_reset_change
+		
+		; The Z80 starts running from the current position in the line.
+		push	edx
+		call	SYM(Z80_Catch_Up)
+		pop	edx
 		and	byte [SYM(Z80_State)], ~Z80_STATE_RESET
+	
+	.no_reset_change:
 		pop	ecx
 		pop	ebx
 		ret
@@ -1964,6 +2021,7 @@ section .text align=64
 		cmp	ebx, 0xA1202F
 		ja	short .bad
 		
+		MCD_SYNC_TOUCH main68k_releaseTimeslice
 		and	ebx, byte 0x3E
 		jmp	[.Table_Extended_IO + ebx * 2]
 	
@@ -34,6 +34,12 @@ extern int S68K_State;
 extern int CPL_S68K;
 extern int Cycles_S68K;
 
+// Adaptive main/sub 68000 synchronization.
+// MCD_Sync_Touch is set when either 68000 accesses a shared gate array register.
+// If MCD_Sync_Release is set, the access also ends the 68000's timeslice.
+extern int MCD_Sync_Touch;
+extern int MCD_Sync_Release;
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,28 @@
 
 %include "mdp/mdp_nasm_x86.inc"
 
+; MCD_SYNC_TOUCH: A shared gate array register was accessed.
+; If the adaptive sync loop is running this CPU in a large timeslice,
+; end the timeslice so the other CPU can catch up. (eax is preserved.)
+; Only the memory mode and communication registers are shared.
+; ebx: Register number.
+%macro MCD_SYNC_TOUCH 0
+	cmp	ebx, byte 0x03
+	jbe	short %%touch
+	cmp	ebx, byte 0x0E
+	jb	short %%done
+	cmp	ebx, byte 0x2F
+	ja	short %%done
+%%touch:
+	mov	byte [SYM(MCD_Sync_Touch)], 1
+	cmp	byte [SYM(MCD_Sync_Release)], 0
+	je	short %%done
+	push	eax
+	call	SYM(sub68k_releaseTimeslice)
+	pop	eax
+%%done:
+%endmacro
+
 section .bss align=64
 	
 	extern Ram_68k
@@ -293,6 +315,9 @@ section .text align=64
 	extern _SCD_Read_Word
 	extern _Check_CD_Command
 	extern SYM(Read_CDC_Host_SUB)
+	extern SYM(sub68k_releaseTimeslice)
+	extern SYM(MCD_Sync_Touch)
+	extern SYM(MCD_Sync_Release)
 	extern _MS68K_Set_Word_Ram
 	
 	; Symbol redefines for ELF.
@@ -453,6 +478,7 @@ section .text align=64
 		ja	near .Subcode_Buffer
 		
 		and	ebx, byte 0x7F
+		MCD_SYNC_TOUCH
 		jmp	[.Table_S68K_Reg + ebx * 4]
 	
 	align 16
@@ -1337,6 +1363,7 @@ section .text align=64
 		ja	near .Subcode_Buffer
 		
 		and	ebx, byte 0x7E
+		MCD_SYNC_TOUCH
 		jmp	[.Table_S68K_Reg + ebx * 2]
 	
 	align 16
@@ -2249,6 +2276,7 @@ section .text align=64
 		ja	near .Subcode_Buffer
 		
 		and	ebx, byte 0x7F
+		MCD_SYNC_TOUCH
 		jmp	[.Table_S68K_Reg + ebx * 4]
 	
 	align 16
@@ -3129,6 +3157,7 @@ section .text align=64
 		ja	near .Subcode_Buffer
 		
 		and	ebx, byte 0x7E
+		MCD_SYNC_TOUCH
 		jmp	[.Table_S68K_Reg + ebx * 2]
 	
 	align 16
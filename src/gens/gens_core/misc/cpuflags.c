@@ -51,6 +51,16 @@
 #define CPUFLAG_IA32_ECX_SSSE3		((uint32_t)(1 << 9))
 #define CPUFLAG_IA32_ECX_SSE41		((uint32_t)(1 << 19))
 #define CPUFLAG_IA32_ECX_SSE42		((uint32_t)(1 << 20))
+#define CPUFLAG_IA32_ECX_OSXSAVE	((uint32_t)(1 << 27))
+#define CPUFLAG_IA32_ECX_AVX		((uint32_t)(1 << 28))
+
+// CPUID function 7: Structured Extended Features
+
+// Flags stored in the ebx register.
+#define CPUFLAG_IA32_FN7_EBX_AVX2	((uint32_t)(1 << 5))
+
+// XCR0: SSE and AVX state are saved by the OS.
+#define IA32_XCR0_SSE_AVX		((uint32_t)(0x06))
 
 // CPUID function 0x80000001: Extended Family & Features
 
@@ -65,6 +75,7 @@
 // CPUID functions.
 #define CPUID_MAX_FUNCTIONS		((uint32_t)(0x00000000))
 #define CPUID_FAMILY_FEATURES		((uint32_t)(0x00000001))
+#define CPUID_STRUCT_EXT_FEATURES	((uint32_t)(0x00000007))
 #define CPUID_MAX_EXT_FUNCTIONS		((uint32_t)(0x80000000))
 #define CPUID_EXT_FAMILY_FEATURES	((uint32_t)(0x80000001))
 
@@ -88,6 +99,25 @@
 		)
 #endif
 
+// CPUID macro with a subleaf. (ecx input)
+#if defined(__i386__) && defined(__PIC__)
+#define __cpuid_count(level, count, a, b, c, d)			\
+	__asm__ (						\
+		"xchgl	%%ebx, %1\n"				\
+		"cpuid\n"					\
+		"xchgl	%%ebx, %1\n"				\
+		: "=a" (a), "=r" (b), "=c" (c), "=d" (d)	\
+		: "0" (level), "2" (count)			\
+		)
+#else
+#define __cpuid_count(level, count, a, b, c, d)			\
+	__asm__ (						\
+		"cpuid\n"					\
+		: "=a" (a), "=b" (b), "=c" (c), "=d" (d)	\
+		: "0" (level), "2" (count)			\
+		)
+#endif
+
 // CPU flags.
 uint32_t CPU_Flags = 0;
 
@@ -211,6 +241,30 @@ uint32_t getCPUFlags(void)
 			CPU_Flags |= MDP_CPUFLAG_X86_SSE41;
 		if (_ecx & CPUFLAG_IA32_ECX_SSE42)
 			CPU_Flags |= MDP_CPUFLAG_X86_SSE42;
+		
+		// AVX requires OS support for saving the YMM registers.
+		if ((_ecx & CPUFLAG_IA32_ECX_OSXSAVE) && (_ecx & CPUFLAG_IA32_ECX_AVX))
+		{
+			unsigned int xcr0_lo, xcr0_hi;
+			__asm__ (
+				"xgetbv\n"
+				: "=a" (xcr0_lo), "=d" (xcr0_hi)
+				: "c" (0)
+				);
+			
+			if ((xcr0_lo & IA32_XCR0_SSE_AVX) == IA32_XCR0_SSE_AVX)
+			{
+				CPU_Flags |= MDP_CPUFLAG_X86_AVX;
+				
+				// Check for AVX2.
+				if (maxFunc >= CPUID_STRUCT_EXT_FEATURES)
+				{
+					__cpuid_count(CPUID_STRUCT_EXT_FEATURES, 0, _eax, _ebx, _ecx, _edx);
+					if (_ebx & CPUFLAG_IA32_FN7_EBX_AVX2)
+						CPU_Flags |= MDP_CPUFLAG_X86_AVX2;
+				}
+			}
+		}
 	}
 	
 	// Check if the CPUID Extended Features function (Function 0x80000001) is supported.
@@ -312,6 +312,9 @@ void Print_Text(const char *str, int Pos_X, int Pos_Y, int Style)
 					&Text_Palette_32[palette_num][0],
 					Pos_X, Pos_Y, Style);
 	}
+	
+	// The text rows have changed.
+	VDP_Dirty_Lines_Mark(Pos_Y, 7);
 }
 
 
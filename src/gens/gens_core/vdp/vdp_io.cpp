@@ -119,6 +119,7 @@ void VDP_Reset(void)
 {
 	// Clear MD_Screen.
 	memset(&MD_Screen, 0x00, sizeof(MD_Screen));
+	VDP_Dirty_Lines_Mark_All();
 	
 	// Clear VRam, CRam, and VSRam.
 	// (This also clears the VSRam overflow area.)
@@ -32,6 +32,7 @@
 
 // C includes.
 #include <stdint.h>
+#include <string.h>
 
 // Palettes.
 Palette_t Palette;
@@ -39,6 +40,9 @@ MD_Palette_t MD_Palette;
 // Screen buffer.
 Screen_t MD_Screen;
 
+// Dirty lines in MD_Screen.
+uint8_t VDP_Dirty_Lines[240];
+
 // VDP layer control.
 // TODO: Figure out 32X and Mode 4 layer assignments.
 unsigned int VDP_Layers = VDP_LAYER_DEFAULT;
@@ -152,6 +156,35 @@ void VDP_Update_Palette_HS(void)
 }
 
 
+/**
+ * VDP_Dirty_Lines_Mark(): Mark rows of MD_Screen as dirty.
+ * Used by code that draws directly to MD_Screen outside of the line renderer.
+ * @param first First row.
+ * @param count Number of rows.
+ */
+void VDP_Dirty_Lines_Mark(int first, int count)
+{
+	if (first < 0)
+	{
+		count += first;
+		first = 0;
+	}
+	if (first + count > 240)
+		count = 240 - first;
+	if (count > 0)
+		memset(&VDP_Dirty_Lines[first], 1, count);
+}
+
+
+/**
+ * VDP_Dirty_Lines_Mark_All(): Mark all rows of MD_Screen as dirty.
+ */
+void VDP_Dirty_Lines_Mark_All(void)
+{
+	memset(VDP_Dirty_Lines, 1, sizeof(VDP_Dirty_Lines));
+}
+
+
 /**
  * VDP_Render_Line(): Render a line.
  */
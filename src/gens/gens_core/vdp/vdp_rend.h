@@ -53,6 +53,12 @@ typedef union
 } Screen_t;
 extern Screen_t MD_Screen;
 
+// Dirty lines in MD_Screen. (one byte per row)
+// Nonzero if the row changed since the dirty line map was last cleared.
+extern uint8_t VDP_Dirty_Lines[240];
+void VDP_Dirty_Lines_Mark(int first, int count);
+void VDP_Dirty_Lines_Mark_All(void);
+
 // Sprite structs.
 typedef struct
 {
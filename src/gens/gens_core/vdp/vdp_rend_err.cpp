@@ -434,6 +434,9 @@ void VDP_Render_Error(void)
 		
 		// Force a palette update.
 		VDP_Flags.CRam = 1;
+		
+		// The whole screen has been redrawn.
+		VDP_Dirty_Lines_Mark_All();
 	}
 	
 	// Check if the palette was modified.
@@ -452,6 +455,7 @@ void VDP_Render_Error(void)
 				T_DrawColorBars_Border<uint16_t>(MD_Screen.u16, MD_Palette.u16[0]);
 			else //if (bppMD == 32)
 				T_DrawColorBars_Border<uint32_t>(MD_Screen.u32, MD_Palette.u32[0]);
+			VDP_Dirty_Lines_Mark_All();
 		}
 	}
 }
@@ -64,6 +64,16 @@ IntRend_Mode_t VDP_IntRend_Mode = INTREND_FLICKER;
 static unsigned int Y_FineOffset;
 static unsigned int TotalSprites;
 
+// Line output buffer.
+// Lines are rendered here and then compared with MD_Screen
+// so the renderers can skip lines that didn't change.
+typedef union
+{
+	uint16_t u16[320];
+	uint32_t u32[320];
+} LineOut_t;
+static LineOut_t LineOut;
+
 
 /**
  * T_VDP_m5_GetLineNumber(): Get the current line number, adjusted for interlaced display.
@@ -1412,6 +1422,52 @@ static FORCE_INLINE void T_Render_LineBuf(pixel *dest, pixel *md_palette)
 }
 
 
+/**
+ * T_Commit_Line(): Copy a rendered line to MD_Screen.
+ * If the line is different from what's already in MD_Screen,
+ * the row is marked as dirty.
+ * @param pixel Type of pixel.
+ * @param dest Start of the row in MD_Screen.
+ * @param line Rendered line. (same layout as dest)
+ * @param row Row number.
+ * @param start First pixel to copy.
+ * @param count Number of pixels to copy.
+ */
+template<typename pixel>
+static FORCE_INLINE void T_Commit_Line(pixel *dest, const pixel *line, int row,
+				       unsigned int start, unsigned int count)
+{
+	if (memcmp(&dest[start], &line[start], count * sizeof(pixel)) != 0)
+	{
+		memcpy(&dest[start], &line[start], count * sizeof(pixel));
+		VDP_Dirty_Lines[row] = 1;
+	}
+}
+
+
+/**
+ * T_Clear_Line(): Clear part of a row in MD_Screen.
+ * If the row wasn't already clear, it's marked as dirty.
+ * @param pixel Type of pixel.
+ * @param dest Start of the row in MD_Screen.
+ * @param row Row number.
+ * @param count Number of pixels to clear.
+ */
+template<typename pixel>
+static FORCE_INLINE void T_Clear_Line(pixel *dest, int row, unsigned int count)
+{
+	for (unsigned int i = 0; i < count; i++)
+	{
+		if (dest[i] != 0)
+		{
+			memset(dest, 0x00, count * sizeof(pixel));
+			VDP_Dirty_Lines[row] = 1;
+			return;
+		}
+	}
+}
+
+
 /**
  * VDP_Render_Line_m5(): Render a line. (Mode 5)
  */
@@ -1449,7 +1505,8 @@ void VDP_Render_Line_m5(void)
 		if (LineStart < 0)
 			LineStart += 240;
 	}
-	LineStart = TAB336[LineStart + VDP_Lines.Visible.Border_Size] + 8;
+	const int LineRow = LineStart + VDP_Lines.Visible.Border_Size;
+	LineStart = TAB336[LineRow] + 8;
 	
 	if (in_border && !Video.borderColorEmulation)
 	{
@@ -1457,9 +1514,9 @@ void VDP_Render_Line_m5(void)
 		// Clear the border area.
 		// TODO: Only clear this if the option changes or V/H mode changes.
 		if (bppMD == 32)
-			memset(&MD_Screen.u32[LineStart], 0x00, 320*sizeof(uint32_t));
+			T_Clear_Line<uint32_t>(&MD_Screen.u32[LineStart], LineRow, 320);
 		else
-			memset(&MD_Screen.u16[LineStart], 0x00, 320*sizeof(uint16_t));
+			T_Clear_Line<uint16_t>(&MD_Screen.u16[LineStart], LineRow, 320);
 		
 		// ...and we're done here.
 		return;
@@ -1562,9 +1619,15 @@ void VDP_Render_Line_m5(void)
 	
 	// Render the image.
 	if (bppMD != 32)
-		T_Render_LineBuf<uint16_t>(&MD_Screen.u16[LineStart], MD_Palette.u16);
+	{
+		T_Render_LineBuf<uint16_t>(LineOut.u16, MD_Palette.u16);
+		T_Commit_Line<uint16_t>(&MD_Screen.u16[LineStart], LineOut.u16, LineRow, 0, 320);
+	}
 	else
-		T_Render_LineBuf<uint32_t>(&MD_Screen.u32[LineStart], MD_Palette.u32);
+	{
+		T_Render_LineBuf<uint32_t>(LineOut.u32, MD_Palette.u32);
+		T_Commit_Line<uint32_t>(&MD_Screen.u32[LineStart], LineOut.u32, LineRow, 0, 320);
+	}
 }
 
 
@@ -1803,7 +1866,8 @@ void VDP_Render_Line_m5_32X(void)
 		if (LineStart < 0)
 			LineStart += 240;
 	}
-	LineStart = TAB336[LineStart + VDP_Lines.Visible.Border_Size] + 8;
+	const int LineRow = LineStart + VDP_Lines.Visible.Border_Size;
+	LineStart = TAB336[LineRow] + 8;
 	
 	if (in_border && !Video.borderColorEmulation)
 	{
@@ -1811,9 +1875,9 @@ void VDP_Render_Line_m5_32X(void)
 		// Clear the border area.
 		// TODO: Only clear this if the option changes or V/H mode changes.
 		if (bppMD == 32)
-			memset(&MD_Screen.u32[LineStart], 0x00, VDP_Reg.H_Pix*sizeof(uint32_t));
+			T_Clear_Line<uint32_t>(&MD_Screen.u32[LineStart], LineRow, VDP_Reg.H_Pix);
 		else
-			memset(&MD_Screen.u16[LineStart], 0x00, VDP_Reg.H_Pix*sizeof(uint16_t));
+			T_Clear_Line<uint16_t>(&MD_Screen.u16[LineStart], LineRow, VDP_Reg.H_Pix);
 		
 		// ...and we're done here.
 		return;
@@ -1902,27 +1966,38 @@ void VDP_Render_Line_m5_32X(void)
 	int _32X_Rend_Mode = (eax | ((edx >> 2) & 0xFF));
 	
 	// Render the 32X line.
+	// NOTE: The 32X line renderer only writes the active display area.
 	if (!in_border)
 	{
 		if (bppMD != 32)
 		{
 			T_Render_LineBuf_32X<uint16_t>
-						(&MD_Screen.u16[LineStart], MD_Palette.u16,
+						(LineOut.u16, MD_Palette.u16,
 						_32X_Rend_Mode, _32X_Palette.u16, _32X_VDP_CRam_Adjusted.u16);
+			T_Commit_Line<uint16_t>(&MD_Screen.u16[LineStart], LineOut.u16, LineRow,
+						VDP_Reg.H_Pix_Begin, VDP_Reg.H_Pix);
 		}
 		else
 		{
 			T_Render_LineBuf_32X<uint32_t>
-						(&MD_Screen.u32[LineStart], MD_Palette.u32,
+						(LineOut.u32, MD_Palette.u32,
 						_32X_Rend_Mode, _32X_Palette.u32, _32X_VDP_CRam_Adjusted.u32);
+			T_Commit_Line<uint32_t>(&MD_Screen.u32[LineStart], LineOut.u32, LineRow,
+						VDP_Reg.H_Pix_Begin, VDP_Reg.H_Pix);
 		}
 	}
 	else
 	{
 		// In border. Use standard MD rendering.
 		if (bppMD != 32)
-			T_Render_LineBuf<uint16_t>(&MD_Screen.u16[LineStart], MD_Palette.u16);
+		{
+			T_Render_LineBuf<uint16_t>(LineOut.u16, MD_Palette.u16);
+			T_Commit_Line<uint16_t>(&MD_Screen.u16[LineStart], LineOut.u16, LineRow, 0, 320);
+		}
 		else
-			T_Render_LineBuf<uint32_t>(&MD_Screen.u32[LineStart], MD_Palette.u32);
+		{
+			T_Render_LineBuf<uint32_t>(LineOut.u32, MD_Palette.u32);
+			T_Commit_Line<uint32_t>(&MD_Screen.u32[LineStart], LineOut.u32, LineRow, 0, 320);
+		}
 	}
 }
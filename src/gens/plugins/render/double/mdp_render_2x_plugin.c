@@ -51,7 +51,9 @@ mdp_render_t mdp_render_2x_render_t =
 	.scale = 2,
 	.flags = MDP_RENDER_FLAG_RGB_555to555 |
 		 MDP_RENDER_FLAG_RGB_565to565 |
-		 MDP_RENDER_FLAG_RGB_888to888
+		 MDP_RENDER_FLAG_RGB_888to888 |
+		 MDP_RENDER_FLAG_BAND_SAFE |
+		 MDP_RENDER_FLAG_DIRTY_LINES
 };
 
 static mdp_func_t mdp_func =
@@ -64,7 +66,7 @@ mdp_t mdp_render_2x =
 {
 	// Plugin version information.
 	.interfaceVersion = MDP_VERSION(1, 0, 0),
-	.pluginVersion = MDP_VERSION(1, 0, 0),
+	.pluginVersion = MDP_VERSION(1, 1, 0),
 	
 	// CPU flags.
 #ifdef GENS_X86_ASM
@@ -33,6 +33,7 @@
 #include "mdp/mdp_stdint.h"
 #include "mdp/mdp_cpuflags.h"
 #include "mdp/mdp_error.h"
+#include "mdp/mdp_render_dirty.h"
 
 // x86 asm versions.
 #ifdef GENS_X86_ASM
@@ -108,7 +109,12 @@ static inline void T_mdp_render_1x_cpp(pixel *destScreen, pixel *mdScreen,
 #endif /* GENS_X86_ASM */
 
 
-int MDP_FNCALL mdp_render_1x_cpp(const mdp_render_info_t *render_info)
+/**
+ * mdp_render_1x_band(): Render a band of the image.
+ * @param render_info Render information.
+ * @return MDP error code.
+ */
+static int MDP_FNCALL mdp_render_1x_band(const mdp_render_info_t *render_info)
 {
 	if (!render_info)
 		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
@@ -184,3 +190,13 @@ int MDP_FNCALL mdp_render_1x_cpp(const mdp_render_info_t *render_info)
 	
 	return MDP_ERR_OK;
 }
+
+
+int MDP_FNCALL mdp_render_1x_cpp(const mdp_render_info_t *render_info)
+{
+	if (!render_info)
+		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
+	
+	// Only render the lines that changed.
+	return mdp_render_dirty_blit(render_info, 1, 0, mdp_render_1x_band);
+}
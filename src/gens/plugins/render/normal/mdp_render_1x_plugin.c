@@ -51,7 +51,8 @@ mdp_render_t mdp_render_1x_render_t =
 	.scale = 1,
 	.flags = MDP_RENDER_FLAG_RGB_555to555 |
 		 MDP_RENDER_FLAG_RGB_565to565 |
-		 MDP_RENDER_FLAG_RGB_888to888
+		 MDP_RENDER_FLAG_RGB_888to888 |
+		 MDP_RENDER_FLAG_DIRTY_LINES
 };
 
 static mdp_func_t mdp_func =
@@ -64,7 +65,7 @@ mdp_t mdp_render_1x =
 {
 	// Plugin version information.
 	.interfaceVersion = MDP_VERSION(1, 0, 0),
-	.pluginVersion = MDP_VERSION(1, 0, 1),
+	.pluginVersion = MDP_VERSION(1, 1, 0),
 	
 	// CPU flags.
 #ifdef GENS_X86_ASM
@@ -41,6 +41,7 @@ const dir_entry_t dir_window_entries[DIR_WINDOW_ENTRIES_COUNT + 1] =
 	{"BRAM Backup",	BRAM_Dir},
 	{"WAV Dump",	PathNames.Dump_WAV_Dir},
 	{"GYM Dump",	PathNames.Dump_GYM_Dir},
+	{"AVI Dump",	PathNames.Dump_AVI_Dir},
 	{"Screenshots",	PathNames.Screenshot_Dir},
 	{NULL, NULL}
 };
@@ -35,7 +35,7 @@ typedef struct _dir_entry_t
 } dir_entry_t;
 
 // TODO: Make the number of directory entries dynamic.
-#define DIR_WINDOW_ENTRIES_COUNT 6
+#define DIR_WINDOW_ENTRIES_COUNT 7
 extern const dir_entry_t dir_window_entries[DIR_WINDOW_ENTRIES_COUNT + 1];
 
 #ifdef __cplusplus
@@ -168,6 +168,7 @@ extern const GensMenuItem_t gmiMain[];
 #define IDM_GRAPHICS_COLORADJUST	(IDM_GRAPHICS_MENU + 6)
 #define IDM_GRAPHICS_SPRITELIMIT	(IDM_GRAPHICS_MENU + 7)
 #define IDM_GRAPHICS_SCREENSHOT		(IDM_GRAPHICS_MENU + 8)
+#define IDM_GRAPHICS_AVIDUMP		(IDM_GRAPHICS_MENU + 9)
 
 #define IDM_GRAPHICS_STRETCH		0x2100
 #define IDM_GRAPHICS_STRETCH_NONE	(IDM_GRAPHICS_STRETCH + 1)
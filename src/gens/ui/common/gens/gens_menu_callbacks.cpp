@@ -63,6 +63,9 @@
 
 #include "util/sound/wave.h"
 #include "util/sound/gym.hpp"
+#ifdef GENS_ZLIB
+#include "util/video/avi.hpp"
+#endif
 
 #include "util/file/rom.hpp"
 #include "gens_core/vdp/vdp_io.h"
@@ -463,6 +466,16 @@ static int gens_menu_callback_GraphicsMenu(uint16_t menuID, uint16_t state)
 			ImageUtil::ScreenShot();
 			break;
 		
+#ifdef GENS_ZLIB
+		case IDM_GRAPHICS_AVIDUMP:
+			// Change AVI dump status.
+			if (!AVI_Dumping)
+				avi_dump_start();
+			else
+				avi_dump_stop();
+			break;
+#endif /* GENS_ZLIB */
+		
 		default:
 			switch (menuID & 0xFF00)
 			{
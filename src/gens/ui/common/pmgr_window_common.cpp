@@ -62,7 +62,8 @@ string GetCPUFlags_string(const uint32_t cpuFlagsRequired,
 	{
 		"MMX", "MMXEXT", "3DNOW", "3DNOWEXT",
 		"SSE", "SSE2", "SSE3", "SSSE3",
-		"SSE4.1", "SSE4.2", "SSE4A",
+		"SSE4.1", "SSE4.2", "SSE4A", "AVX",
+		"AVX2",
 		
 		NULL
 	};
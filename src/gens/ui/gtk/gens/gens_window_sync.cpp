@@ -61,6 +61,9 @@ using std::deque;
 
 #include "util/sound/wave.h"
 #include "util/sound/gym.hpp"
+#ifdef GENS_ZLIB
+#include "util/video/avi.hpp"
+#endif
 
 #include "gens_core/vdp/vdp_io.h"
 #include "gens_core/vdp/vdp_rend.h"
@@ -285,6 +288,14 @@ void Sync_Gens_Window_GraphicsMenu(void)
 	// Screenshot
 	gtk_widget_set_sensitive(gens_menu_find_item(IDM_GRAPHICS_SCREENSHOT), (Game != NULL));
 	
+#ifdef GENS_ZLIB
+	// AVI dumping
+	GtkWidget *mnuAVIDump = gens_menu_find_item(IDM_GRAPHICS_AVIDUMP);
+	gtk_label_set_text(GTK_LABEL(gtk_bin_get_child(GTK_BIN(mnuAVIDump))),
+			   (AVI_Dumping ? "Stop AVI Dump" : "Start AVI Dump"));
+	gtk_widget_set_sensitive(mnuAVIDump, (Game != NULL));
+#endif /* GENS_ZLIB */
+	
 	// Backend
 	Sync_Gens_Window_GraphicsMenu_Backend(gens_menu_find_item(IDM_GRAPHICS_BACKEND));
 	
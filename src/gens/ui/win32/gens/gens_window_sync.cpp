@@ -41,6 +41,9 @@
 
 #include "util/sound/wave.h"
 #include "util/sound/gym.hpp"
+#ifdef GENS_ZLIB
+#include "util/video/avi.hpp"
+#endif
 
 #include "gens_core/vdp/vdp_io.h"
 #include "gens_core/vdp/vdp_rend.h"
@@ -308,6 +311,15 @@ void Sync_Gens_Window_GraphicsMenu(void)
 	// Screenshot
 	EnableMenuItem(mnuGraphics, IDM_GRAPHICS_SCREENSHOT,
 			MF_BYCOMMAND | ((Game != NULL) ? MF_ENABLED : MF_GRAYED));
+	
+#ifdef GENS_ZLIB
+	// AVI dumping.
+	pModifyMenuU(mnuGraphics, IDM_GRAPHICS_AVIDUMP,
+			MF_BYCOMMAND | MF_STRING,
+			IDM_GRAPHICS_AVIDUMP, (AVI_Dumping ? "Stop AVI Dump" : "Start AVI Dump"));
+	EnableMenuItem(mnuGraphics, IDM_GRAPHICS_AVIDUMP,
+			MF_BYCOMMAND | ((Game != NULL) ? MF_ENABLED : MF_GRAYED));
+#endif /* GENS_ZLIB */
 }
 
 
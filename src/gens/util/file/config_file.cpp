@@ -96,6 +96,8 @@ using std::string;
 
 // Video, Audio, Input.
 #include "video/vdraw.h"
+#include "video/vdraw_mt.h"
+#include "video/vdraw_present.h"
 #include "audio/audio.h"
 #include "input/input.h"
 
@@ -148,6 +150,7 @@ int Config::save(const string& filename)
 	cfg.writeString("Directories", "BRAM Path", BRAM_Dir);
 	cfg.writeString("Directories", "Dump WAV Path", PathNames.Dump_WAV_Dir);
 	cfg.writeString("Directories", "Dump GYM Path", PathNames.Dump_GYM_Dir);
+	cfg.writeString("Directories", "Dump AVI Path", PathNames.Dump_AVI_Dir);
 	cfg.writeString("Directories", "Screenshot Path", PathNames.Screenshot_Dir);
 	
 	// Plugin directories.
@@ -284,6 +287,8 @@ int Config::save(const string& filename)
 #endif /* GENS_OS_WIN32 */
 	cfg.writeInt("Graphics", "Sprite Limit", Sprite_Over & 1);
 	cfg.writeInt("Graphics", "Frame Skip", Frame_Skip);
+	cfg.writeInt("Graphics", "Render Threads", vdraw_mt_get_threads());
+	cfg.writeBool("Graphics", "Threaded Presentation", vdraw_present_get_enabled());
 	
 	// Sound settings.
 	cfg.writeBool("Sound", "State", audio_get_enabled());
@@ -309,6 +314,9 @@ int Config::save(const string& filename)
 	
 	// CPU options.
 	cfg.writeInt("CPU", "Perfect synchro between main and sub CPU (Sega CD)", SegaCD_Accurate);
+	cfg.writeInt("CPU", "Adaptive synchro between main and sub CPU (Sega CD)", SegaCD_Adaptive_Sync);
+	cfg.writeBool("CPU", "Idle Loop Skipping", Idle_Loop_Skip);
+	cfg.writeString("CPU", "Idle Loop Skipping Disabled", Idle_Loop_Skip_Disable);
 	cfg.writeInt("CPU", "Main SH2 Speed", MSH2_Speed);
 	cfg.writeInt("CPU", "Slave SH2 Speed", SSH2_Speed);
 	
@@ -456,6 +464,7 @@ int Config::load(const string& filename, void* gameActive)
 	cfg.getString("Directories", "BRAM Path", PathNames.Gens_Save_Path, BRAM_Dir, sizeof(BRAM_Dir));
 	cfg.getString("Directories", "Dump WAV Path", PathNames.Gens_Save_Path, PathNames.Dump_WAV_Dir, sizeof(PathNames.Dump_WAV_Dir));
 	cfg.getString("Directories", "Dump GYM Path", PathNames.Gens_Save_Path, PathNames.Dump_GYM_Dir, sizeof(PathNames.Dump_GYM_Dir));
+	cfg.getString("Directories", "Dump AVI Path", PathNames.Gens_Save_Path, PathNames.Dump_AVI_Dir, sizeof(PathNames.Dump_AVI_Dir));
 	cfg.getString("Directories", "Screenshot Path", PathNames.Gens_Save_Path, PathNames.Screenshot_Dir, sizeof(PathNames.Screenshot_Dir));
 	
 	// Plugin directories.
@@ -638,6 +647,8 @@ int Config::load(const string& filename, void* gameActive)
 #endif /* GENS_OS_WIN32 */
 	Sprite_Over = cfg.getInt("Graphics", "Sprite Limit", 1);
 	Frame_Skip = cfg.getInt("Graphics", "Frame Skip", -1);
+	vdraw_mt_set_threads(cfg.getInt("Graphics", "Render Threads", 0));
+	vdraw_present_set_enabled(cfg.getBool("Graphics", "Threaded Presentation", true));
 	
 	// Sound settings.
 	audio_set_sound_rate(cfg.getInt("Sound", "Rate", 22050));
@@ -670,6 +681,10 @@ int Config::load(const string& filename, void* gameActive)
 	
 	// CPU options.
 	SegaCD_Accurate = cfg.getInt("CPU", "Perfect synchro between main and sub CPU (Sega CD)", 0);
+	SegaCD_Adaptive_Sync = cfg.getInt("CPU", "Adaptive synchro between main and sub CPU (Sega CD)", 1);
+	Idle_Loop_Skip = cfg.getBool("CPU", "Idle Loop Skipping", true);
+	cfg.getString("CPU", "Idle Loop Skipping Disabled", "",
+			Idle_Loop_Skip_Disable, sizeof(Idle_Loop_Skip_Disable));
 	MSH2_Speed = cfg.getInt("CPU", "Main SH2 Speed", 100);
 	SSH2_Speed = cfg.getInt("CPU", "Slave SH2 Speed", 100);
 	
@@ -72,6 +72,9 @@ using std::deque;
 
 #include "util/sound/wave.h"
 #include "util/sound/gym.hpp"
+#ifdef GENS_ZLIB
+#include "util/video/avi.hpp"
+#endif
 
 // libgsft includes.
 #include "libgsft/gsft_byteswap.h"
@@ -1057,6 +1060,12 @@ void ROM::freeROM(ROM_t* ROM_MD)
 		wav_dump_stop();
 	if (GYM_Dumping)
 		gym_dump_stop();
+	
+	// Video dumping.
+#ifdef GENS_ZLIB
+	if (AVI_Dumping)
+		avi_dump_stop();
+#endif
 
 	if (SegaCD_Started)
 		Stop_CD();
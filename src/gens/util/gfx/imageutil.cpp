@@ -39,6 +39,16 @@
 #include <string.h>
 #include <unistd.h>
 
+// C++ includes.
+#include <deque>
+using std::deque;
+
+// SSE2 row conversion.
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define IMAGEUTIL_SSE2
+#endif
+
 #include "emulator/g_main.hpp"
 #include "util/file/rom.hpp"
 #include "gens_core/vdp/vdp_io.h"
@@ -48,7 +58,9 @@
 // libgsft includes.
 #include "libgsft/gsft_byteswap.h"
 #include "libgsft/gsft_file.h"
+#include "libgsft/gsft_strlcpy.h"
 #include "libgsft/gsft_szprintf.h"
+#include "libgsft/gsft_thread.h"
 
 // File management functions.
 #include "util/file/file.hpp"
@@ -213,7 +225,7 @@ int ImageUtil::WriteBMP(FILE *fImg, const int w, const int h, const int pitch,
 
 #ifdef GENS_PNG
 /**
- * T_writePNG_rows_16(): Write 16-bit PNG rows.
+ * T_convertRow_RGB24(): Convert a row of pixels to 24-bit RGB.
  * @param pixel Typename.
  * @param maskR Red mask.
  * @param maskG Green mask.
@@ -221,22 +233,134 @@ int ImageUtil::WriteBMP(FILE *fImg, const int w, const int h, const int pitch,
  * @param shiftR Red shift. (Right)
  * @param shiftG Green shift. (Right)
  * @param shiftB Blue shift. (Left)
+ * @param screen Pointer to the source row.
+ * @param rowOut Buffer for the RGB row. (Must have 16 bytes of slack.)
+ * @param width Width of the row.
+ */
+template<typename pixel,
+	 const pixel maskR, const pixel maskG, const pixel maskB,
+	 const unsigned int shiftR, const unsigned int shiftG, const unsigned int shiftB>
+static inline void T_convertRow_RGB24(const pixel *screen, uint8_t *rowOut, int width)
+{
+	for (; width > 0; width--)
+	{
+		pixel MD_Color = *screen++;
+		*rowOut++ = (uint8_t)((MD_Color & maskR) >> shiftR);
+		*rowOut++ = (uint8_t)((MD_Color & maskG) >> shiftG);
+		*rowOut++ = (uint8_t)((MD_Color & maskB) << shiftB);
+	}
+}
+
+
+#ifdef IMAGEUTIL_SSE2
+/**
+ * sse2_pack_RGB24(): Pack four 0x00BBGGRR pixels into 12 bytes of RGB.
+ * @param v Four 32-bit pixels.
+ * @return Packed pixels in bytes 0-11.
+ */
+static inline __m128i sse2_pack_RGB24(__m128i v)
+{
+	const __m128i mask0 = _mm_set_epi32(0, 0, 0, 0x00FFFFFF);
+	const __m128i mask1 = _mm_slli_si128(mask0, 4);
+	const __m128i mask2 = _mm_slli_si128(mask0, 8);
+	const __m128i mask3 = _mm_slli_si128(mask0, 12);
+	
+	__m128i out = _mm_and_si128(v, mask0);
+	out = _mm_or_si128(out, _mm_srli_si128(_mm_and_si128(v, mask1), 1));
+	out = _mm_or_si128(out, _mm_srli_si128(_mm_and_si128(v, mask2), 2));
+	out = _mm_or_si128(out, _mm_srli_si128(_mm_and_si128(v, mask3), 3));
+	return out;
+}
+
+
+/**
+ * T_convertRow_RGB24_sse2(): Convert a row of 15/16-bit pixels to 24-bit RGB. (SSE2)
+ * Eight pixels are converted per iteration.
+ */
+template<const uint16_t maskR, const uint16_t maskG, const uint16_t maskB,
+	 const unsigned int shiftR, const unsigned int shiftG, const unsigned int shiftB>
+static inline void T_convertRow_RGB24_sse2(const uint16_t *screen, uint8_t *rowOut, int width)
+{
+	const __m128i vMaskR = _mm_set1_epi16((short)maskR);
+	const __m128i vMaskG = _mm_set1_epi16((short)maskG);
+	const __m128i vMaskB = _mm_set1_epi16((short)maskB);
+	
+	for (; width >= 8; width -= 8)
+	{
+		__m128i px = _mm_loadu_si128((const __m128i*)screen);
+		__m128i r = _mm_srli_epi16(_mm_and_si128(px, vMaskR), shiftR);
+		__m128i g = _mm_srli_epi16(_mm_and_si128(px, vMaskG), shiftG);
+		__m128i b = _mm_slli_epi16(_mm_and_si128(px, vMaskB), shiftB);
+		
+		// 16-bit lanes: GGRR and 00BB.
+		__m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+		
+		_mm_storeu_si128((__m128i*)rowOut, sse2_pack_RGB24(_mm_unpacklo_epi16(rg, b)));
+		_mm_storeu_si128((__m128i*)(rowOut + 12), sse2_pack_RGB24(_mm_unpackhi_epi16(rg, b)));
+		
+		screen += 8;
+		rowOut += 24;
+	}
+	
+	// Remaining pixels.
+	T_convertRow_RGB24<uint16_t, maskR, maskG, maskB, shiftR, shiftG, shiftB>(screen, rowOut, width);
+}
+#endif /* IMAGEUTIL_SSE2 */
+
+
+/**
+ * convertRow32_RGB24(): Convert a row of 32-bit pixels to 24-bit RGB.
+ * @param screen Pointer to the source row.
+ * @param rowOut Buffer for the RGB row. (Must have 16 bytes of slack.)
+ * @param width Width of the row.
+ */
+static inline void convertRow32_RGB24(const uint32_t *screen, uint8_t *rowOut, int width)
+{
+#ifdef IMAGEUTIL_SSE2
+	const __m128i vMaskG = _mm_set1_epi32(MASK_GREEN_32);
+	const __m128i vMaskLo = _mm_set1_epi32(0xFF);
+	
+	for (; width >= 4; width -= 4)
+	{
+		// 0x00RRGGBB -> 0x00BBGGRR
+		__m128i px = _mm_loadu_si128((const __m128i*)screen);
+		__m128i rgb = _mm_and_si128(px, vMaskG);
+		rgb = _mm_or_si128(rgb, _mm_and_si128(_mm_srli_epi32(px, 16), vMaskLo));
+		rgb = _mm_or_si128(rgb, _mm_slli_epi32(_mm_and_si128(px, vMaskLo), 16));
+		
+		_mm_storeu_si128((__m128i*)rowOut, sse2_pack_RGB24(rgb));
+		
+		screen += 4;
+		rowOut += 12;
+	}
+#endif /* IMAGEUTIL_SSE2 */
+	
+	T_convertRow_RGB24<uint32_t,
+			   MASK_RED_32, MASK_GREEN_32, MASK_BLUE_32,
+			   SHIFT_RED_32, SHIFT_GREEN_32, SHIFT_BLUE_32>(screen, rowOut, width);
+}
+
+
+/**
+ * T_writePNG_rows(): Write PNG rows, converting them to 24-bit RGB.
+ * @param pixel Typename.
  * @param screen Pointer to the screen buffer.
  * @param png_ptr PNG pointer.
  * @param info_ptr PNG info pointer.
  * @param width Width of the image.
  * @param height Height of the image.
  * @param pitch Pitch of the image. (measured in pixels)
+ * @param convertRow Row conversion function.
  * @return 0 on success; non-zero on error.
  */
-template<typename pixel,
-	 const pixel maskR, const pixel maskG, const pixel maskB,
-	 const unsigned int shiftR, const unsigned int shiftG, const unsigned int shiftB>
-static inline int T_writePNG_rows_16(const pixel *screen, png_structp png_ptr, png_infop info_ptr,
-				     const int width, const int height, const int pitch)
+template<typename pixel>
+static inline int T_writePNG_rows(const pixel *screen, png_structp png_ptr, png_infop info_ptr,
+				  const int width, const int height, const int pitch,
+				  void (*convertRow)(const pixel *screen, uint8_t *rowOut, int width))
 {
 	// Allocate the row buffer.
-	uint8_t *rowBuffer = new uint8_t[width * 3];
+	// The SSE2 converters store 16 bytes at a time, so add some slack.
+	uint8_t *rowBuffer = new uint8_t[(width * 3) + 16];
 	if (!rowBuffer)
 	{
 		// Could not allocate enough memory.
@@ -249,20 +373,9 @@ static inline int T_writePNG_rows_16(const pixel *screen, png_structp png_ptr, p
 	// Write the rows.
 	for (int y = 0; y < height; y++)
 	{
-		uint8_t *rowBufPtr = rowBuffer;
-		for (int x = 0; x < width; x++)
-		{
-			pixel MD_Color = *screen++;
-			*rowBufPtr++ = (uint8_t)((MD_Color & maskR) >> shiftR);
-			*rowBufPtr++ = (uint8_t)((MD_Color & maskG) >> shiftG);
-			*rowBufPtr++ = (uint8_t)((MD_Color & maskB) << shiftB);
-		}
-		
-		// Write the row.
+		convertRow(screen, rowBuffer, width);
 		ppng_write_row(png_ptr, rowBuffer);
-		
-		// Next row.
-		screen += (pitch - width);
+		screen += pitch;
 	}
 	
 	// Free the row buffer.
@@ -272,6 +385,20 @@ static inline int T_writePNG_rows_16(const pixel *screen, png_structp png_ptr, p
 }
 
 
+// Row converters for T_writePNG_rows().
+#ifdef IMAGEUTIL_SSE2
+#define convertRow15_RGB24 T_convertRow_RGB24_sse2<MASK_RED_15, MASK_GREEN_15, MASK_BLUE_15, \
+						   SHIFT_RED_15, SHIFT_GREEN_15, SHIFT_BLUE_15>
+#define convertRow16_RGB24 T_convertRow_RGB24_sse2<MASK_RED_16, MASK_GREEN_16, MASK_BLUE_16, \
+						   SHIFT_RED_16, SHIFT_GREEN_16, SHIFT_BLUE_16>
+#else /* !IMAGEUTIL_SSE2 */
+#define convertRow15_RGB24 T_convertRow_RGB24<uint16_t, MASK_RED_15, MASK_GREEN_15, MASK_BLUE_15, \
+						   SHIFT_RED_15, SHIFT_GREEN_15, SHIFT_BLUE_15>
+#define convertRow16_RGB24 T_convertRow_RGB24<uint16_t, MASK_RED_16, MASK_GREEN_16, MASK_BLUE_16, \
+						   SHIFT_RED_16, SHIFT_GREEN_16, SHIFT_BLUE_16>
+#endif /* IMAGEUTIL_SSE2 */
+
+
 /**
  * WritePNG(): Write a PNG image.
  * @param fImg File handle to save the image to.
@@ -281,10 +408,12 @@ static inline int T_writePNG_rows_16(const pixel *screen, png_structp png_ptr, p
  * @param screen Pointer to screen buffer.
  * @param bpp Bits per pixel.
  * @param alpha Alpha channel specification. (32-bit color only.)
+ * @param level zlib compression level. (1 through 9)
  * @return 0 on success; non-zero on error.
  */
 int ImageUtil::WritePNG(FILE *fImg, const int w, const int h, const int pitch,
-			const void *screen, const int bpp, const AlphaChannel alpha)
+			const void *screen, const int bpp, const AlphaChannel alpha,
+			const int level)
 {
 	if (!fImg || !screen || (w <= 0 || h <= 0 || pitch <= 0))
 		return 1;
@@ -327,9 +456,9 @@ int ImageUtil::WritePNG(FILE *fImg, const int w, const int h, const int pitch,
 	// Disable PNG filters.
 	ppng_set_filter(png_ptr, 0, PNG_FILTER_NONE);
 	
-	// Set the compression level to 5. (Levels range from 1 through 9.)
+	// Set the compression level. (Levels range from 1 through 9.)
 	// TODO: Add a UI option to set compression level.
-	ppng_set_compression_level(png_ptr, 5);
+	ppng_set_compression_level(png_ptr, level);
 	
 	// Set up the PNG header.
 	if (!(bpp == 32 && alpha != ALPHACHANNEL_NONE))
@@ -360,10 +489,9 @@ int ImageUtil::WritePNG(FILE *fImg, const int w, const int h, const int pitch,
 	if (bpp == 15)
 	{
 		// 15-bit color. (Mode 555)
-		rval = T_writePNG_rows_16<uint16_t,
-					  MASK_RED_15, MASK_GREEN_15, MASK_BLUE_15,
-					  SHIFT_RED_15, SHIFT_GREEN_15, SHIFT_BLUE_15>
-					 (static_cast<const uint16_t*>(screen), png_ptr, info_ptr, w, h, pitch);
+		rval = T_writePNG_rows<uint16_t>(static_cast<const uint16_t*>(screen),
+						 png_ptr, info_ptr, w, h, pitch,
+						 convertRow15_RGB24);
 		
 		if (rval != 0)
 			return 5;
@@ -371,24 +499,31 @@ int ImageUtil::WritePNG(FILE *fImg, const int w, const int h, const int pitch,
 	else if (bpp == 16)
 	{
 		// 16-bit color. (Mode 565)
-		rval = T_writePNG_rows_16<uint16_t,
-					  MASK_RED_16, MASK_GREEN_16, MASK_BLUE_16,
-					  SHIFT_RED_16, SHIFT_GREEN_16, SHIFT_BLUE_16>
-					 (static_cast<const uint16_t*>(screen), png_ptr, info_ptr, w, h, pitch);
+		rval = T_writePNG_rows<uint16_t>(static_cast<const uint16_t*>(screen),
+						 png_ptr, info_ptr, w, h, pitch,
+						 convertRow16_RGB24);
 		
 		if (rval != 0)
 			return 6;
 	}
+	else if (!alpha)
+	{
+		// 32-bit color, no alpha channel.
+		// Convert the rows to 24-bit RGB here instead of using
+		// png_set_filler() and png_set_bgr(), which are much slower.
+		rval = T_writePNG_rows<uint32_t>(static_cast<const uint32_t*>(screen),
+						 png_ptr, info_ptr, w, h, pitch,
+						 convertRow32_RGB24);
+		
+		if (rval != 0)
+			return 7;
+	}
 	else // if (bpp == 32)
 	{
-		// 32-bit color.
-		// Depending on the alpha channel settings, libpng expects either
-		// 24-bit data (no alpha) or 32-bit data (with alpha); however,
-		// libpng offers an option to automatically convert 32-bit data
-		// without alpha channel to 24-bit. (png_set_filler())
+		// 32-bit color, with alpha channel.
 		
-		// TODO: PNG_FILLER_AFTER, BGR mode - needed for little-endian.
-		 // Figure out what's needed on big-endian.
+		// TODO: BGR mode - needed for little-endian.
+		// Figure out what's needed on big-endian.
 		
 		png_byte **row_pointers = static_cast<png_byte**>(malloc(sizeof(png_byte*) * h));
 		uint32_t *screen32 = (uint32_t*)screen;
@@ -398,12 +533,7 @@ int ImageUtil::WritePNG(FILE *fImg, const int w, const int h, const int pitch,
 			row_pointers[y] = (uint8_t*)&screen32[y * pitch];
 		}
 		
-		if (!alpha)
-		{
-			// No alpha channel. Set filler byte.
-			ppng_set_filler(png_ptr, 0, PNG_FILLER_AFTER);
-		}
-		else if (alpha == ALPHACHANNEL_TRANSPARENCY)
+		if (alpha == ALPHACHANNEL_TRANSPARENCY)
 		{
 			// Alpha channel indicates transparency.
 			// 0x00 == opaque; 0xFF == transparent.
@@ -470,16 +600,107 @@ int ImageUtil::WriteImage(const char* filename, const ImageFormat format,
 }
 
 
+/** Asynchronous screenshots. **/
+
+// Maximum visible MD screen size.
+#define SCREENSHOT_MAX_WIDTH	320
+#define SCREENSHOT_MAX_HEIGHT	240
+
+// Number of screenshot buffers.
+// If all buffers are in use, ScreenShot() waits for one to be freed.
+#define SCREENSHOT_POOL_SIZE	8
+
 /**
- * ScreenShot(): Convenience function to take a screenshot of the game.
- * @return 0 on success; non-zero on error.
+ * ScreenShotJob: Screenshot queued for the encoder thread.
  */
-int ImageUtil::ScreenShot(void)
+struct ScreenShotJob
 {
-	// If no game is running, don't do anything.
-	if (!Game)
-		return 1;
+	FILE *fImg;
+	ImageUtil::ImageFormat fmt;
+	int w, h, bpp;
+	uint8_t *buf;
+	char filename[GENS_PATH_MAX];
+};
+
+static deque<ScreenShotJob> ss_queue;
+static uint8_t *ss_pool[SCREENSHOT_POOL_SIZE];
+static int ss_pool_free = 0;	// Number of free buffers in ss_pool[].
+static int ss_pool_alloc = 0;	// Number of buffers allocated.
+
+static bool ss_thread_running = false;
+static bool ss_thread_quit = false;
+static gsft_thread_t ss_thread;
+static gsft_mutex_t ss_mutex;
+static gsft_cond_t ss_cond;
+
+// Burst screenshots.
+int ImageUtil::BurstFrames = 0;
+static int ss_burst_num = 0;
+
+
+/**
+ * ScreenShotThread(): Screenshot encoder thread.
+ * @param param Unused.
+ * @return NULL.
+ */
+void* ImageUtil::ScreenShotThread(void *param)
+{
+	((void)param);
+	
+	gsft_mutex_lock(&ss_mutex);
+	while (true)
+	{
+		while (ss_queue.empty() && !ss_thread_quit)
+			gsft_cond_wait(&ss_cond, &ss_mutex);
+		
+		// Finish all pending screenshots before quitting.
+		if (ss_queue.empty())
+			break;
+		
+		ScreenShotJob job = ss_queue.front();
+		ss_queue.pop_front();
+		gsft_mutex_unlock(&ss_mutex);
+		
+		int rval;
+#ifdef GENS_PNG
+		if (job.fmt == IMAGEFORMAT_PNG)
+		{
+			rval = WritePNG(job.fImg, job.w, job.h, job.w, job.buf,
+					job.bpp, ALPHACHANNEL_NONE, PNG_LEVEL_FAST);
+		}
+		else
+#endif /* GENS_PNG */
+		{
+			rval = WriteBMP(job.fImg, job.w, job.h, job.w, job.buf, job.bpp);
+		}
+		
+		if (fclose(job.fImg) != 0 && rval == 0)
+			rval = 1;
+		if (rval != 0)
+		{
+			LOG_MSG(gens, LOG_MSG_LEVEL_ERROR,
+				"Error writing screenshot %s. (rval == %d)", job.filename, rval);
+		}
+		
+		// Return the buffer to the pool.
+		gsft_mutex_lock(&ss_mutex);
+		ss_pool[ss_pool_free++] = job.buf;
+		gsft_cond_broadcast(&ss_cond);
+	}
+	gsft_mutex_unlock(&ss_mutex);
 	
+	return NULL;
+}
+
+
+/**
+ * QueueScreenShot(): Copy the MD screen and queue it for the encoder thread.
+ * @param filename Filename.
+ * @param fmt Image format.
+ * @return 0 on success; non-zero on error.
+ */
+int ImageUtil::QueueScreenShot(const char *filename, const ImageFormat fmt)
+{
 	// Variables used:
 	// VDP_Lines.Visible.Total: Number of lines visible on the screen. (bitmap height)
 	// MD_Screen: MD screen buffer.
@@ -488,28 +709,138 @@ int ImageUtil::ScreenShot(void)
 	const int w = vdp_getHPix();
 	const int h = VDP_Lines.Visible.Total;
 	const int start = TAB336[VDP_Lines.Visible.Border_Size] + 8 + vdp_getHPixBegin();
+	if (w <= 0 || w > SCREENSHOT_MAX_WIDTH || h <= 0 || h > SCREENSHOT_MAX_HEIGHT)
+		return 1;
 	
-	// Build the filename.
-	int num = -1;
-	char filename[GENS_PATH_MAX];
+	// Start the encoder thread if it isn't running.
+	if (!ss_thread_running)
+	{
+		gsft_mutex_init(&ss_mutex);
+		gsft_cond_init(&ss_cond);
+		ss_thread_quit = false;
+		if (gsft_thread_create(&ss_thread, ScreenShotThread, NULL) != 0)
+		{
+			LOG_MSG(gens, LOG_MSG_LEVEL_CRITICAL,
+				"Error starting the screenshot encoder thread.");
+			gsft_cond_destroy(&ss_cond);
+			gsft_mutex_destroy(&ss_mutex);
+			return 2;
+		}
+		ss_thread_running = true;
+	}
 	
-	const char *ext;
-	ImageFormat fmt;
+	// Open the file now so the filename is reserved.
+	FILE *fImg = fopen(filename, "wb");
+	if (!fImg)
+	{
+		LOG_MSG(gens, LOG_MSG_LEVEL_CRITICAL,
+			"Error opening %s.", filename);
+		return 3;
+	}
+	
+	// Get a buffer from the pool.
+	gsft_mutex_lock(&ss_mutex);
+	uint8_t *buf = NULL;
+	while (!buf)
+	{
+		if (ss_pool_free > 0)
+			buf = ss_pool[--ss_pool_free];
+		else if (ss_pool_alloc < SCREENSHOT_POOL_SIZE)
+		{
+			buf = static_cast<uint8_t*>(malloc(SCREENSHOT_MAX_WIDTH * SCREENSHOT_MAX_HEIGHT * 4));
+			if (!buf)
+				break;
+			ss_pool_alloc++;
+		}
+		else
+		{
+			// All buffers are in use. Wait for the encoder thread.
+			gsft_cond_wait(&ss_cond, &ss_mutex);
+		}
+	}
+	gsft_mutex_unlock(&ss_mutex);
+	
+	if (!buf)
+	{
+		LOG_MSG(gens, LOG_MSG_LEVEL_CRITICAL,
+			"Could not allocate enough memory for the screenshot buffer.");
+		fclose(fImg);
+		return 4;
+	}
+	
+	// Copy the visible screen.
+	const int pixelSize = (bppMD == 32 ? 4 : 2);
+	const size_t lineSize = (size_t)w * pixelSize;
+	const uint8_t *src = (bppMD == 32
+				? (const uint8_t*)&MD_Screen.u32[start]
+				: (const uint8_t*)&MD_Screen.u16[start]);
+	uint8_t *dest = buf;
+	for (int y = h; y != 0; y--)
+	{
+		memcpy(dest, src, lineSize);
+		src += (336 * pixelSize);
+		dest += lineSize;
+	}
+	
+	// Queue the screenshot.
+	ScreenShotJob job;
+	job.fImg = fImg;
+	job.fmt = fmt;
+	job.w = w;
+	job.h = h;
+	job.bpp = bppMD;
+	job.buf = buf;
+	strlcpy(job.filename, filename, sizeof(job.filename));
+	
+	gsft_mutex_lock(&ss_mutex);
+	ss_queue.push_back(job);
+	gsft_cond_broadcast(&ss_cond);
+	gsft_mutex_unlock(&ss_mutex);
+	
+	return 0;
+}
+
+
+/**
+ * GetScreenShotFormat(): Get the image format to use for screenshots.
+ * @param ext [out] File extension.
+ * @return Image format.
+ */
+ImageUtil::ImageFormat ImageUtil::GetScreenShotFormat(const char **ext)
+{
 #ifdef GENS_PNG
 	if (gsft_png_dll_init() == 0)
 	{
 		// PNG initialized.
-		ext = "png";
-		fmt = IMAGEFORMAT_PNG;
+		*ext = "png";
+		return IMAGEFORMAT_PNG;
 	}
-	else
 #endif /* GENS_PNG */
-	{
-		// Couldn't initialize PNG.
-		// Use BMP instead.
-		ext = "bmp";
-		fmt = IMAGEFORMAT_BMP;
-	}
+	
+	// Couldn't initialize PNG.
+	// Use BMP instead.
+	*ext = "bmp";
+	return IMAGEFORMAT_BMP;
+}
+
+
+/**
+ * ScreenShot(): Convenience function to take a screenshot of the game.
+ * The screen is copied immediately; the image is written on a background thread.
+ * @return 0 on success; non-zero on error.
+ */
+int ImageUtil::ScreenShot(void)
+{
+	// If no game is running, don't do anything.
+	if (!Game)
+		return 1;
+	
+	// Build the filename.
+	int num = -1;
+	char filename[GENS_PATH_MAX];
+	
+	const char *ext;
+	const ImageFormat fmt = GetScreenShotFormat(&ext);
 	
 	do
 	{
@@ -517,17 +848,83 @@ int ImageUtil::ScreenShot(void)
 		szprintf(filename, sizeof(filename), "%s%s_%03d.%s", PathNames.Screenshot_Dir, ROM_Filename, num, ext);
 	} while (!access(filename, F_OK));
 	
-	void *screen;
-	if (bppMD == 15 || bppMD == 16)
-		screen = (void*)(&MD_Screen.u16[start]);
-	else //if (bppMD == 32)
-		screen = (void*)(&MD_Screen.u32[start]);
-	
 	// Attempt to save the screenshot.
-	int rval = WriteImage(filename, fmt, w, h, 336, screen, bppMD);
+	int rval = QueueScreenShot(filename, fmt);
 	
 	if (!rval)
 		vdraw_text_printf(1500, "Screen shot %d saved.", num);
 	
 	return rval;
 }
+
+
+/**
+ * StartBurst(): Take a screenshot of each of the next frames.
+ * @param frames Number of frames.
+ */
+void ImageUtil::StartBurst(int frames)
+{
+	BurstFrames = (frames > 0 ? frames : 0);
+	ss_burst_num = 0;
+}
+
+
+/**
+ * UpdateBurst(): Take a burst screenshot of the current frame.
+ * This should be called after each rendered frame if BurstFrames is non-zero.
+ * Burst screenshots are numbered by frame, and existing files are overwritten.
+ * @return 0 on success; non-zero on error.
+ */
+int ImageUtil::UpdateBurst(void)
+{
+	if (BurstFrames <= 0 || !Game)
+		return 1;
+	
+	char filename[GENS_PATH_MAX];
+	const char *ext;
+	const ImageFormat fmt = GetScreenShotFormat(&ext);
+	szprintf(filename, sizeof(filename), "%s%s_burst_%05d.%s",
+		 PathNames.Screenshot_Dir, ROM_Filename, ss_burst_num, ext);
+	
+	int rval = QueueScreenShot(filename, fmt);
+	if (rval != 0)
+	{
+		// Error saving the screenshot. Stop the burst.
+		vdraw_text_printf(1500, "Burst stopped after %d screen shots.", ss_burst_num);
+		BurstFrames = 0;
+		return rval;
+	}
+	
+	ss_burst_num++;
+	if (--BurstFrames == 0)
+		vdraw_text_printf(1500, "Burst: %d screen shots saved.", ss_burst_num);
+	
+	return 0;
+}
+
+
+/**
+ * End(): Finish writing queued screenshots and stop the encoder thread.
+ */
+void ImageUtil::End(void)
+{
+	BurstFrames = 0;
+	if (!ss_thread_running)
+		return;
+	
+	gsft_mutex_lock(&ss_mutex);
+	ss_thread_quit = true;
+	gsft_cond_broadcast(&ss_cond);
+	gsft_mutex_unlock(&ss_mutex);
+	gsft_thread_join(ss_thread);
+	ss_thread_running = false;
+	
+	gsft_cond_destroy(&ss_cond);
+	gsft_mutex_destroy(&ss_mutex);
+	
+	// Free the buffer pool.
+	for (int i = 0; i < ss_pool_free; i++)
+		free(ss_pool[i]);
+	ss_pool_free = 0;
+	ss_pool_alloc = 0;
+}
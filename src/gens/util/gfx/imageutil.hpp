@@ -68,12 +68,24 @@ class ImageUtil
 		static const ImageFormat DefaultImageFormat = IMAGEFORMAT_BMP;
 #endif /* GENS_PNG */
 		
+		// PNG compression levels.
+		static const int PNG_LEVEL_DEFAULT = 5;
+		static const int PNG_LEVEL_FAST = 1;
+		
 		static int WriteImage(const char* filename, const ImageFormat format,
 					const int w, const int h, const int pitch,
 					const void *screen, const int bpp,
 					const AlphaChannel alpha = ALPHACHANNEL_NONE);
 		
 		static int ScreenShot(void);
+		
+		// Burst screenshots.
+		static int BurstFrames;
+		static void StartBurst(int frames);
+		static int UpdateBurst(void);
+		
+		// Finish writing queued screenshots.
+		static void End(void);
 	
 	protected:
 		static int WriteBMP(FILE *fImg, const int w, const int h, const int pitch,
@@ -81,7 +93,12 @@ class ImageUtil
 		
 		static int WritePNG(FILE *fImg, const int w, const int h, const int pitch,
 					const void *screen, const int bpp,
-					const AlphaChannel alpha = ALPHACHANNEL_NONE);
+					const AlphaChannel alpha = ALPHACHANNEL_NONE,
+					const int level = PNG_LEVEL_DEFAULT);
+		
+		static ImageFormat GetScreenShotFormat(const char **ext);
+		static int QueueScreenShot(const char *filename, const ImageFormat fmt);
+		static void* ScreenShotThread(void *param);
 	
 	private:
 		// Don't allow instantiation of this class.
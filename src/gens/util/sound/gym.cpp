@@ -29,9 +29,16 @@
 // C includes.
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 
+#ifdef HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 // C++ includes.
 #include <string>
 using std::string;
@@ -55,11 +62,75 @@ using std::string;
 // Video, Audio.
 #include "video/vdraw.h"
 #include "audio/audio.h"
+#include "audio/audio_write.h"
+
+// WAV header writer.
+#include "wave.h"
 
 
 static FILE *GYM_File = NULL;
 int GYM_Dumping = 0;
 
+/**
+ * GYM dump write buffer.
+ * Register writes are only 1-3 bytes each, so they're
+ * collected here and written to disk in large blocks.
+ */
+#define GYM_WRITE_BUF_SIZE (64*1024)
+static uint8_t GYM_WriteBuf[GYM_WRITE_BUF_SIZE];
+static size_t GYM_WriteBuf_Pos = 0;
+
+/**
+ * GYM playback data.
+ * The entire file is mapped into memory (or read into memory
+ * if mmap() isn't available), and commands are decoded directly
+ * from the buffer.
+ */
+static const uint8_t *GYM_Data = NULL;
+static size_t GYM_Data_Size = 0;
+static size_t GYM_Data_Pos = 0;
+#ifdef HAVE_MMAP
+static bool GYM_Data_Mapped = false;
+#endif
+
+
+/**
+ * gym_dump_flush(): Flush the GYM dump write buffer.
+ * @return 0 on success; non-zero on error.
+ */
+static int gym_dump_flush(void)
+{
+	if (GYM_WriteBuf_Pos == 0)
+		return 0;
+	
+	size_t len = GYM_WriteBuf_Pos;
+	GYM_WriteBuf_Pos = 0;
+	
+	if (fwrite(GYM_WriteBuf, 1, len, GYM_File) != len)
+		return -1;
+	return 0;
+}
+
+
+/**
+ * gym_dump_write(): Write data to the GYM dump write buffer.
+ * @param buf Data.
+ * @param len Length of the data. (Must be less than GYM_WRITE_BUF_SIZE.)
+ * @return 0 on success; non-zero on error.
+ */
+static inline int gym_dump_write(const uint8_t *buf, size_t len)
+{
+	if (GYM_WriteBuf_Pos + len > sizeof(GYM_WriteBuf))
+	{
+		if (gym_dump_flush())
+			return -1;
+	}
+	
+	memcpy(&GYM_WriteBuf[GYM_WriteBuf_Pos], buf, len);
+	GYM_WriteBuf_Pos += len;
+	return 0;
+}
+
 
 /**
  * gym_dump_start(): Start dumping a GYM file.
@@ -68,7 +139,8 @@ int GYM_Dumping = 0;
 int gym_dump_start(void)
 {
 	char filename[GENS_PATH_MAX];
-	unsigned char YM_Save[0x200], t_buf[4];
+	unsigned char YM_Save[0x200];
+	uint8_t t_buf[4];
 	int num, i;
 	
 	// A game must be loaded in order to dump a GYM.
@@ -94,9 +166,10 @@ int gym_dump_start(void)
 		szprintf(filename, sizeof(filename), "%s%s_%03d.gym", PathNames.Dump_GYM_Dir, ROM_Filename, num);
 	} while (!access(filename, F_OK));
 	
-	GYM_File = fopen(filename, "w");
+	GYM_File = fopen(filename, "wb");
 	if (!GYM_File)
 		return -3;
+	GYM_WriteBuf_Pos = 0;
 	
 	// Save the YM2612 registers.
 	YM2612_Save(YM_Save);
@@ -106,12 +179,12 @@ int gym_dump_start(void)
 		t_buf[0] = 1;
 		t_buf[1] = i;
 		t_buf[2] = YM_Save[i];
-		fwrite(t_buf, 3, 1, GYM_File);
+		gym_dump_write(t_buf, 3);
 		
 		t_buf[0] = 2;
 		t_buf[1] = i;
 		t_buf[2] = YM_Save[i + 0x100];
-		fwrite(t_buf, 3, 1, GYM_File);
+		gym_dump_write(t_buf, 3);
 	}
 	
 	for (i = 0xA0; i < 0xB8; i++)
@@ -119,28 +192,28 @@ int gym_dump_start(void)
 		t_buf[0] = 1;
 		t_buf[1] = i;
 		t_buf[2] = YM_Save[i];
-		fwrite(t_buf, 3, 1, GYM_File);
+		gym_dump_write(t_buf, 3);
 		
 		t_buf[0] = 2;
 		t_buf[1] = i;
 		t_buf[2] = YM_Save[i + 0x100];
-		fwrite(t_buf, 3, 1, GYM_File);
+		gym_dump_write(t_buf, 3);
 	}
 	
 	t_buf[0] = 1;
 	t_buf[1] = 0x22;
 	t_buf[2] = YM_Save[0x22];
-	fwrite(t_buf, 3, 1, GYM_File);
+	gym_dump_write(t_buf, 3);
 	
 	t_buf[0] = 1;
 	t_buf[1] = 0x27;
 	t_buf[2] = YM_Save[0x27];
-	fwrite(t_buf, 3, 1, GYM_File);
+	gym_dump_write(t_buf, 3);
 	
 	t_buf[0] = 1;
 	t_buf[1] = 0x28;
 	t_buf[2] = YM_Save[0x28];
-	fwrite(t_buf, 3, 1, GYM_File);
+	gym_dump_write(t_buf, 3);
 	
 	vdraw_text_write("Starting to dump GYM sound", 1000);
 	GYM_Dumping = 1;
@@ -162,7 +235,11 @@ int gym_dump_stop(void)
 	}
 	
 	if (GYM_File)
+	{
+		gym_dump_flush();
 		fclose(GYM_File);
+		GYM_File = NULL;
+	}
 	audio_clear_sound_buffer();
 	GYM_Dumping = 0;
 	
@@ -183,7 +260,7 @@ int gym_dump_update(uint8_t v0, uint8_t v1, uint8_t v2)
 	if (!GYM_Dumping || !GYM_File)
 		return -1;
 	
-	char buf_tmp[4];
+	uint8_t buf_tmp[4];
 	size_t l;
 	
 	buf_tmp[0] = v0;
@@ -204,14 +281,160 @@ int gym_dump_update(uint8_t v0, uint8_t v1, uint8_t v2)
 			break;
 	}
 	
-	int rval = fwrite(buf_tmp, l, 1, GYM_File);
-	if (!rval)
+	if (gym_dump_write(buf_tmp, l))
+		return -2;
+	
+	return 0;
+}
+
+
+/**
+ * gym_load(): Load a GYM file for playback.
+ * @param filename Filename of the GYM file.
+ * @return 0 on success; non-zero on error.
+ */
+static int gym_load(const char *filename)
+{
+	GYM_Data = NULL;
+	GYM_Data_Size = 0;
+	GYM_Data_Pos = 0;
+	
+#ifdef HAVE_MMAP
+	// Attempt to map the GYM file into memory.
+	GYM_Data_Mapped = false;
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0)
+		return -1;
+	
+	struct stat st;
+	if (fstat(fd, &st) == 0 && st.st_size > 0)
+	{
+		void *map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (map != MAP_FAILED)
+		{
+#ifdef MADV_SEQUENTIAL
+			madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+			GYM_Data = (const uint8_t*)map;
+			GYM_Data_Size = (size_t)st.st_size;
+			GYM_Data_Mapped = true;
+			close(fd);
+			return 0;
+		}
+	}
+	
+	// mmap() failed. Fall back to reading the file.
+	close(fd);
+#endif /* HAVE_MMAP */
+	
+	FILE *f = fopen(filename, "rb");
+	if (!f)
+		return -1;
+	
+	fseek(f, 0, SEEK_END);
+	long size = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	if (size <= 0)
+	{
+		fclose(f);
 		return -2;
+	}
 	
+	uint8_t *data = (uint8_t*)malloc((size_t)size);
+	if (!data)
+	{
+		fclose(f);
+		return -3;
+	}
+	
+	GYM_Data_Size = fread(data, 1, (size_t)size, f);
+	GYM_Data = data;
+	fclose(f);
 	return 0;
 }
 
 
+/**
+ * gym_unload(): Unload the currently-loaded GYM file.
+ */
+static void gym_unload(void)
+{
+	if (!GYM_Data)
+		return;
+	
+#ifdef HAVE_MMAP
+	if (GYM_Data_Mapped)
+		munmap((void*)GYM_Data, GYM_Data_Size);
+	else
+#endif
+		free((void*)GYM_Data);
+	
+	GYM_Data = NULL;
+	GYM_Data_Size = 0;
+	GYM_Data_Pos = 0;
+}
+
+
+/**
+ * gym_decode_frame(): Decode the next frame from the loaded GYM file.
+ * Register writes are sent to the YM2612 and PSG, and one
+ * audio segment is rendered into the specified buffers.
+ * @param buf Audio segment buffers. ([0] == left; [1] == right)
+ * @return 0 if a frame was decoded; non-zero if the end of the file was reached.
+ */
+static int gym_decode_frame(int *buf[2])
+{
+	const uint8_t *data = GYM_Data;
+	const size_t size = GYM_Data_Size;
+	size_t pos = GYM_Data_Pos;
+	
+	while (pos < size)
+	{
+		switch (data[pos++])
+		{
+			case 0:
+				// End of frame.
+				GYM_Data_Pos = pos;
+				PSG_Update(buf, audio_seg_length);
+				if (YM2612_Enable)
+					YM2612_Update(buf, audio_seg_length);
+				return 0;
+			
+			case 1:
+				if (pos + 2 > size)
+					goto eof;
+				YM2612_Write(0, data[pos]);
+				YM2612_Write(1, data[pos + 1]);
+				pos += 2;
+				break;
+			
+			case 2:
+				if (pos + 2 > size)
+					goto eof;
+				YM2612_Write(2, data[pos]);
+				YM2612_Write(3, data[pos + 1]);
+				pos += 2;
+				break;
+			
+			case 3:
+				if (pos + 1 > size)
+					goto eof;
+				PSG_Write(data[pos]);
+				pos++;
+				break;
+			
+			default:
+				// Unknown command. Ignore it.
+				break;
+		}
+	}
+	
+eof:
+	GYM_Data_Pos = size;
+	return 1;
+}
+
+
 /**
  * gym_play_start(): Start playing a GYM file.
  * @return 0 on success; non-zero on error.
@@ -244,9 +467,8 @@ int gym_play_start(void)
 	if (filename.length() == 0)
 		return -4;
 	
-	// Attempt to open the GYM file.
-	GYM_File = fopen(filename.c_str(), "rb");
-	if (!GYM_File)
+	// Attempt to load the GYM file.
+	if (gym_load(filename.c_str()))
 		return -5;
 	
 	YM2612_Init(CLOCK_NTSC / 7, audio_get_sound_rate(), YM2612_Improv);
@@ -270,8 +492,7 @@ int gym_play_stop(void)
 		return -1;
 	}
 	
-	if (GYM_File)
-		fclose(GYM_File);
+	gym_unload();
 	audio_clear_sound_buffer();
 	audio_set_gym_playing(false);
 	
@@ -286,51 +507,16 @@ int gym_play_stop(void)
  */
 static int gym_play_next(void)
 {
-	unsigned char c, c2;
-	unsigned int l;
 	int *buf[2];
 	
-	if (!audio_get_gym_playing() || !GYM_File)
+	if (!audio_get_gym_playing() || !GYM_Data)
 		return -1;
 	
 	buf[0] = Seg_L;
 	buf[1] = Seg_R;
 	
-	do
-	{
-		l = fread(&c, 1, 1, GYM_File);
-		if (l == 0)
-			return 0;
-		
-		switch (c)
-		{
-			case 0:
-				PSG_Update(buf, audio_seg_length);
-				if (YM2612_Enable)
-					YM2612_Update(buf, audio_seg_length);
-				break;
-			
-			case 1:
-				fread(&c2, 1, 1, GYM_File);
-				YM2612_Write(0, c2);
-				fread(&c2, 1, 1, GYM_File);
-				YM2612_Write(1, c2);
-				break;
-			
-			case 2:
-				fread(&c2, 1, 1, GYM_File);
-				YM2612_Write(2, c2);
-				fread(&c2, 1, 1, GYM_File);
-				YM2612_Write(3, c2);
-				break;
-			
-			case 3:
-				fread(&c2, 1, 1, GYM_File);
-				PSG_Write(c2);
-				break;
-		}
-	} while (c);
-	
+	// The end of the file isn't treated as an error.
+	gym_decode_frame(buf);
 	return 0;
 }
 
@@ -350,3 +536,98 @@ int gym_play(void)
 	audio_write_sound_buffer(NULL);
 	return 0;
 }
+
+
+/**
+ * gym_render_wav(): Render a GYM file to a WAV file.
+ * The GYM file is rendered as fast as possible, with no real-time pacing.
+ * @param gym_filename Filename of the GYM file.
+ * @param wav_filename Filename of the WAV file.
+ * @return 0 on success; non-zero on error.
+ */
+int gym_render_wav(const char *gym_filename, const char *wav_filename)
+{
+	// GYM rendering uses the same sound chips as emulation.
+	if (Game || audio_get_gym_playing())
+		return -1;
+	
+	if (gym_load(gym_filename))
+		return -2;
+	
+	FILE *wav_file = fopen(wav_filename, "wb");
+	if (!wav_file)
+	{
+		gym_unload();
+		return -3;
+	}
+	
+	// GYM files are always 60 Hz.
+	CPU_Mode = 0;
+	audio_calc_segment_length();
+	
+	const int rate = audio_get_sound_rate();
+	const int stereo = audio_get_stereo();
+	YM2612_Init(CLOCK_NTSC / 7, rate, YM2612_Improv);
+	PSG_Init(CLOCK_NTSC / 15, rate);
+	
+	// Reserve space for the WAV header.
+	wav_write_header(wav_file, rate, stereo, 0);
+	
+	// Clear the segment buffers.
+	memset(Seg_L, 0x00, sizeof(Seg_L));
+	memset(Seg_R, 0x00, sizeof(Seg_R));
+	int *buf[2] = {Seg_L, Seg_R};
+	
+	// Output buffer. Multiple frames are written to disk at once.
+	static const int frames_per_write = 64;
+	const int frame_samples = (audio_seg_length * (stereo ? 2 : 1));
+	short *out_buf = (short*)malloc(frames_per_write * frame_samples * sizeof(short));
+	if (!out_buf)
+	{
+		fclose(wav_file);
+		gym_unload();
+		return -4;
+	}
+	
+	uint32_t data_size = 0;
+	int rval = 0;
+	bool eof = false;
+	while (!eof)
+	{
+		short *dest = out_buf;
+		int frames = 0;
+		
+		for (; frames < frames_per_write; frames++)
+		{
+			if (gym_decode_frame(buf))
+			{
+				eof = true;
+				break;
+			}
+			
+			// Convert the segment and clear the segment buffers.
+			if (stereo)
+				audio_write_sound_stereo(dest, audio_seg_length);
+			else
+				audio_write_sound_mono(dest, audio_seg_length);
+			dest += frame_samples;
+		}
+		
+		const size_t len = (frames * frame_samples * sizeof(short));
+		if (len > 0 && fwrite(out_buf, 1, len, wav_file) != len)
+		{
+			rval = -5;
+			break;
+		}
+		data_size += len;
+	}
+	
+	// Update the WAV header.
+	if (wav_write_header(wav_file, rate, stereo, data_size) != 0 && rval == 0)
+		rval = -6;
+	
+	free(out_buf);
+	fclose(wav_file);
+	gym_unload();
+	return rval;
+}
@@ -39,6 +39,8 @@ int gym_play_start(void);
 int gym_play_stop(void);
 int gym_play(void);
 
+int gym_render_wav(const char *gym_filename, const char *wav_filename);
+
 #ifdef __cplusplus
 }
 #endif
@@ -95,6 +95,78 @@ static wav_header_t WAV_Header;
 static FILE *WAV_File = NULL;
 
 
+/**
+ * wav_header_set_size(): Set the size fields in a WAV header.
+ * @param header WAV header.
+ * @param data_size Size of the sample data, in bytes.
+ */
+static void wav_header_set_size(wav_header_t *header, uint32_t data_size)
+{
+	header->riff.ChunkSize		= cpu_to_le32(data_size + sizeof(*header) - 8);
+	header->data.SubchunkSize	= cpu_to_le32(data_size);
+}
+
+
+/**
+ * wav_header_init(): Initialize a WAV header.
+ * @param header WAV header.
+ * @param sample_rate Sample rate.
+ * @param stereo If non-zero, the WAV file is stereo.
+ * @param data_size Size of the sample data, in bytes.
+ */
+static void wav_header_init(wav_header_t *header, int sample_rate, int stereo, uint32_t data_size)
+{
+	memset(header, 0x00, sizeof(*header));
+	
+	/* "RIFF" header. */
+	static const char ChunkID_RIFF[4] = {'R', 'I', 'F', 'F'};
+	static const char FormatID_WAV[4] = {'W', 'A', 'V', 'E'};
+	memcpy(header->riff.ChunkID, ChunkID_RIFF, sizeof(header->riff.ChunkID));
+	memcpy(header->riff.Format, FormatID_WAV, sizeof(header->riff.Format));
+	
+	/* "fmt " header. */
+	static const char SubchunkID_fmt[4] = {'f', 'm', 't', ' '};
+	memcpy(header->fmt.SubchunkID, SubchunkID_fmt, sizeof(header->fmt.SubchunkID));
+	header->fmt.SubchunkSize	= cpu_to_le32(sizeof(header->fmt) - 8);
+	header->fmt.AudioFormat		= cpu_to_le16(1); /* PCM */
+	header->fmt.NumChannels		= cpu_to_le16((stereo ? 2 : 1));
+	header->fmt.SampleRate		= cpu_to_le32(sample_rate);
+	header->fmt.BitsPerSample	= cpu_to_le16(16); /* Gens is currently hard-coded to 16-bit audio. */
+	
+	/* Calculated fields. */
+	header->fmt.BlockAlign		= cpu_to_le16((stereo ? 2 : 1) * 2);
+	header->fmt.ByteRate		= cpu_to_le32((stereo ? 2 : 1) * 2 * sample_rate);
+	
+	/* "data" header. */
+	static const char SubchunkID_data[4] = {'d', 'a', 't', 'a'};
+	memcpy(header->data.SubchunkID, SubchunkID_data, sizeof(header->data.SubchunkID));
+	
+	wav_header_set_size(header, data_size);
+}
+
+
+/**
+ * wav_write_header(): Write a WAV header to a file.
+ * The file position is not restored after writing the header.
+ * @param f File to write the header to. (The header is written at the beginning of the file.)
+ * @param sample_rate Sample rate.
+ * @param stereo If non-zero, the WAV file is stereo.
+ * @param data_size Size of the sample data, in bytes.
+ * @return 0 on success; non-zero on error.
+ */
+int wav_write_header(FILE *f, int sample_rate, int stereo, uint32_t data_size)
+{
+	wav_header_t header;
+	wav_header_init(&header, sample_rate, stereo, data_size);
+	
+	if (fseek(f, 0, SEEK_SET) != 0)
+		return -1;
+	if (fwrite(&header, sizeof(header), 1, f) != 1)
+		return -2;
+	return 0;
+}
+
+
 /**
  * wav_dump_start(): Start dumping a WAV file.
  * @return 0 on success; non-zero on error.
@@ -134,30 +206,7 @@ int wav_dump_start(void)
 	}
 	
 	/* Create the WAV header. */
-	memset(&WAV_Header, 0x00, sizeof(WAV_Header));
-	
-	/* "RIFF" header. */
-	static const char ChunkID_RIFF[4] = {'R', 'I', 'F', 'F'};
-	static const char FormatID_WAV[4] = {'W', 'A', 'V', 'E'};
-	memcpy(WAV_Header.riff.ChunkID, ChunkID_RIFF, sizeof(WAV_Header.riff.ChunkID));
-	memcpy(WAV_Header.riff.Format, FormatID_WAV, sizeof(WAV_Header.riff.Format));
-	
-	/* "fmt " header. */
-	static const char SubchunkID_fmt[4] = {'f', 'm', 't', ' '};
-	memcpy(WAV_Header.fmt.SubchunkID, SubchunkID_fmt, sizeof(WAV_Header.fmt.SubchunkID));
-	WAV_Header.fmt.SubchunkSize	= cpu_to_le32(sizeof(WAV_Header.fmt) - 8);
-	WAV_Header.fmt.AudioFormat	= cpu_to_le16(1); /* PCM */
-	WAV_Header.fmt.NumChannels	= cpu_to_le16((audio_get_stereo() ? 2 : 1));
-	WAV_Header.fmt.SampleRate	= cpu_to_le32(audio_get_sound_rate());
-	WAV_Header.fmt.BitsPerSample	= cpu_to_le16(16); /* Gens is currently hard-coded to 16-bit audio. */
-	
-	/* Calculated fields. */
-	WAV_Header.fmt.BlockAlign	= cpu_to_le16(WAV_Header.fmt.NumChannels * (WAV_Header.fmt.BitsPerSample / 8));
-	WAV_Header.fmt.ByteRate		= cpu_to_le32(WAV_Header.fmt.BlockAlign * WAV_Header.fmt.SampleRate);
-	
-	/* "data" header. */
-	static const char SubchunkID_data[4] = {'d', 'a', 't', 'a'};
-	memcpy(WAV_Header.data.SubchunkID, SubchunkID_data, sizeof(WAV_Header.data.SubchunkID));
+	wav_header_init(&WAV_Header, audio_get_sound_rate(), audio_get_stereo(), 0);
 	
 	/* Write the initial header to the file. */
 	fwrite(&WAV_Header, sizeof(WAV_Header), 1, WAV_File);
@@ -191,8 +240,7 @@ int wav_dump_stop(void)
 	fseek(WAV_File, 0, SEEK_SET);
 	
 	/* Set the size values in the header. */
-	WAV_Header.riff.ChunkSize	= cpu_to_le32(wav_pos - 8);
-	WAV_Header.data.SubchunkSize	= cpu_to_le32(wav_pos - 8 - sizeof(WAV_Header.riff) - sizeof(WAV_Header.fmt));
+	wav_header_set_size(&WAV_Header, wav_pos - sizeof(WAV_Header));
 	
 	/* Write the final header. */
 	fwrite(&WAV_Header, sizeof(WAV_Header), 1, WAV_File);
@@ -38,6 +38,9 @@ int wav_dump_start(void);
 int wav_dump_stop(void);
 int wav_dump_update(void);
 
+/* WAV header function. */
+int wav_write_header(FILE *f, int sample_rate, int stereo, uint32_t data_size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,905 @@
+/***************************************************************************
+ * Gens: AVI file handler.                                                 *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include "avi.hpp"
+#include "zmbv.hpp"
+
+// C includes.
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// C++ includes.
+#include <vector>
+using std::vector;
+
+#ifdef _WIN32
+#include "libgsft/w32u/w32u_windows.h"
+#include "libgsft/w32u/w32u_libc.h"
+#endif
+
+// libgsft includes.
+#include "libgsft/gsft_szprintf.h"
+#include "libgsft/gsft_thread.h"
+
+#include "macros/log_msg.h"
+#include "emulator/g_main.hpp"
+#include "gens/gens_window_sync.hpp"
+#include "util/file/rom.hpp"
+
+// Video, Audio.
+#include "video/vdraw.h"
+#include "audio/audio.h"
+#include "audio/audio_write.h"
+
+
+/**
+ * The AVI frame size is fixed at the largest MD resolution.
+ * Smaller frames are centered.
+ */
+#define AVI_WIDTH		320
+#define AVI_HEIGHT		240
+#define AVI_MAX_PIXEL_SIZE	4
+
+// Maximum number of audio samples per frame. (44,100 Hz PAL)
+#define AVI_AUDIO_MAX		882
+
+// Number of frames that can be queued for the encoder thread.
+#define AVI_QUEUE_SIZE		16
+
+// Number of dropped frames whose audio can be queued for the encoder thread.
+#define AVI_AUDIO_QUEUE_SIZE	64
+
+// Keyframe interval, in frames.
+#define AVI_KEYFRAME_INTERVAL	300
+
+// AVI 1.0 files must stay under 2 GB. A new file is started after this size.
+#define AVI_MAX_FILE_SIZE	0x7C000000U
+
+// AVI flags.
+#define AVIF_HASINDEX		0x00000010
+#define AVIF_ISINTERLEAVED	0x00000100
+#define AVIIF_KEYFRAME		0x00000010
+
+/**
+ * avi_frame_t: Frame queued for the encoder thread.
+ */
+struct avi_frame_t
+{
+	uint8_t pixels[AVI_WIDTH * AVI_HEIGHT * AVI_MAX_PIXEL_SIZE];
+	int width, height, bpp;
+
+	int16_t audio[AVI_AUDIO_MAX * 2];
+	int audio_len;	// Number of samples per channel.
+
+	// Number of frames dropped immediately before this frame.
+	unsigned int dropped_before;
+	// Number of those frames whose audio is in the audio queue.
+	// The rest are written with silence.
+	unsigned int dropped_audio;
+};
+
+/**
+ * avi_audio_t: Audio segment of a dropped frame.
+ */
+struct avi_audio_t
+{
+	int16_t audio[AVI_AUDIO_MAX * 2];
+	int audio_len;	// Number of samples per channel.
+};
+
+int AVI_Dumping = 0;
+
+// Frame queue. (Ring buffer.)
+static avi_frame_t *AVI_Queue = NULL;
+static int AVI_Queue_Head = 0;
+static int AVI_Queue_Count = 0;
+
+// Audio queue for dropped frames. (Ring buffer.)
+static avi_audio_t *AVI_Audio_Queue = NULL;
+static int AVI_Audio_Queue_Head = 0;
+static int AVI_Audio_Queue_Count = 0;
+
+// Dropped frames.
+static unsigned int AVI_Dropped_Pending = 0;
+static unsigned int AVI_Dropped_Audio_Pending = 0;
+static unsigned int AVI_Dropped_Total = 0;
+
+// Encoder thread.
+static gsft_thread_t AVI_Thread;
+static gsft_mutex_t AVI_Mutex;
+static gsft_cond_t AVI_Cond;
+static bool AVI_Quit = false;
+static bool AVI_Error = false;
+
+// Output filename base. (without the extension)
+static char AVI_Filename_Base[GENS_PATH_MAX];
+
+// Stream parameters.
+static int AVI_FPS;
+static int AVI_Sample_Rate;
+
+
+/**
+ * AviWriter: AVI 1.0 file writer.
+ * The file contains a ZMBV video stream and a 16-bit stereo PCM audio stream.
+ */
+class AviWriter
+{
+	public:
+		AviWriter() : m_file(NULL) { }
+		~AviWriter() { close(); }
+
+		int open(const char *filename, int bpp, int fps, int sample_rate);
+		int close(void);
+
+		int writeVideo(const uint8_t *data, size_t len, bool keyframe);
+		int writeAudio(const int16_t *data, int samples);
+
+		bool isOpen(void) const { return (m_file != NULL); }
+		uint32_t size(void) const { return m_pos; }
+
+	protected:
+		struct IndexEntry
+		{
+			uint32_t fourcc;
+			uint32_t flags;
+			uint32_t offset;
+			uint32_t size;
+		};
+
+		int writeChunk(uint32_t fourcc, const void *data, uint32_t len, uint32_t flags);
+		void buildHeaders(vector<uint8_t> &hdr, uint32_t riff_size, uint32_t movi_size);
+
+		FILE *m_file;
+		uint32_t m_pos;
+		uint32_t m_movi_pos;
+
+		int m_bpp, m_fps, m_sample_rate;
+		uint32_t m_video_frames;
+		uint32_t m_audio_samples;
+		uint32_t m_max_chunk;
+
+		vector<IndexEntry> m_index;
+};
+
+
+#define FOURCC(a, b, c, d) \
+	((uint32_t)(a) | ((uint32_t)(b) << 8) | ((uint32_t)(c) << 16) | ((uint32_t)(d) << 24))
+
+static inline void put16(vector<uint8_t> &v, uint16_t x)
+{
+	v.push_back(x & 0xFF);
+	v.push_back(x >> 8);
+}
+
+static inline void put32(vector<uint8_t> &v, uint32_t x)
+{
+	v.push_back(x & 0xFF);
+	v.push_back((x >> 8) & 0xFF);
+	v.push_back((x >> 16) & 0xFF);
+	v.push_back(x >> 24);
+}
+
+static inline void set32(vector<uint8_t> &v, size_t pos, uint32_t x)
+{
+	v[pos]   = (x & 0xFF);
+	v[pos+1] = ((x >> 8) & 0xFF);
+	v[pos+2] = ((x >> 16) & 0xFF);
+	v[pos+3] = (x >> 24);
+}
+
+
+/**
+ * buildHeaders(): Build the AVI headers, up to and including the "movi" LIST header.
+ * @param hdr Buffer for the headers.
+ * @param riff_size RIFF chunk size.
+ * @param movi_size "movi" LIST size.
+ */
+void AviWriter::buildHeaders(vector<uint8_t> &hdr, uint32_t riff_size, uint32_t movi_size)
+{
+	const int pixel_size = (m_bpp == 32 ? 4 : 2);
+	hdr.clear();
+
+	put32(hdr, FOURCC('R','I','F','F'));
+	put32(hdr, riff_size);
+	put32(hdr, FOURCC('A','V','I',' '));
+
+	// "hdrl" LIST.
+	put32(hdr, FOURCC('L','I','S','T'));
+	const size_t hdrl_size_pos = hdr.size();
+	put32(hdr, 0);
+	put32(hdr, FOURCC('h','d','r','l'));
+
+	// Main AVI header.
+	put32(hdr, FOURCC('a','v','i','h'));
+	put32(hdr, 56);
+	put32(hdr, 1000000 / m_fps);		// dwMicroSecPerFrame
+	put32(hdr, 0);				// dwMaxBytesPerSec
+	put32(hdr, 0);				// dwPaddingGranularity
+	put32(hdr, AVIF_HASINDEX | AVIF_ISINTERLEAVED);
+	put32(hdr, m_video_frames);		// dwTotalFrames
+	put32(hdr, 0);				// dwInitialFrames
+	put32(hdr, 2);				// dwStreams
+	put32(hdr, m_max_chunk);		// dwSuggestedBufferSize
+	put32(hdr, AVI_WIDTH);
+	put32(hdr, AVI_HEIGHT);
+	put32(hdr, 0); put32(hdr, 0); put32(hdr, 0); put32(hdr, 0);
+
+	// Video stream.
+	put32(hdr, FOURCC('L','I','S','T'));
+	put32(hdr, 4 + (8 + 56) + (8 + 40));
+	put32(hdr, FOURCC('s','t','r','l'));
+
+	put32(hdr, FOURCC('s','t','r','h'));
+	put32(hdr, 56);
+	put32(hdr, FOURCC('v','i','d','s'));
+	put32(hdr, FOURCC('Z','M','B','V'));
+	put32(hdr, 0);				// dwFlags
+	put16(hdr, 0);				// wPriority
+	put16(hdr, 0);				// wLanguage
+	put32(hdr, 0);				// dwInitialFrames
+	put32(hdr, 1);				// dwScale
+	put32(hdr, m_fps);			// dwRate
+	put32(hdr, 0);				// dwStart
+	put32(hdr, m_video_frames);		// dwLength
+	put32(hdr, m_max_chunk);		// dwSuggestedBufferSize
+	put32(hdr, 0xFFFFFFFF);			// dwQuality
+	put32(hdr, 0);				// dwSampleSize
+	put16(hdr, 0); put16(hdr, 0);		// rcFrame
+	put16(hdr, AVI_WIDTH); put16(hdr, AVI_HEIGHT);
+
+	put32(hdr, FOURCC('s','t','r','f'));
+	put32(hdr, 40);
+	put32(hdr, 40);				// biSize
+	put32(hdr, AVI_WIDTH);			// biWidth
+	put32(hdr, AVI_HEIGHT);			// biHeight
+	put16(hdr, 1);				// biPlanes
+	put16(hdr, pixel_size * 8);		// biBitCount
+	put32(hdr, FOURCC('Z','M','B','V'));	// biCompression
+	put32(hdr, AVI_WIDTH * AVI_HEIGHT * pixel_size);
+	put32(hdr, 0); put32(hdr, 0);		// biXPelsPerMeter, biYPelsPerMeter
+	put32(hdr, 0); put32(hdr, 0);		// biClrUsed, biClrImportant
+
+	// Audio stream.
+	put32(hdr, FOURCC('L','I','S','T'));
+	put32(hdr, 4 + (8 + 56) + (8 + 16));
+	put32(hdr, FOURCC('s','t','r','l'));
+
+	put32(hdr, FOURCC('s','t','r','h'));
+	put32(hdr, 56);
+	put32(hdr, FOURCC('a','u','d','s'));
+	put32(hdr, 0);				// fccHandler
+	put32(hdr, 0);				// dwFlags
+	put16(hdr, 0);				// wPriority
+	put16(hdr, 0);				// wLanguage
+	put32(hdr, 0);				// dwInitialFrames
+	put32(hdr, 4);				// dwScale (block align)
+	put32(hdr, m_sample_rate * 4);		// dwRate (bytes per second)
+	put32(hdr, 0);				// dwStart
+	put32(hdr, m_audio_samples);		// dwLength
+	put32(hdr, AVI_AUDIO_MAX * 4);		// dwSuggestedBufferSize
+	put32(hdr, 0xFFFFFFFF);			// dwQuality
+	put32(hdr, 4);				// dwSampleSize
+	put16(hdr, 0); put16(hdr, 0);		// rcFrame
+	put16(hdr, 0); put16(hdr, 0);
+
+	put32(hdr, FOURCC('s','t','r','f'));
+	put32(hdr, 16);
+	put16(hdr, 1);				// wFormatTag (PCM)
+	put16(hdr, 2);				// nChannels
+	put32(hdr, m_sample_rate);		// nSamplesPerSec
+	put32(hdr, m_sample_rate * 4);		// nAvgBytesPerSec
+	put16(hdr, 4);				// nBlockAlign
+	put16(hdr, 16);				// wBitsPerSample
+
+	set32(hdr, hdrl_size_pos, (uint32_t)(hdr.size() - hdrl_size_pos - 4));
+
+	// "movi" LIST.
+	put32(hdr, FOURCC('L','I','S','T'));
+	put32(hdr, movi_size);
+	put32(hdr, FOURCC('m','o','v','i'));
+}
+
+
+/**
+ * open(): Open an AVI file for writing.
+ * @param filename Filename.
+ * @param bpp Color depth. (15, 16, or 32)
+ * @param fps Frame rate.
+ * @param sample_rate Audio sample rate.
+ * @return 0 on success; non-zero on error.
+ */
+int AviWriter::open(const char *filename, int bpp, int fps, int sample_rate)
+{
+	close();
+
+	m_file = fopen(filename, "wb");
+	if (!m_file)
+		return -1;
+
+	// Use a large stdio buffer to keep the number of write() calls down.
+	setvbuf(m_file, NULL, _IOFBF, 1024*1024);
+
+	m_bpp = bpp;
+	m_fps = fps;
+	m_sample_rate = sample_rate;
+	m_video_frames = 0;
+	m_audio_samples = 0;
+	m_max_chunk = 0;
+	m_index.clear();
+
+	// Write placeholder headers. They're rewritten when the file is closed.
+	vector<uint8_t> hdr;
+	buildHeaders(hdr, 0, 0);
+	if (fwrite(&hdr[0], 1, hdr.size(), m_file) != hdr.size())
+	{
+		fclose(m_file);
+		m_file = NULL;
+		return -2;
+	}
+
+	m_pos = (uint32_t)hdr.size();
+	m_movi_pos = m_pos - 4;
+	return 0;
+}
+
+
+/**
+ * close(): Write the index, update the headers, and close the AVI file.
+ * @return 0 on success; non-zero on error.
+ */
+int AviWriter::close(void)
+{
+	if (!m_file)
+		return 0;
+
+	int ret = 0;
+	const uint32_t movi_size = m_pos - m_movi_pos;
+
+	// Write the index.
+	vector<uint8_t> idx;
+	idx.reserve(8 + (m_index.size() * 16));
+	put32(idx, FOURCC('i','d','x','1'));
+	put32(idx, (uint32_t)(m_index.size() * 16));
+	for (vector<IndexEntry>::const_iterator iter = m_index.begin();
+	     iter != m_index.end(); ++iter)
+	{
+		put32(idx, iter->fourcc);
+		put32(idx, iter->flags);
+		put32(idx, iter->offset);
+		put32(idx, iter->size);
+	}
+	if (fwrite(&idx[0], 1, idx.size(), m_file) != idx.size())
+		ret = -1;
+	m_pos += (uint32_t)idx.size();
+
+	// Rewrite the headers with the final values.
+	vector<uint8_t> hdr;
+	buildHeaders(hdr, m_pos - 8, movi_size);
+	if (fseek(m_file, 0, SEEK_SET) != 0 ||
+	    fwrite(&hdr[0], 1, hdr.size(), m_file) != hdr.size())
+	{
+		ret = -2;
+	}
+
+	if (fclose(m_file) != 0)
+		ret = -3;
+	m_file = NULL;
+	m_index.clear();
+	return ret;
+}
+
+
+/**
+ * writeChunk(): Write a chunk to the "movi" list.
+ * @param fourcc Chunk ID.
+ * @param data Chunk data.
+ * @param len Length of the chunk data.
+ * @param flags Index flags.
+ * @return 0 on success; non-zero on error.
+ */
+int AviWriter::writeChunk(uint32_t fourcc, const void *data, uint32_t len, uint32_t flags)
+{
+	uint8_t chunk_hdr[8];
+	for (int i = 0; i < 4; i++)
+	{
+		chunk_hdr[i] = (fourcc >> (i * 8)) & 0xFF;
+		chunk_hdr[i + 4] = (len >> (i * 8)) & 0xFF;
+	}
+
+	IndexEntry entry = {fourcc, flags, m_pos - m_movi_pos, len};
+	m_index.push_back(entry);
+
+	if (fwrite(chunk_hdr, 1, sizeof(chunk_hdr), m_file) != sizeof(chunk_hdr))
+		return -1;
+	if (len > 0 && fwrite(data, 1, len, m_file) != len)
+		return -2;
+	m_pos += sizeof(chunk_hdr) + len;
+
+	// Chunks are padded to 16-bit boundaries.
+	if (len & 1)
+	{
+		if (fputc(0, m_file) == EOF)
+			return -3;
+		m_pos++;
+	}
+
+	if (len > m_max_chunk)
+		m_max_chunk = len;
+	return 0;
+}
+
+
+/**
+ * writeVideo(): Write a video frame.
+ * An empty frame indicates that the previous frame is repeated.
+ * @param data Encoded frame data.
+ * @param len Length of the encoded frame data.
+ * @param keyframe If true, this is a keyframe.
+ * @return 0 on success; non-zero on error.
+ */
+int AviWriter::writeVideo(const uint8_t *data, size_t len, bool keyframe)
+{
+	m_video_frames++;
+	return writeChunk(FOURCC('0','0','d','c'), data, (uint32_t)len, (keyframe ? AVIIF_KEYFRAME : 0));
+}
+
+
+/**
+ * writeAudio(): Write an audio segment.
+ * @param data 16-bit stereo samples.
+ * @param samples Number of samples per channel.
+ * @return 0 on success; non-zero on error.
+ */
+int AviWriter::writeAudio(const int16_t *data, int samples)
+{
+	m_audio_samples += samples;
+	return writeChunk(FOURCC('0','1','w','b'), data, samples * 4, AVIIF_KEYFRAME);
+}
+
+
+/**
+ * avi_encoder_state_t: Encoder thread state.
+ */
+struct avi_encoder_state_t
+{
+	AviWriter writer;
+	ZmbvEncoder zmbv;
+	uint8_t *zmbv_buf;
+
+	// Current frame, with the image centered.
+	uint8_t canvas[AVI_WIDTH * AVI_HEIGHT * AVI_MAX_PIXEL_SIZE];
+	int canvas_width, canvas_height;
+
+	int bpp;
+	int part;
+	unsigned int frames_since_keyframe;
+};
+
+
+/**
+ * avi_encoder_open_part(): Open the next AVI file.
+ * @param state Encoder state.
+ * @param bpp Color depth.
+ * @return 0 on success; non-zero on error.
+ */
+static int avi_encoder_open_part(avi_encoder_state_t *state, int bpp)
+{
+	if (state->writer.isOpen())
+	{
+		if (state->writer.close() != 0)
+			return -1;
+	}
+
+	char filename[GENS_PATH_MAX];
+	if (state->part == 0)
+		szprintf(filename, sizeof(filename), "%s.avi", AVI_Filename_Base);
+	else
+		szprintf(filename, sizeof(filename), "%s_%d.avi", AVI_Filename_Base, state->part);
+	state->part++;
+
+	if (state->bpp != bpp)
+	{
+		if (state->zmbv.setup(AVI_WIDTH, AVI_HEIGHT, bpp) != 0)
+			return -2;
+
+		free(state->zmbv_buf);
+		state->zmbv_buf = (uint8_t*)malloc(state->zmbv.maxFrameSize());
+		if (!state->zmbv_buf)
+			return -3;
+
+		state->bpp = bpp;
+		memset(state->canvas, 0x00, sizeof(state->canvas));
+	}
+
+	if (state->writer.open(filename, bpp, AVI_FPS, AVI_Sample_Rate) != 0)
+		return -4;
+
+	// Each file starts with a keyframe.
+	state->frames_since_keyframe = AVI_KEYFRAME_INTERVAL;
+	return 0;
+}
+
+
+/**
+ * avi_encoder_process(): Encode a queued frame.
+ * @param state Encoder state.
+ * @param frame Queued frame.
+ * @return 0 on success; non-zero on error.
+ */
+static int avi_encoder_process(avi_encoder_state_t *state, const avi_frame_t *frame)
+{
+	// Start a new file if the color depth changed or the file is too big.
+	if (frame->bpp != state->bpp || !state->writer.isOpen() ||
+	    state->writer.size() >= AVI_MAX_FILE_SIZE)
+	{
+		if (avi_encoder_open_part(state, frame->bpp) != 0)
+			return -1;
+	}
+
+	// Dropped frames are written as empty video chunks (repeat the
+	// previous frame) with their own audio, to keep the streams in sync.
+	// If the audio queue was full too, silence is written instead.
+	if (frame->dropped_before > 0)
+	{
+		static const int16_t silence[AVI_AUDIO_MAX * 2] = {0};
+
+		// The queued segments are owned by this thread until they're released.
+		gsft_mutex_lock(&AVI_Mutex);
+		const int audio_head = AVI_Audio_Queue_Head;
+		gsft_mutex_unlock(&AVI_Mutex);
+
+		for (unsigned int i = 0; i < frame->dropped_before; i++)
+		{
+			if (state->writer.writeVideo(NULL, 0, false) != 0)
+				return -2;
+
+			int ret;
+			if (i < frame->dropped_audio)
+			{
+				const avi_audio_t *seg = &AVI_Audio_Queue[(audio_head + i) % AVI_AUDIO_QUEUE_SIZE];
+				ret = state->writer.writeAudio(seg->audio, seg->audio_len);
+			}
+			else
+			{
+				ret = state->writer.writeAudio(silence, frame->audio_len);
+			}
+			if (ret != 0)
+				return -3;
+		}
+	}
+
+	// Copy the frame to the canvas.
+	const int pixel_size = (frame->bpp == 32 ? 4 : 2);
+	if (frame->width != state->canvas_width || frame->height != state->canvas_height)
+	{
+		// Frame size changed. Clear the borders.
+		memset(state->canvas, 0x00, sizeof(state->canvas));
+		state->canvas_width = frame->width;
+		state->canvas_height = frame->height;
+	}
+
+	const int x = (AVI_WIDTH - frame->width) / 2;
+	const int y = (AVI_HEIGHT - frame->height) / 2;
+	const size_t line_size = (size_t)frame->width * pixel_size;
+	const uint8_t *src = frame->pixels;
+	uint8_t *dest = &state->canvas[((y * AVI_WIDTH) + x) * pixel_size];
+	for (int line = frame->height; line != 0; line--)
+	{
+		memcpy(dest, src, line_size);
+		src += line_size;
+		dest += (AVI_WIDTH * pixel_size);
+	}
+
+	// Encode the frame.
+	const bool keyframe = (state->frames_since_keyframe >= AVI_KEYFRAME_INTERVAL);
+	size_t len = state->zmbv.encodeFrame(state->canvas, keyframe, state->zmbv_buf);
+	if (len == 0)
+		return -4;
+	state->frames_since_keyframe = (keyframe ? 1 : state->frames_since_keyframe + 1);
+
+	if (state->writer.writeVideo(state->zmbv_buf, len, keyframe) != 0)
+		return -5;
+	if (state->writer.writeAudio(frame->audio, frame->audio_len) != 0)
+		return -6;
+
+	return 0;
+}
+
+
+/**
+ * avi_encoder_thread(): Encoder thread.
+ * @param param Unused.
+ * @return NULL.
+ */
+static void* avi_encoder_thread(void *param)
+{
+	((void)param);
+
+	avi_encoder_state_t *state = new avi_encoder_state_t;
+	state->zmbv_buf = NULL;
+	state->canvas_width = state->canvas_height = 0;
+	state->bpp = 0;
+	state->part = 0;
+	state->frames_since_keyframe = 0;
+
+	bool error = false;
+
+	gsft_mutex_lock(&AVI_Mutex);
+	while (true)
+	{
+		while (AVI_Queue_Count == 0 && !AVI_Quit)
+			gsft_cond_wait(&AVI_Cond, &AVI_Mutex);
+
+		// Drain the queue before quitting.
+		if (AVI_Queue_Count == 0)
+			break;
+
+		const avi_frame_t *frame = &AVI_Queue[AVI_Queue_Head];
+		gsft_mutex_unlock(&AVI_Mutex);
+
+		if (!error && avi_encoder_process(state, frame) != 0)
+			error = true;
+
+		gsft_mutex_lock(&AVI_Mutex);
+		AVI_Audio_Queue_Head = (AVI_Audio_Queue_Head + frame->dropped_audio) % AVI_AUDIO_QUEUE_SIZE;
+		AVI_Audio_Queue_Count -= frame->dropped_audio;
+		AVI_Queue_Head = (AVI_Queue_Head + 1) % AVI_QUEUE_SIZE;
+		AVI_Queue_Count--;
+		if (error)
+			AVI_Error = true;
+		gsft_cond_signal(&AVI_Cond);
+	}
+	gsft_mutex_unlock(&AVI_Mutex);
+
+	if (state->writer.isOpen() && state->writer.close() != 0)
+		error = true;
+	if (error)
+		LOG_MSG(video, LOG_MSG_LEVEL_ERROR, "Error writing AVI file '%s'.", AVI_Filename_Base);
+
+	free(state->zmbv_buf);
+	delete state;
+	return NULL;
+}
+
+
+/**
+ * avi_dump_start(): Start dumping an AVI file.
+ * @return 0 on success; non-zero on error.
+ */
+int avi_dump_start(void)
+{
+#ifdef GENS_OS_WIN32
+	// Make sure relative pathnames are handled correctly on Win32.
+	pSetCurrentDirectoryU(PathNames.Gens_Save_Path);
+#endif
+
+	// A game must be loaded in order to dump an AVI.
+	if (!Game)
+		return -1;
+
+	if (AVI_Dumping)
+	{
+		vdraw_text_write("AVI is already dumping.", 1000);
+		return -2;
+	}
+
+	// Build the filename.
+	char filename[GENS_PATH_MAX];
+	int num = -1;
+	do
+	{
+		num++;
+		szprintf(AVI_Filename_Base, sizeof(AVI_Filename_Base), "%s%s_%03d",
+			 PathNames.Dump_AVI_Dir, ROM_Filename, num);
+		szprintf(filename, sizeof(filename), "%s.avi", AVI_Filename_Base);
+	} while (!access(filename, F_OK));
+
+	// Allocate the frame queue.
+	AVI_Queue = (avi_frame_t*)malloc(AVI_QUEUE_SIZE * sizeof(avi_frame_t));
+	AVI_Audio_Queue = (avi_audio_t*)malloc(AVI_AUDIO_QUEUE_SIZE * sizeof(avi_audio_t));
+	if (!AVI_Queue || !AVI_Audio_Queue)
+	{
+		free(AVI_Queue);
+		free(AVI_Audio_Queue);
+		AVI_Queue = NULL;
+		AVI_Audio_Queue = NULL;
+		return -3;
+	}
+	AVI_Queue_Head = 0;
+	AVI_Queue_Count = 0;
+	AVI_Audio_Queue_Head = 0;
+	AVI_Audio_Queue_Count = 0;
+	AVI_Dropped_Pending = 0;
+	AVI_Dropped_Audio_Pending = 0;
+	AVI_Dropped_Total = 0;
+	AVI_Quit = false;
+	AVI_Error = false;
+
+	AVI_FPS = (CPU_Mode ? 50 : 60);
+	AVI_Sample_Rate = audio_get_sound_rate();
+
+	// Start the encoder thread.
+	gsft_mutex_init(&AVI_Mutex);
+	gsft_cond_init(&AVI_Cond);
+	if (gsft_thread_create(&AVI_Thread, avi_encoder_thread, NULL) != 0)
+	{
+		gsft_cond_destroy(&AVI_Cond);
+		gsft_mutex_destroy(&AVI_Mutex);
+		free(AVI_Queue);
+		free(AVI_Audio_Queue);
+		AVI_Queue = NULL;
+		AVI_Audio_Queue = NULL;
+		vdraw_text_write("Error starting the AVI encoder.", 1000);
+		return -4;
+	}
+
+	// AVI dump started.
+	vdraw_text_write("Starting to dump AVI.", 1000);
+	AVI_Dumping = 1;
+	Sync_Gens_Window_GraphicsMenu();
+	return 0;
+}
+
+
+/**
+ * avi_dump_stop(): Stop dumping an AVI file.
+ * Queued frames are encoded before the file is closed.
+ * @return 0 on success; non-zero on error.
+ */
+int avi_dump_stop(void)
+{
+	if (!AVI_Dumping)
+	{
+		vdraw_text_write("Not dumping AVI.", 1000);
+		return -1;
+	}
+
+	// Tell the encoder thread to finish.
+	gsft_mutex_lock(&AVI_Mutex);
+	AVI_Quit = true;
+	gsft_cond_signal(&AVI_Cond);
+	gsft_mutex_unlock(&AVI_Mutex);
+	gsft_thread_join(AVI_Thread);
+
+	const bool error = AVI_Error;
+	gsft_cond_destroy(&AVI_Cond);
+	gsft_mutex_destroy(&AVI_Mutex);
+	free(AVI_Queue);
+	free(AVI_Audio_Queue);
+	AVI_Queue = NULL;
+	AVI_Audio_Queue = NULL;
+	AVI_Dumping = 0;
+
+	// Report dropped frames.
+	const unsigned int dropped = AVI_Dropped_Total + AVI_Dropped_Pending;
+	if (dropped > 0)
+	{
+		LOG_MSG(video, LOG_MSG_LEVEL_WARNING,
+			"AVI dump '%s': %u frame(s) dropped.", AVI_Filename_Base, dropped);
+	}
+
+	if (error)
+		vdraw_text_write("Error writing AVI file.", 1500);
+	else if (dropped > 0)
+		vdraw_text_printf(1500, "AVI dump stopped. %u frame(s) dropped.", dropped);
+	else
+		vdraw_text_write("AVI dump stopped.", 1000);
+
+	Sync_Gens_Window_GraphicsMenu();
+	return (error ? -2 : 0);
+}
+
+
+/**
+ * avi_dump_update(): Queue the current frame for the AVI encoder.
+ * This is called on the emulation thread, so it only copies the frame.
+ * @param post_frame Frame information from MDP_EVENT_POST_FRAME.
+ * @return 0 on success; 1 if the frame was dropped; negative on error.
+ */
+int avi_dump_update(const mdp_event_post_frame_t *post_frame)
+{
+	if (!AVI_Dumping)
+		return -1;
+
+	gsft_mutex_lock(&AVI_Mutex);
+	if (AVI_Error)
+	{
+		gsft_mutex_unlock(&AVI_Mutex);
+		avi_dump_stop();
+		return -2;
+	}
+
+	if (AVI_Queue_Count >= AVI_QUEUE_SIZE)
+	{
+		// Encoder can't keep up. Drop the frame's video.
+		// The queued audio must belong to the first dropped frames in the run,
+		// so once one frame's audio is lost, the rest of the run is silent.
+		AVI_Dropped_Pending++;
+		if (AVI_Audio_Queue_Count >= AVI_AUDIO_QUEUE_SIZE ||
+		    AVI_Dropped_Audio_Pending != (AVI_Dropped_Pending - 1))
+		{
+			// The audio is lost. The encoder writes silence instead.
+			gsft_mutex_unlock(&AVI_Mutex);
+		}
+		else
+		{
+			// Keep the audio. The segment at the tail is owned by this thread until it's queued.
+			avi_audio_t *seg = &AVI_Audio_Queue[(AVI_Audio_Queue_Head + AVI_Audio_Queue_Count) % AVI_AUDIO_QUEUE_SIZE];
+			gsft_mutex_unlock(&AVI_Mutex);
+
+			seg->audio_len = audio_seg_length;
+			audio_dump_sound_stereo(seg->audio, audio_seg_length);
+
+			gsft_mutex_lock(&AVI_Mutex);
+			AVI_Audio_Queue_Count++;
+			AVI_Dropped_Audio_Pending++;
+			gsft_mutex_unlock(&AVI_Mutex);
+		}
+
+		vdraw_text_printf(1000, "AVI: %u frame(s) dropped.",
+				  AVI_Dropped_Total + AVI_Dropped_Pending);
+		return 1;
+	}
+
+	// The frame at the tail is owned by this thread until it's queued.
+	avi_frame_t *frame = &AVI_Queue[(AVI_Queue_Head + AVI_Queue_Count) % AVI_QUEUE_SIZE];
+	gsft_mutex_unlock(&AVI_Mutex);
+
+	frame->width = (post_frame->width > AVI_WIDTH ? AVI_WIDTH : post_frame->width);
+	frame->height = (post_frame->height > AVI_HEIGHT ? AVI_HEIGHT : post_frame->height);
+	frame->bpp = post_frame->bpp;
+
+	// Copy the image. (post_frame->pitch is in pixels.)
+	const int pixel_size = (frame->bpp == 32 ? 4 : 2);
+	const size_t line_size = (size_t)frame->width * pixel_size;
+	const size_t src_pitch = (size_t)post_frame->pitch * pixel_size;
+	const uint8_t *src = (const uint8_t*)post_frame->md_screen;
+	uint8_t *dest = frame->pixels;
+	for (int line = frame->height; line != 0; line--)
+	{
+		memcpy(dest, src, line_size);
+		src += src_pitch;
+		dest += line_size;
+	}
+
+	// Copy the audio segment.
+	frame->audio_len = audio_seg_length;
+	audio_dump_sound_stereo(frame->audio, audio_seg_length);
+
+	gsft_mutex_lock(&AVI_Mutex);
+	frame->dropped_before = AVI_Dropped_Pending;
+	frame->dropped_audio = AVI_Dropped_Audio_Pending;
+	AVI_Dropped_Total += AVI_Dropped_Pending;
+	AVI_Dropped_Pending = 0;
+	AVI_Dropped_Audio_Pending = 0;
+	AVI_Queue_Count++;
+	gsft_cond_signal(&AVI_Cond);
+	gsft_mutex_unlock(&AVI_Mutex);
+
+	return 0;
+}
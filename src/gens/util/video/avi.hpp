@@ -1,15 +1,12 @@
 /***************************************************************************
- * MDP: hq3x renderer. (x86 asm function prototypes)                       *
+ * Gens: AVI file handler.                                                 *
  *                                                                         *
- * Copyright (c) 1999-2002 by Stéphane Dallongeville                       *
- * Copyright (c) 2003-2004 by Stéphane Akhoun                              *
- * Copyright (c) 2008-2009 by David Korth                                  *
- * hq4x Copyright (c) 2003 by Maxim Stepin                                 *
+ * Copyright (c) 2008-2010 by David Korth                                  *
  *                                                                         *
  * This program is free software; you can redistribute it and/or modify it *
- * under the terms of the GNU Lesser General Public License as published   *
- * by the Free Software Foundation; either version 2.1 of the License, or  *
- * (at your option) any later version.                                     *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
  *                                                                         *
  * This program is distributed in the hope that it will be useful, but     *
  * WITHOUT ANY WARRANTY; without even the implied warranty of              *
@@ -21,23 +18,24 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
  ***************************************************************************/
 
-#ifndef MDP_RENDER_HQ3X_X86_H
-#define MDP_RENDER_HQ3X_X86_H
+#ifndef GENS_AVI_HPP
+#define GENS_AVI_HPP
 
-#include "mdp/mdp_stdint.h"
-#include "mdp/mdp_fncall.h"
+// MDP includes.
+#include "mdp/mdp_event.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-DLL_LOCAL void MDP_FNCALL mdp_render_hq3x_16_x86_mmx(
-				uint16_t *destScreen, uint16_t *mdScreen,
-				int destPitch, int srcPitch,
-				int width, int height, uint32_t vmodeFlags);
+extern int AVI_Dumping;
+
+int avi_dump_start(void);
+int avi_dump_stop(void);
+int avi_dump_update(const mdp_event_post_frame_t *post_frame);
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif /* MDP_RENDER_HQ3X_X86_H */
+#endif /* GENS_AVI_HPP */
@@ -0,0 +1,240 @@
+/***************************************************************************
+ * Gens: Zip Motion Blocks Video (ZMBV) encoder.                           *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "zmbv.hpp"
+
+// C includes.
+#include <stdlib.h>
+#include <string.h>
+
+// ZMBV constants.
+#define ZMBV_VERSION_HIGH	0
+#define ZMBV_VERSION_LOW	1
+#define ZMBV_COMPRESSION_ZLIB	1
+#define ZMBV_FORMAT_15BPP	5
+#define ZMBV_FORMAT_16BPP	6
+#define ZMBV_FORMAT_32BPP	8
+#define ZMBV_BLOCK_SIZE		16
+
+// Frame flags.
+#define ZMBV_FLAG_KEYFRAME	0x01
+
+// Keyframe header size. (flags byte not included)
+#define ZMBV_KEYFRAME_HEADER_SIZE 6
+
+// zlib compression level.
+// Level 1 is used to keep up with real-time capture.
+#define ZMBV_ZLIB_LEVEL		1
+
+
+ZmbvEncoder::ZmbvEncoder()
+{
+	m_prevFrame = NULL;
+	m_work = NULL;
+	m_zInit = false;
+	clear();
+}
+
+ZmbvEncoder::~ZmbvEncoder()
+{
+	clear();
+}
+
+
+/**
+ * clear(): Free all buffers.
+ */
+void ZmbvEncoder::clear(void)
+{
+	free(m_prevFrame);
+	free(m_work);
+	m_prevFrame = NULL;
+	m_work = NULL;
+	m_workSize = 0;
+	m_outSize = 0;
+	m_width = m_height = 0;
+	m_pixelSize = 0;
+	m_format = 0;
+	m_blocksX = m_blocksY = 0;
+	
+	if (m_zInit)
+	{
+		deflateEnd(&m_zstream);
+		m_zInit = false;
+	}
+}
+
+
+/**
+ * setup(): Set up the encoder.
+ * @param width Frame width.
+ * @param height Frame height.
+ * @param bpp Color depth. (15, 16, or 32)
+ * @return 0 on success; non-zero on error.
+ */
+int ZmbvEncoder::setup(int width, int height, int bpp)
+{
+	clear();
+	
+	switch (bpp)
+	{
+		case 15:
+			m_format = ZMBV_FORMAT_15BPP;
+			m_pixelSize = 2;
+			break;
+		case 16:
+			m_format = ZMBV_FORMAT_16BPP;
+			m_pixelSize = 2;
+			break;
+		case 32:
+			m_format = ZMBV_FORMAT_32BPP;
+			m_pixelSize = 4;
+			break;
+		default:
+			return -1;
+	}
+	
+	m_width = width;
+	m_height = height;
+	m_blocksX = (width + ZMBV_BLOCK_SIZE - 1) / ZMBV_BLOCK_SIZE;
+	m_blocksY = (height + ZMBV_BLOCK_SIZE - 1) / ZMBV_BLOCK_SIZE;
+	
+	// Work buffer: block vectors (aligned to 4 bytes) plus a full frame of XOR data.
+	const size_t frameSize = (size_t)width * height * m_pixelSize;
+	m_workSize = ((m_blocksX * m_blocksY * 2 + 3) & ~3) + frameSize;
+	
+	m_prevFrame = (uint8_t*)calloc(1, frameSize);
+	m_work = (uint8_t*)malloc(m_workSize);
+	if (!m_prevFrame || !m_work)
+	{
+		clear();
+		return -2;
+	}
+	
+	// Output buffer: flags, keyframe header, and deflate data.
+	m_outSize = 1 + ZMBV_KEYFRAME_HEADER_SIZE + deflateBound(NULL, m_workSize) + 64;
+	
+	memset(&m_zstream, 0x00, sizeof(m_zstream));
+	if (deflateInit(&m_zstream, ZMBV_ZLIB_LEVEL) != Z_OK)
+	{
+		clear();
+		return -3;
+	}
+	m_zInit = true;
+	
+	return 0;
+}
+
+
+/**
+ * encodeFrame(): Encode a frame.
+ * @param frame Frame data. (width * height pixels; no padding)
+ * @param keyframe If true, encode a keyframe.
+ * @param out Output buffer. (Must be at least maxFrameSize() bytes.)
+ * @return Size of the encoded frame, or 0 on error.
+ */
+size_t ZmbvEncoder::encodeFrame(const uint8_t *frame, bool keyframe, uint8_t *out)
+{
+	if (!m_zInit)
+		return 0;
+	
+	const size_t lineSize = (size_t)m_width * m_pixelSize;
+	size_t outPos = 0;
+	size_t workLen;
+	
+	if (keyframe)
+	{
+		out[outPos++] = ZMBV_FLAG_KEYFRAME;
+		out[outPos++] = ZMBV_VERSION_HIGH;
+		out[outPos++] = ZMBV_VERSION_LOW;
+		out[outPos++] = ZMBV_COMPRESSION_ZLIB;
+		out[outPos++] = m_format;
+		out[outPos++] = ZMBV_BLOCK_SIZE;
+		out[outPos++] = ZMBV_BLOCK_SIZE;
+		
+		// Keyframes restart the deflate stream.
+		deflateReset(&m_zstream);
+		
+		// Keyframe data is the raw frame.
+		workLen = lineSize * m_height;
+		memcpy(m_work, frame, workLen);
+	}
+	else
+	{
+		out[outPos++] = 0;
+		
+		// Delta frame: block vectors, followed by XOR data for changed blocks.
+		uint8_t *vectors = m_work;
+		workLen = ((m_blocksX * m_blocksY * 2 + 3) & ~3);
+		memset(vectors, 0x00, workLen);
+		
+		for (int by = 0; by < m_blocksY; by++)
+		{
+			const int y = by * ZMBV_BLOCK_SIZE;
+			const int bh = (m_height - y > ZMBV_BLOCK_SIZE ? ZMBV_BLOCK_SIZE : m_height - y);
+			
+			for (int bx = 0; bx < m_blocksX; bx++, vectors += 2)
+			{
+				const int x = bx * ZMBV_BLOCK_SIZE;
+				const int bw = (m_width - x > ZMBV_BLOCK_SIZE ? ZMBV_BLOCK_SIZE : m_width - x);
+				const size_t offset = (y * lineSize) + (x * m_pixelSize);
+				const size_t bwBytes = (size_t)bw * m_pixelSize;
+				
+				// Check if the block has changed.
+				const uint8_t *cur = frame + offset;
+				const uint8_t *prev = m_prevFrame + offset;
+				int line;
+				for (line = 0; line < bh; line++)
+				{
+					if (memcmp(cur + (line * lineSize), prev + (line * lineSize), bwBytes) != 0)
+						break;
+				}
+				if (line == bh)
+					continue;
+				
+				// Block has changed. Add the XOR data.
+				vectors[0] = 1;
+				uint8_t *dest = m_work + workLen;
+				for (line = 0; line < bh; line++)
+				{
+					const uint8_t *c = cur + (line * lineSize);
+					const uint8_t *p = prev + (line * lineSize);
+					for (size_t i = 0; i < bwBytes; i++)
+						*dest++ = c[i] ^ p[i];
+				}
+				workLen += (bh * bwBytes);
+			}
+		}
+	}
+	
+	// Compress the work buffer.
+	m_zstream.next_in = m_work;
+	m_zstream.avail_in = (uInt)workLen;
+	m_zstream.next_out = out + outPos;
+	m_zstream.avail_out = (uInt)(m_outSize - outPos);
+	m_zstream.total_out = 0;
+	if (deflate(&m_zstream, Z_SYNC_FLUSH) != Z_OK || m_zstream.avail_in != 0)
+		return 0;
+	outPos += m_zstream.total_out;
+	
+	// Save the current frame for the next delta.
+	memcpy(m_prevFrame, frame, lineSize * m_height);
+	return outPos;
+}
@@ -0,0 +1,78 @@
+/***************************************************************************
+ * Gens: Zip Motion Blocks Video (ZMBV) encoder.                           *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef GENS_ZMBV_HPP
+#define GENS_ZMBV_HPP
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+// zlib
+#include <zlib.h>
+
+/**
+ * ZmbvEncoder: Lossless ZMBV video encoder.
+ * ZMBV is the DOSBox capture codec. Frames are split into 16x16 blocks;
+ * changed blocks are XOR'd against the previous frame, and the result
+ * is compressed with a continuous deflate stream.
+ * Motion vectors are not searched; all blocks use a (0,0) vector.
+ */
+class ZmbvEncoder
+{
+	public:
+		ZmbvEncoder();
+		~ZmbvEncoder();
+		
+		int setup(int width, int height, int bpp);
+		
+		size_t maxFrameSize(void) const { return m_outSize; }
+		
+		size_t encodeFrame(const uint8_t *frame, bool keyframe, uint8_t *out);
+	
+	protected:
+		void clear(void);
+		
+		int m_width, m_height;
+		int m_pixelSize;
+		uint8_t m_format;
+		
+		// Blocks.
+		int m_blocksX, m_blocksY;
+		
+		// Previous frame.
+		uint8_t *m_prevFrame;
+		
+		// Work buffer. (Uncompressed frame data.)
+		uint8_t *m_work;
+		size_t m_workSize;
+		
+		// Maximum output size.
+		size_t m_outSize;
+		
+		// zlib stream.
+		z_stream m_zstream;
+		bool m_zInit;
+};
+
+#endif /* GENS_ZMBV_HPP */
@@ -389,4 +389,7 @@ void veffect_pause_tint(void)
 			T_veffect_pause_tint<uint16_t, 0x7C00, 0x03E0, 0x001F, 10, 5, 0>(MD_Screen.u16);
 			break;
 	}
+	
+	// The whole screen has been redrawn.
+	VDP_Dirty_Lines_Mark_All();
 }
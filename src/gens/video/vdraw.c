@@ -33,6 +33,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+// libgsft includes.
+#include "libgsft/gsft_strlcpy.h"
+
 // MDP Host Services.
 #include "mdp/mdp.h"
 #include "mdp/mdp_host.h"
@@ -52,9 +55,18 @@
 #include "vdraw_cpp.hpp"
 #include "osd_charset.hpp"
 
+// Multi-threaded rendering.
+#include "vdraw_mt.h"
+
+// Threaded presentation.
+#include "vdraw_present.h"
+
 // Gens window.
 #include "gens/gens_window_sync.hpp"
 
+// Debugger.
+#include "debugger/debugger.hpp"
+
 // Timer functionality.
 #ifndef GENS_OS_WIN32
 #include "port/timer.h"
@@ -111,6 +123,7 @@ uint32_t vdraw_cur_backend_flags = 0;
 
 // Function pointers.
 static int	(*vdraw_flip_backend)(void) = NULL;
+static int	(*vdraw_present_backend)(const vdraw_present_frame_t *frame) = NULL;
 void		(*vdraw_clear_screen)(void) = NULL;
 void		(*vdraw_update_vsync)(const int data) = NULL;
 int		(*vdraw_reinit_gens_window)(void) = NULL;
@@ -166,6 +179,13 @@ int		vdraw_border_h = 0, vdraw_border_h_old = ~0;
 #include "vdraw_RGB.h"
 BOOL		vdraw_needs_conversion = FALSE;
 
+// Dirty line rendering.
+// The map has MDP_RENDER_DIRTY_LINES_PAD extra entries above and below the image.
+BOOL		vdraw_dirty_lines_supported = FALSE;
+static BOOL	vdraw_dirty_lines_all = TRUE;
+static uint8_t	vdraw_dirty_lines[MDP_RENDER_DIRTY_LINES_PAD + 240 + MDP_RENDER_DIRTY_LINES_PAD];
+static int	vdraw_dirty_text_lines = 0;	// MD lines covered by the previous frame's text.
+
 
 /**
  * vdraw_init(): Initialize the Video Drawing subsystem.
@@ -194,12 +214,18 @@ int vdraw_init(void)
  */
 int vdraw_end(void)
 {
+	// Shut down the presentation thread.
+	vdraw_present_end();
+	
 	if (vdraw_cur_backend)
 	{
 		vdraw_cur_backend->end();
 		vdraw_cur_backend = NULL;
 	}
 	
+	// Shut down the render threads.
+	vdraw_mt_end();
+	
 	// Shut down the OSD subsystem.
 	osd_end();
 	
@@ -221,6 +247,9 @@ int vdraw_backend_init(VDRAW_BACKEND backend)
 		return -1;
 	}
 	
+	// The presentation thread is restarted by the next vdraw_flip().
+	vdraw_present_end();
+	
 #ifdef GENS_OS_WIN32
 	// Initialize the display size.
 	vdraw_init_display_size();
@@ -261,6 +290,7 @@ int vdraw_backend_init(VDRAW_BACKEND backend)
 	
 	// Copy the function pointers.
 	vdraw_flip_backend		= vdraw_cur_backend->flip;
+	vdraw_present_backend		= vdraw_cur_backend->present;
 	vdraw_clear_screen		= vdraw_cur_backend->clear_screen;
 	vdraw_update_vsync		= vdraw_cur_backend->update_vsync;
 	vdraw_reinit_gens_window	= vdraw_cur_backend->reinit_gens_window;
@@ -293,6 +323,7 @@ int vdraw_backend_end(void)
 	if (!vdraw_cur_backend)
 		return 1;
 	
+	vdraw_present_end();
 	if (vdraw_cur_backend->end)
 		vdraw_cur_backend->end();
 	
@@ -301,6 +332,62 @@ int vdraw_backend_end(void)
 }
 
 
+/**
+ * vdraw_dirty_lines_invalidate(): The renderer must redraw the whole image on the next frame.
+ * Call this if the destination buffer's contents are lost.
+ */
+void vdraw_dirty_lines_invalidate(void)
+{
+	vdraw_dirty_lines_all = TRUE;
+}
+
+
+/**
+ * vdraw_dirty_lines_update(): Update the dirty line map for the next blit.
+ * @param frame Frame being presented. (frame->rInfo is updated.)
+ */
+static void vdraw_dirty_lines_update(vdraw_present_frame_t *frame)
+{
+	uint8_t *lines = &vdraw_dirty_lines[MDP_RENDER_DIRTY_LINES_PAD];
+	
+	if (!vdraw_dirty_lines_supported ||
+	    !(vdraw_cur_backend_flags & VDRAW_BACKEND_FLAG_PERSISTENT))
+	{
+		// The renderer will redraw the whole image.
+		frame->rInfo.vmodeFlags &= ~MDP_RENDER_VMODE_DIRTY_LINES;
+		frame->rInfo.dirtyLines = NULL;
+		vdraw_dirty_lines_all = TRUE;
+		return;
+	}
+	
+	if (vdraw_dirty_lines_all || frame->dirty_all)
+	{
+		// Redraw everything.
+		memset(vdraw_dirty_lines, 0x01, sizeof(vdraw_dirty_lines));
+		vdraw_dirty_lines_all = FALSE;
+	}
+	else
+	{
+		memset(vdraw_dirty_lines, 0x00, sizeof(vdraw_dirty_lines));
+		memcpy(lines, frame->dirty, sizeof(VDP_Dirty_Lines));
+		
+		// The previous frame's text was drawn on top of the renderer's output.
+		if (vdraw_dirty_text_lines > 0)
+		{
+			const int bottom = frame->lines_border + frame->lines_visible;
+			int top = bottom - vdraw_dirty_text_lines;
+			if (top < 0)
+				top = 0;
+			if (bottom > top)
+				memset(&lines[top], 0x01, bottom - top);
+		}
+	}
+	
+	frame->rInfo.dirtyLines = lines;
+	frame->rInfo.vmodeFlags |= MDP_RENDER_VMODE_DIRTY_LINES;
+}
+
+
 #ifdef GENS_OS_WIN32
 RECT vdraw_rectDisplay;
 /**
@@ -342,6 +429,93 @@ void WINAPI vdraw_init_display_size(void)
 #endif
 
 
+/**
+ * vdraw_present_frame(): Present a finished frame.
+ * Called by vdraw_flip(), or on the presentation thread.
+ * The emulation thread may be running, so only the frame and the
+ * presentation state (dirty line map, text rows) may be used here.
+ * @param frame Frame.
+ * @return 0 on success; non-zero on error.
+ */
+static int vdraw_present_frame(vdraw_present_frame_t *frame)
+{
+	if (frame->resized)
+	{
+		// Display width change. Adjust the stretch parameters.
+		if (vdraw_cur_backend->stretch_adjust)
+			vdraw_cur_backend->stretch_adjust();
+		vdraw_dirty_lines_all = TRUE;
+	}
+	
+	if (frame->clear)
+	{
+		// New screen width is smaller than old screen width.
+		// Clear the screen.
+		vdraw_clear_screen();
+	}
+	
+	// Set up the dirty line map.
+	vdraw_dirty_lines_update(frame);
+	vdraw_text_rows = 0;
+	
+	// Flip the screen buffer.
+	int ret;
+	if (vdraw_present_backend)
+	{
+		ret = vdraw_present_backend(frame);
+	}
+	else
+	{
+		// flip() renders from vdraw_rInfo.
+		// Backends without present() never run on the presentation thread.
+		vdraw_rInfo.vmodeFlags = frame->rInfo.vmodeFlags;
+		vdraw_rInfo.dirtyLines = frame->rInfo.dirtyLines;
+		ret = vdraw_flip_backend();
+	}
+	
+	// Lines covered by text have to be redrawn on the next frame.
+	vdraw_dirty_text_lines = (vdraw_text_rows + vdraw_scale - 1) / vdraw_scale;
+	return ret;
+}
+
+
+/**
+ * vdraw_fill_frame(): Copy the display state for the current frame.
+ * @param frame Frame.
+ * @param mdScreen MD screen buffer to render from. (frame->screen or MD_Screen)
+ */
+static void vdraw_fill_frame(vdraw_present_frame_t *frame, void *mdScreen)
+{
+	// Render information.
+	frame->rInfo = vdraw_rInfo;
+	frame->rInfo.mdScreen = (uint8_t*)mdScreen + ((uint8_t*)vdraw_rInfo.mdScreen - (uint8_t*)&MD_Screen);
+	
+	// Display size.
+	frame->h_pix = vdp_getHPix();
+	frame->lines_visible = VDP_Lines.Visible.Total;
+	frame->lines_border = VDP_Lines.Visible.Border_Size;
+	
+	// Onscreen text.
+	if (vdraw_msg_visible)
+	{
+		// Message is visible.
+		strlcpy(frame->text, vdraw_msg_text, sizeof(frame->text));
+		frame->text_style = vdraw_msg_style;
+	}
+	else if (vdraw_fps_enabled && (Game != NULL) && Settings.Active && !Settings.Paused && !IS_DEBUGGING())
+	{
+		// FPS is enabled.
+		strlcpy(frame->text, vdraw_msg_text, sizeof(frame->text));
+		frame->text_style = vdraw_fps_style;
+	}
+	else
+	{
+		// No text.
+		frame->text[0] = 0x00;
+	}
+}
+
+
 /**
  * vdraw_flip(): Flip the screen buffer.
  * @param md_screen_updated Non-zero if the MD screen has been updated.
@@ -349,6 +523,8 @@ void WINAPI vdraw_init_display_size(void)
  */
 int vdraw_flip(int md_screen_updated)
 {
+	BOOL dirty_all = FALSE;
+	
 	if (md_screen_updated)
 	{
 		// MD screen is updated.
@@ -453,30 +629,61 @@ int vdraw_flip(int md_screen_updated)
 		// Blur the screen if requested.
 		if (vdraw_prop_fast_blur)
 			Fast_Blur();
+		
+		// Intro effects, Fast Blur, and the debugger
+		// draw to MD_Screen outside of the VDP.
+		if (Game == NULL || vdraw_prop_fast_blur || IS_DEBUGGING())
+			dirty_all = TRUE;
 	}
 	
 	// Check if the display width changed.
 	// TODO: Eliminate this.
 	vdraw_border_h_old = vdraw_border_h;
 	vdraw_border_h = vdp_getHPixBegin() * 2;
+	const BOOL resized = (vdraw_border_h != vdraw_border_h_old);
 	
-	if (vdraw_border_h != vdraw_border_h_old)
+	// If the border got bigger, the new screen width is smaller
+	// than the old screen width, so the screen has to be cleared.
+	// TODO: This check seems to be inverted...
+	const BOOL clear = (vdraw_border_h > vdraw_border_h_old);
+	
+	// Start the presentation thread if the backend supports it.
+	if ((vdraw_cur_backend_flags & VDRAW_BACKEND_FLAG_THREADED) && vdraw_present_backend &&
+	    vdraw_present_get_enabled() && !vdraw_present_is_running())
 	{
-		// Display width change. Adjust the stretch parameters.
-		if (vdraw_cur_backend->stretch_adjust)
-			vdraw_cur_backend->stretch_adjust();
+		vdraw_present_start(sizeof(MD_Screen), vdraw_present_frame,
+				    vdraw_cur_backend->set_current);
 	}
 	
-	// TODO: This check seems to be inverted...
-	if (vdraw_border_h > vdraw_border_h_old)
+	if (vdraw_present_is_running())
 	{
-		// New screen width is smaller than old screen width.
-		// Clear the screen.
-		vdraw_clear_screen();
+		// Copy the frame and hand it to the presentation thread.
+		vdraw_present_frame_t *frame = vdraw_present_get_frame();
+		memcpy(frame->screen, &MD_Screen,
+		       (bppMD == 32 ? sizeof(MD_Screen.u32) : sizeof(MD_Screen.u16)));
+		memcpy(frame->dirty, VDP_Dirty_Lines, sizeof(VDP_Dirty_Lines));
+		frame->dirty_all = dirty_all;
+		frame->resized = resized;
+		frame->clear = clear;
+		vdraw_fill_frame(frame, frame->screen);
+		memset(VDP_Dirty_Lines, 0x00, sizeof(VDP_Dirty_Lines));
+		
+		vdraw_present_submit();
+		return 0;
 	}
 	
-	// Flip the screen buffer.
-	return vdraw_flip_backend();
+	// Present the frame on this thread.
+	vdraw_present_frame_t frame;
+	frame.screen = &MD_Screen;
+	frame.dirty = VDP_Dirty_Lines;
+	frame.dirty_all = dirty_all;
+	frame.resized = resized;
+	frame.clear = clear;
+	vdraw_fill_frame(&frame, &MD_Screen);
+	
+	const int ret = vdraw_present_frame(&frame);
+	memset(VDP_Dirty_Lines, 0x00, sizeof(VDP_Dirty_Lines));
+	return ret;
 }
 
 
@@ -491,6 +698,7 @@ void vdraw_set_bpp(const int new_bpp, const BOOL reset_video)
 		return;
 	
 	bppOut = new_bpp;
+	vdraw_present_end();
 	
 	if (reset_video && vdraw_cur_backend)
 	{
@@ -525,6 +733,7 @@ void vdraw_set_bpp(const int new_bpp, const BOOL reset_video)
  */
 void vdraw_refresh_video(void)
 {
+	vdraw_present_end();
 	if (vdraw_cur_backend)
 	{
 		vdraw_cur_backend->end();
@@ -555,7 +764,10 @@ void vdraw_set_stretch(const uint8_t new_stretch)
 	
 	vdraw_prop_stretch = new_stretch;
 	if (vdraw_cur_backend && vdraw_cur_backend->stretch_adjust)
+	{
+		vdraw_present_end();
 		vdraw_cur_backend->stretch_adjust();
+	}
 }
 
 
@@ -635,6 +847,9 @@ void vdraw_set_fullscreen(const BOOL new_fullscreen)
 	if (vdraw_prop_fullscreen)
 		Settings.Active = 1;
 	
+	// The presentation thread is restarted by the next vdraw_flip().
+	vdraw_present_end();
+	
 	// Reset the renderer.
 	vdraw_reset_renderer(FALSE);
 	
@@ -46,6 +46,7 @@ extern "C" {
 
 // Text drawing functions.
 #include "vdraw_text.hpp"
+#include "vdraw_present.h"
 
 
 // VDraw backends.
@@ -73,6 +74,8 @@ extern uint8_t vdraw_backends_broken[VDRAW_BACKEND_MAX];
 #define VDRAW_BACKEND_FLAG_VSYNC	((uint32_t)(1 << 1))
 #define VDRAW_BACKEND_FLAG_FULLSCREEN	((uint32_t)(1 << 2))
 #define VDRAW_BACKEND_FLAG_WINRESIZE	((uint32_t)(1 << 3))
+#define VDRAW_BACKEND_FLAG_PERSISTENT	((uint32_t)(1 << 4))	// destScreen keeps the previous frame.
+#define VDRAW_BACKEND_FLAG_THREADED	((uint32_t)(1 << 5))	// present() can run on the presentation thread.
 
 // VDraw backend function pointers.
 typedef struct
@@ -86,11 +89,17 @@ typedef struct
 	void	(*clear_screen)(void);			// Must be set.
 	void	(*update_vsync)(const int data);	// May be NULL.
 	
-	int	(*flip)(void);			// Must be set.
+	int	(*flip)(void);			// Must be set if present is NULL.
 	void	(*stretch_adjust)(void);	// May be NULL.
 	void	(*update_renderer)(void);	// May be NULL.
 	int	(*reinit_gens_window)(void);	// Must be set.
 	
+	// Threaded presentation. (Must be set if VDRAW_BACKEND_FLAG_THREADED is set.)
+	// present() is used instead of flip(). It may only use the frame
+	// and the backend's own state.
+	int	(*present)(const vdraw_present_frame_t *frame);
+	void	(*set_current)(const BOOL current);
+	
 #ifdef GENS_OS_WIN32
 	// Win32-specific functions.
 	int	WINAPI (*clear_primary_screen)(void);
@@ -185,6 +194,10 @@ extern int vdraw_border_h, vdraw_border_h_old;
 // RGB color conversion variables.
 extern BOOL vdraw_needs_conversion;
 
+// Dirty line rendering.
+extern BOOL vdraw_dirty_lines_supported;
+void	vdraw_dirty_lines_invalidate(void);
+
 #ifdef __cplusplus
 }
 #endif
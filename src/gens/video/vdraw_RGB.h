@@ -31,6 +31,10 @@ extern "C" {
 
 void vdraw_rgb_convert(mdp_render_info_t *rInfo);
 
+int vdraw_rgb_convert_image(void *dst, int dstPitch, uint32_t dstMode,
+			    const void *src, int srcPitch, uint32_t srcMode,
+			    int width, int height, uint32_t cpuFlags);
+
 #ifdef __cplusplus
 }
 #endif
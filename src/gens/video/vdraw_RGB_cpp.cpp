@@ -0,0 +1,270 @@
+/***************************************************************************
+ * Gens: Video Drawing - RGB Color Conversion Functions. (Converters)      *
+ *                                                                         *
+ * Copyright (c) 1999-2002 by Stéphane Dallongeville                       *
+ * Copyright (c) 2003-2004 by Stéphane Akhoun                              *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "vdraw_RGB.h"
+
+// MDP includes.
+#include "mdp/mdp_stdint.h"
+#include "mdp/mdp_cpuflags.h"
+#include "mdp/mdp_error.h"
+
+// SIMD intrinsics.
+#include "libgsft/gsft_simd.h"
+
+// C includes.
+#include <stddef.h>
+
+/**
+ * rgb_row_fn: Row conversion function.
+ * @param dst Destination row.
+ * @param src Source row.
+ * @param width Number of pixels.
+ */
+typedef void (*rgb_row_fn)(void *dst, const void *src, int width);
+
+
+/** Scalar version. Also used for the end of each row in the SIMD versions. **/
+namespace rgb_scalar
+{
+	/**
+	 * rgb_px(): Convert a pixel.
+	 * 15/16-bit to 32-bit conversions leave the low 3 bits of each
+	 * component clear, same as the original lookup table.
+	 */
+	template<uint32_t srcMode, uint32_t dstMode>
+	static inline uint32_t rgb_px(uint32_t p)
+	{
+		if (srcMode == MDP_RENDER_VMODE_RGB_555 && dstMode == MDP_RENDER_VMODE_RGB_888)
+			return ((p & 0x7C00) << 9) | ((p & 0x03E0) << 6) | ((p & 0x001F) << 3);
+		else if (srcMode == MDP_RENDER_VMODE_RGB_565 && dstMode == MDP_RENDER_VMODE_RGB_888)
+			return ((p & 0xF800) << 8) | ((p & 0x07E0) << 5) | ((p & 0x001F) << 3);
+		else if (srcMode == MDP_RENDER_VMODE_RGB_888 && dstMode == MDP_RENDER_VMODE_RGB_555)
+			return ((p >> 9) & 0x7C00) | ((p >> 6) & 0x03E0) | ((p >> 3) & 0x001F);
+		else if (srcMode == MDP_RENDER_VMODE_RGB_888 && dstMode == MDP_RENDER_VMODE_RGB_565)
+			return ((p >> 8) & 0xF800) | ((p >> 5) & 0x07E0) | ((p >> 3) & 0x001F);
+		else if (srcMode == MDP_RENDER_VMODE_RGB_555)
+			return ((p << 1) & 0xFFC0) | (p & 0x001F);	// 555 to 565.
+		else
+			return ((p >> 1) & 0x7FE0) | (p & 0x001F);	// 565 to 555.
+	}
+
+	/**
+	 * rgb_row(): Convert part of a row of pixels.
+	 * @param dst Destination row.
+	 * @param src Source row.
+	 * @param x First pixel.
+	 * @param width Number of pixels in the row.
+	 */
+	template<uint32_t srcMode, uint32_t dstMode>
+	static void rgb_row(void *dst, const void *src, int x, int width)
+	{
+		if (srcMode == MDP_RENDER_VMODE_RGB_888)
+		{
+			const uint32_t *s = (const uint32_t*)src;
+			uint16_t *d = (uint16_t*)dst;
+			for (; x < width; x++)
+				d[x] = (uint16_t)rgb_px<srcMode, dstMode>(s[x]);
+		}
+		else if (dstMode == MDP_RENDER_VMODE_RGB_888)
+		{
+			const uint16_t *s = (const uint16_t*)src;
+			uint32_t *d = (uint32_t*)dst;
+			for (; x < width; x++)
+				d[x] = rgb_px<srcMode, dstMode>(s[x]);
+		}
+		else
+		{
+			const uint16_t *s = (const uint16_t*)src;
+			uint16_t *d = (uint16_t*)dst;
+			for (; x < width; x++)
+				d[x] = (uint16_t)rgb_px<srcMode, dstMode>(s[x]);
+		}
+	}
+
+	template<uint32_t srcMode, uint32_t dstMode>
+	static void rgb_row(void *dst, const void *src, int width)
+		{ rgb_row<srcMode, dstMode>(dst, src, 0, width); }
+
+	static inline rgb_row_fn rgb_row_select(uint32_t srcMode, uint32_t dstMode)
+	{
+#define RGB_ROW_CASE(src, dst) \
+	if (srcMode == MDP_RENDER_VMODE_RGB_##src && dstMode == MDP_RENDER_VMODE_RGB_##dst) \
+		return rgb_row<MDP_RENDER_VMODE_RGB_##src, MDP_RENDER_VMODE_RGB_##dst>;
+
+		RGB_ROW_CASE(555, 565);
+		RGB_ROW_CASE(555, 888);
+		RGB_ROW_CASE(565, 555);
+		RGB_ROW_CASE(565, 888);
+		RGB_ROW_CASE(888, 555);
+		RGB_ROW_CASE(888, 565);
+#undef RGB_ROW_CASE
+
+		return NULL;
+	}
+}
+
+
+/**
+ * ops: Vector operations used by the kernels.
+ * - vec: Vector type.
+ * - N16, N32: Number of 16-bit and 32-bit lanes in vec.
+ * - load(), store(), set16(), set32(): Load and store vectors.
+ * - vand(), vor(): Bitwise operations.
+ * - sll16(), srl16(), sll32(), srl32(): Shift each lane.
+ * - widen(): Zero-extend 16-bit lanes to two vectors of 32-bit lanes.
+ * - narrow(): Pack two vectors of 32-bit lanes (0-0xFFFF) to 16-bit lanes.
+ */
+
+/** SIMD versions. **/
+
+#if defined(GSFT_SIMD_SSE2)
+GSFT_SIMD_BEGIN_SSE2
+namespace rgb_sse2
+{
+	struct ops
+	{
+		typedef __m128i vec;
+		enum { N16 = 8, N32 = 4 };
+
+		static inline vec load(const void *p)		{ return _mm_loadu_si128((const __m128i*)p); }
+		static inline void store(void *p, vec a)	{ _mm_storeu_si128((__m128i*)p, a); }
+		static inline vec set16(uint16_t n)		{ return _mm_set1_epi16((short)n); }
+		static inline vec set32(uint32_t n)		{ return _mm_set1_epi32((int)n); }
+		static inline vec vand(vec a, vec b)		{ return _mm_and_si128(a, b); }
+		static inline vec vor(vec a, vec b)		{ return _mm_or_si128(a, b); }
+		static inline vec sll16(vec a, int n)		{ return _mm_slli_epi16(a, n); }
+		static inline vec srl16(vec a, int n)		{ return _mm_srli_epi16(a, n); }
+		static inline vec sll32(vec a, int n)		{ return _mm_slli_epi32(a, n); }
+		static inline vec srl32(vec a, int n)		{ return _mm_srli_epi32(a, n); }
+
+		static inline void widen(vec a, vec &lo, vec &hi)
+		{
+			lo = _mm_unpacklo_epi16(a, _mm_setzero_si128());
+			hi = _mm_unpackhi_epi16(a, _mm_setzero_si128());
+		}
+
+		/**
+		 * SSE2 only has a signed 32-bit pack.
+		 * Sign-extend the low 16 bits first so it doesn't saturate.
+		 */
+		static inline vec narrow(vec a, vec b)
+		{
+			return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(a, 16), 16),
+					       _mm_srai_epi32(_mm_slli_epi32(b, 16), 16));
+		}
+	};
+
+#include "vdraw_RGB_kernel.hpp"
+}
+GSFT_SIMD_END
+#endif /* GSFT_SIMD_SSE2 */
+
+#if defined(GSFT_SIMD_AVX2)
+GSFT_SIMD_BEGIN_AVX2
+namespace rgb_avx2
+{
+	struct ops
+	{
+		typedef __m256i vec;
+		enum { N16 = 16, N32 = 8 };
+
+		static inline vec load(const void *p)		{ return _mm256_loadu_si256((const __m256i*)p); }
+		static inline void store(void *p, vec a)	{ _mm256_storeu_si256((__m256i*)p, a); }
+		static inline vec set16(uint16_t n)		{ return _mm256_set1_epi16((short)n); }
+		static inline vec set32(uint32_t n)		{ return _mm256_set1_epi32((int)n); }
+		static inline vec vand(vec a, vec b)		{ return _mm256_and_si256(a, b); }
+		static inline vec vor(vec a, vec b)		{ return _mm256_or_si256(a, b); }
+		static inline vec sll16(vec a, int n)		{ return _mm256_slli_epi16(a, n); }
+		static inline vec srl16(vec a, int n)		{ return _mm256_srli_epi16(a, n); }
+		static inline vec sll32(vec a, int n)		{ return _mm256_slli_epi32(a, n); }
+		static inline vec srl32(vec a, int n)		{ return _mm256_srli_epi32(a, n); }
+
+		/**
+		 * AVX2 unpack and pack instructions work within 128-bit lanes.
+		 * Swap the middle 64-bit quarters to get the results in order.
+		 */
+		static inline void widen(vec a, vec &lo, vec &hi)
+		{
+			a = _mm256_permute4x64_epi64(a, 0xD8);
+			lo = _mm256_unpacklo_epi16(a, _mm256_setzero_si256());
+			hi = _mm256_unpackhi_epi16(a, _mm256_setzero_si256());
+		}
+
+		static inline vec narrow(vec a, vec b)
+		{
+			a = _mm256_srai_epi32(_mm256_slli_epi32(a, 16), 16);
+			b = _mm256_srai_epi32(_mm256_slli_epi32(b, 16), 16);
+			return _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xD8);
+		}
+	};
+
+#include "vdraw_RGB_kernel.hpp"
+}
+GSFT_SIMD_END
+#endif /* GSFT_SIMD_AVX2 */
+
+
+/**
+ * vdraw_rgb_convert_image(): Convert an image from one color mode to another.
+ * @param dst Destination image.
+ * @param dstPitch Destination pitch, in bytes.
+ * @param dstMode Destination color mode. (MDP_RENDER_VMODE_RGB_*)
+ * @param src Source image.
+ * @param srcPitch Source pitch, in bytes.
+ * @param srcMode Source color mode. (MDP_RENDER_VMODE_RGB_*)
+ * @param width Width, in pixels.
+ * @param height Height, in pixels.
+ * @param cpuFlags CPU flags.
+ * @return MDP error code.
+ */
+int vdraw_rgb_convert_image(void *dst, int dstPitch, uint32_t dstMode,
+			    const void *src, int srcPitch, uint32_t srcMode,
+			    int width, int height, uint32_t cpuFlags)
+{
+	rgb_row_fn rgb_row = rgb_scalar::rgb_row_select(srcMode, dstMode);
+	if (!rgb_row)
+		return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
+
+#if defined(GSFT_SIMD_AVX2)
+	if (cpuFlags & MDP_CPUFLAG_X86_AVX2)
+		rgb_row = rgb_avx2::rgb_row_select(srcMode, dstMode);
+	else
+#endif
+#if defined(GSFT_SIMD_SSE2)
+#if !defined(GSFT_SIMD_SSE2_ALWAYS)
+	if (cpuFlags & MDP_CPUFLAG_X86_SSE2)
+#endif
+		rgb_row = rgb_sse2::rgb_row_select(srcMode, dstMode);
+#endif
+	((void)cpuFlags);
+
+	const uint8_t *s = (const uint8_t*)src;
+	uint8_t *d = (uint8_t*)dst;
+	for (int y = 0; y < height; y++)
+	{
+		rgb_row(d, s, width);
+		s += srcPitch;
+		d += dstPitch;
+	}
+
+	return MDP_ERR_OK;
+}
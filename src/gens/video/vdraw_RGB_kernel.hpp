@@ -0,0 +1,157 @@
+/***************************************************************************
+ * Gens: Video Drawing - RGB Color Conversion Functions. (SIMD kernels)    *
+ *                                                                         *
+ * Copyright (c) 1999-2002 by Stéphane Dallongeville                       *
+ * Copyright (c) 2003-2004 by Stéphane Akhoun                              *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * This file is included once for each instruction set by vdraw_RGB_cpp.cpp.
+ * There are no include guards.
+ *
+ * Required definitions:
+ * - ops: Vector operations. (See vdraw_RGB_cpp.cpp.)
+ */
+
+/**
+ * rgb_conv32(): Convert pixels stored in 32-bit lanes.
+ * Same formulas as rgb_px().
+ * @param srcMode Source color mode.
+ * @param dstMode Destination color mode.
+ * @param x Pixels.
+ * @return Converted pixels.
+ */
+template<uint32_t srcMode, uint32_t dstMode>
+static inline ops::vec rgb_conv32(ops::vec x)
+{
+	if (srcMode == MDP_RENDER_VMODE_RGB_555)
+	{
+		return ops::vor(ops::vor(ops::sll32(ops::vand(x, ops::set32(0x7C00)), 9),
+					 ops::sll32(ops::vand(x, ops::set32(0x03E0)), 6)),
+				ops::sll32(ops::vand(x, ops::set32(0x001F)), 3));
+	}
+	else if (srcMode == MDP_RENDER_VMODE_RGB_565)
+	{
+		return ops::vor(ops::vor(ops::sll32(ops::vand(x, ops::set32(0xF800)), 8),
+					 ops::sll32(ops::vand(x, ops::set32(0x07E0)), 5)),
+				ops::sll32(ops::vand(x, ops::set32(0x001F)), 3));
+	}
+	else if (dstMode == MDP_RENDER_VMODE_RGB_555)
+	{
+		return ops::vor(ops::vor(ops::vand(ops::srl32(x, 9), ops::set32(0x7C00)),
+					 ops::vand(ops::srl32(x, 6), ops::set32(0x03E0))),
+				ops::vand(ops::srl32(x, 3), ops::set32(0x001F)));
+	}
+	else
+	{
+		return ops::vor(ops::vor(ops::vand(ops::srl32(x, 8), ops::set32(0xF800)),
+					 ops::vand(ops::srl32(x, 5), ops::set32(0x07E0))),
+				ops::vand(ops::srl32(x, 3), ops::set32(0x001F)));
+	}
+}
+
+/**
+ * rgb_conv16(): Convert 15-bit pixels to 16-bit, or vice-versa.
+ * @param srcMode Source color mode.
+ * @param x Pixels.
+ * @return Converted pixels.
+ */
+template<uint32_t srcMode>
+static inline ops::vec rgb_conv16(ops::vec x)
+{
+	if (srcMode == MDP_RENDER_VMODE_RGB_555)
+		return ops::vor(ops::vand(ops::sll16(x, 1), ops::set16(0xFFC0)),
+				ops::vand(x, ops::set16(0x001F)));
+	else
+		return ops::vor(ops::vand(ops::srl16(x, 1), ops::set16(0x7FE0)),
+				ops::vand(x, ops::set16(0x001F)));
+}
+
+/**
+ * rgb_row(): Convert a row of pixels.
+ * Pixels that don't fill a whole vector are converted by the scalar version.
+ * @param srcMode Source color mode.
+ * @param dstMode Destination color mode.
+ * @param dst Destination row.
+ * @param src Source row.
+ * @param width Number of pixels.
+ */
+template<uint32_t srcMode, uint32_t dstMode>
+static void rgb_row(void *dst, const void *src, int width)
+{
+	int x = 0;
+
+	if (dstMode == MDP_RENDER_VMODE_RGB_888)
+	{
+		// 15/16-bit to 32-bit.
+		const uint16_t *s = (const uint16_t*)src;
+		uint32_t *d = (uint32_t*)dst;
+		for (; x + (int)ops::N16 <= width; x += ops::N16)
+		{
+			ops::vec lo, hi;
+			ops::widen(ops::load(&s[x]), lo, hi);
+			ops::store(&d[x], rgb_conv32<srcMode, dstMode>(lo));
+			ops::store(&d[x + ops::N32], rgb_conv32<srcMode, dstMode>(hi));
+		}
+	}
+	else if (srcMode == MDP_RENDER_VMODE_RGB_888)
+	{
+		// 32-bit to 15/16-bit.
+		const uint32_t *s = (const uint32_t*)src;
+		uint16_t *d = (uint16_t*)dst;
+		for (; x + (int)ops::N16 <= width; x += ops::N16)
+		{
+			ops::store(&d[x], ops::narrow(rgb_conv32<srcMode, dstMode>(ops::load(&s[x])),
+							 rgb_conv32<srcMode, dstMode>(ops::load(&s[x + ops::N32]))));
+		}
+	}
+	else
+	{
+		// 15-bit to 16-bit, or vice-versa.
+		const uint16_t *s = (const uint16_t*)src;
+		uint16_t *d = (uint16_t*)dst;
+		for (; x + (int)ops::N16 <= width; x += ops::N16)
+			ops::store(&d[x], rgb_conv16<srcMode>(ops::load(&s[x])));
+	}
+
+	if (x < width)
+		rgb_scalar::rgb_row<srcMode, dstMode>(dst, src, x, width);
+}
+
+/**
+ * rgb_row_select(): Get the row conversion function for a pair of color modes.
+ * @param srcMode Source color mode.
+ * @param dstMode Destination color mode.
+ * @return Row conversion function, or NULL if the modes are the same.
+ */
+static inline rgb_row_fn rgb_row_select(uint32_t srcMode, uint32_t dstMode)
+{
+#define RGB_ROW_CASE(src, dst) \
+	if (srcMode == MDP_RENDER_VMODE_RGB_##src && dstMode == MDP_RENDER_VMODE_RGB_##dst) \
+		return rgb_row<MDP_RENDER_VMODE_RGB_##src, MDP_RENDER_VMODE_RGB_##dst>;
+
+	RGB_ROW_CASE(555, 565);
+	RGB_ROW_CASE(555, 888);
+	RGB_ROW_CASE(565, 555);
+	RGB_ROW_CASE(565, 888);
+	RGB_ROW_CASE(888, 555);
+	RGB_ROW_CASE(888, 565);
+#undef RGB_ROW_CASE
+
+	return NULL;
+}
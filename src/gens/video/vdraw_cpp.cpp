@@ -26,6 +26,8 @@
 
 #include "vdraw_cpp.hpp"
 #include "vdraw.h"
+#include "vdraw_mt.h"
+#include "vdraw_present.h"
 
 // Message logging.
 #include "macros/log_msg.h"
@@ -77,6 +79,44 @@ void vdraw_reset_renderer(const BOOL reset_video)
 }
 
 
+/**
+ * vdraw_set_conversion_vmode(): Set the video mode used if the renderer
+ * doesn't support the output color depth. The image is rendered without
+ * changing the color depth, and vdraw_rgb_convert() converts it to bppOut.
+ * @param flags Renderer flags.
+ * @param mode Color mode to use if the renderer doesn't list any. (MDP_RENDER_VMODE_RGB_*)
+ */
+static void vdraw_set_conversion_vmode(uint32_t flags, uint32_t mode)
+{
+	if (flags & MDP_RENDER_FLAG_RGB_565to565)
+		mode = MDP_RENDER_VMODE_RGB_565;
+	else if (flags & MDP_RENDER_FLAG_RGB_555to555)
+		mode = MDP_RENDER_VMODE_RGB_555;
+	else if (flags & MDP_RENDER_FLAG_RGB_888to888)
+		mode = MDP_RENDER_VMODE_RGB_888;
+	
+	switch (mode)
+	{
+		case MDP_RENDER_VMODE_RGB_555:
+			bppMD = 15;
+			vdraw_rInfo.mdScreen = (void*)(&MD_Screen.u16[8]);
+			break;
+		case MDP_RENDER_VMODE_RGB_888:
+			bppMD = 32;
+			vdraw_rInfo.mdScreen = (void*)(&MD_Screen.u32[8]);
+			break;
+		case MDP_RENDER_VMODE_RGB_565:
+		default:
+			bppMD = 16;
+			vdraw_rInfo.mdScreen = (void*)(&MD_Screen.u16[8]);
+			break;
+	}
+	
+	vdraw_rInfo.vmodeFlags |= MDP_RENDER_VMODE_CREATE(mode, mode);
+	vdraw_needs_conversion = true;
+}
+
+
 /**
  * vdraw_set_renderer(): Set the rendering mode.
  * @param newMode Rendering mode / filter.
@@ -91,6 +131,10 @@ int vdraw_set_renderer(const list<mdp_render_t*>::iterator& newMode, const bool
 		return -1;
 	}
 	
+	// The presentation thread uses the current renderer.
+	// It's restarted by the next vdraw_flip().
+	vdraw_present_end();
+	
 	list<mdp_render_t*>::iterator& Rend = (vdraw_get_fullscreen() ? rendMode_FS : rendMode_W);
 	list<mdp_render_t*>::iterator oldRend = Rend;
 	mdp_render_fn& rendFn = (vdraw_get_fullscreen() ? vdraw_blitFS : vdraw_blitW);
@@ -104,7 +148,16 @@ int vdraw_set_renderer(const list<mdp_render_t*>::iterator& newMode, const bool
 		
 	// Renderer function found.
 	mdp_render_t *rendPlugin = (*newMode);
-	rendFn = rendPlugin->blit;
+	if (rendPlugin->flags & MDP_RENDER_FLAG_BAND_SAFE)
+	{
+		// Band-safe renderer. Render it on multiple threads.
+		vdraw_mt_set_blit(vdraw_get_fullscreen(), rendPlugin->blit);
+		rendFn = vdraw_mt_blit;
+	}
+	else
+	{
+		rendFn = rendPlugin->blit;
+	}
 	
 	if (Rend != newMode)
 		vdraw_text_printf(1500, "Render Mode: %s", rendPlugin->tag);
@@ -155,13 +208,8 @@ int vdraw_set_renderer(const list<mdp_render_t*>::iterator& newMode, const bool
 			else
 			{
 				// Plugin doesn't support 555 output at all.
-				// Render as 555, and convert it afterwards.
-				// TODO: Check if the plugin supports 555 rendering.
-				bppMD = 15;
-				vdraw_rInfo.mdScreen = (void*)(&MD_Screen.u16[8]);
-				vdraw_rInfo.vmodeFlags |=
-					MDP_RENDER_VMODE_CREATE(MDP_RENDER_VMODE_RGB_555, MDP_RENDER_VMODE_RGB_555);
-				vdraw_needs_conversion = true;
+				// Render it in a mode it does support, and convert it afterwards.
+				vdraw_set_conversion_vmode(rendPlugin->flags, MDP_RENDER_VMODE_RGB_555);
 			}
 			break;
 		
@@ -195,13 +243,8 @@ int vdraw_set_renderer(const list<mdp_render_t*>::iterator& newMode, const bool
 			else
 			{
 				// Plugin doesn't support 565 output at all.
-				// Render as 565, and convert it afterwards.
-				// TODO: Check if the plugin supports 565 rendering.
-				bppMD = 16;
-				vdraw_rInfo.mdScreen = (void*)(&MD_Screen.u16[8]);
-				vdraw_rInfo.vmodeFlags |=
-					MDP_RENDER_VMODE_CREATE(MDP_RENDER_VMODE_RGB_565, MDP_RENDER_VMODE_RGB_565);
-				vdraw_needs_conversion = true;
+				// Render it in a mode it does support, and convert it afterwards.
+				vdraw_set_conversion_vmode(rendPlugin->flags, MDP_RENDER_VMODE_RGB_565);
 			}
 			break;
 		
@@ -234,13 +277,8 @@ int vdraw_set_renderer(const list<mdp_render_t*>::iterator& newMode, const bool
 			else
 			{
 				// Plugin doesn't support 888 output at all.
-				// Render as 565, and convert it afterwards.
-				// TODO: Check if the plugin supports 565 rendering.
-				bppMD = 16;
-				vdraw_rInfo.mdScreen = (void*)(&MD_Screen.u16[8]);
-				vdraw_rInfo.vmodeFlags |=
-					MDP_RENDER_VMODE_CREATE(MDP_RENDER_VMODE_RGB_565, MDP_RENDER_VMODE_RGB_565);
-				vdraw_needs_conversion = true;
+				// Render it in a mode it does support, and convert it afterwards.
+				vdraw_set_conversion_vmode(rendPlugin->flags, MDP_RENDER_VMODE_RGB_565);
 			}
 			break;
 	}
@@ -257,6 +295,11 @@ int vdraw_set_renderer(const list<mdp_render_t*>::iterator& newMode, const bool
 	// Set the source pitch.
 	vdraw_rInfo.srcPitch = 336 * (bppMD == 15 ? 2 : bppMD / 8);
 	
+	// Dirty line rendering. (Not used if the image has to be converted.)
+	// The previous renderer's output can't be reused.
+	vdraw_dirty_lines_supported = ((rendPlugin->flags & MDP_RENDER_FLAG_DIRTY_LINES) && !vdraw_needs_conversion);
+	vdraw_dirty_lines_invalidate();
+	
 	//if (Num>3 || Num<10)
 	//Clear_Screen();
 	// if( (Old_Rend==NORMAL && Num==DOUBLE)||(Old_Rend==DOUBLE && Num==NORMAL) ||Opengl)
@@ -84,7 +84,8 @@ static int WINAPI vdraw_gdi_set_cooperative_level(void) { return 0; }
 const vdraw_backend_t vdraw_backend_gdi =
 {
 	.name			= "GDI",
-	.flags			= VDRAW_BACKEND_FLAG_STRETCH,
+	.flags			= VDRAW_BACKEND_FLAG_STRETCH |
+				  VDRAW_BACKEND_FLAG_PERSISTENT,
 	
 	.init			= vdraw_gdi_init,
 	.end			= vdraw_gdi_end,
@@ -214,6 +215,9 @@ static int vdraw_gdi_init(void)
 	// Adjust stretch parameters.
 	vdraw_gdi_stretch_adjust();
 	
+	// The new DIB doesn't have a previous frame.
+	vdraw_dirty_lines_invalidate();
+	
 	// GDI initialized.
 	return 0;
 }
@@ -281,6 +285,7 @@ static int WINAPI vdraw_gdi_clear_back_screen(void)
 		return -1;
 	
 	memset(pbmpData, 0, (szGDIBuf.cx << 1) * szGDIBuf.cy);
+	vdraw_dirty_lines_invalidate();
 	return 0;
 }
 
@@ -24,12 +24,29 @@
 #include "emulator/g_main.hpp"
 #include "gens_core/vdp/vdp_io.h"
 
+// Message logging.
+#include "macros/log_msg.h"
+
+// Timer functions.
+#include "port/timer.h"
+
 // RGB color conversion functions.
 #include "vdraw_RGB.h"
 
 // libgsft includes.
 #include "libgsft/gsft_malloc_align.h"
 
+// OpenGL extensions.
+#ifdef __APPLE__
+#include <OpenGL/glext.h>
+#else
+#include <GL/glext.h>
+#endif
+
+// C includes.
+#include <stdio.h>
+#include <string.h>
+
 // OpenGL variables.
 static GLuint textures[1] = {0};
 static int rowLength = 0;
@@ -40,6 +57,80 @@ static unsigned int m_pixelFormat = 0;
 static unsigned int m_pixelType = 0;
 
 
+/**
+ * Streaming texture uploads.
+ * If pixel buffer objects are supported, the renderer draws directly into
+ * a mapped PBO, and glTexSubImage2D() copies from the PBO asynchronously.
+ * The PBOs are used in a ring, so the next frame can be rendered while the
+ * current frame is still being uploaded.
+ * - ORPHAN: Each frame, the PBO's storage is replaced and mapped.
+ * - PERSISTENT: The PBOs are mapped once. Fences prevent a PBO from being
+ *   overwritten before its upload finishes.
+ * A PBO doesn't keep the previous frame. If the renderer is only redrawing
+ * dirty lines, it renders to filterBuffer instead, and only the rows that
+ * changed are uploaded.
+ */
+typedef enum
+{
+	VDRAW_GL_UPLOAD_DIRECT		= 0,	// glTexSubImage2D() from filterBuffer.
+	VDRAW_GL_UPLOAD_ORPHAN		= 1,
+	VDRAW_GL_UPLOAD_PERSISTENT	= 2,
+} VDRAW_GL_UPLOAD;
+
+static const char *const vdraw_gl_upload_names[] =
+{
+	"direct", "PBO (orphaned)", "PBO (persistent)"
+};
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+typedef void (APIENTRY *vdraw_glGenBuffers_fn)(GLsizei n, GLuint *buffers);
+typedef void (APIENTRY *vdraw_glDeleteBuffers_fn)(GLsizei n, const GLuint *buffers);
+typedef void (APIENTRY *vdraw_glBindBuffer_fn)(GLenum target, GLuint buffer);
+typedef void (APIENTRY *vdraw_glBufferData_fn)(GLenum target, GLsizeiptr size, const GLvoid *data, GLenum usage);
+typedef GLvoid* (APIENTRY *vdraw_glMapBuffer_fn)(GLenum target, GLenum access);
+typedef GLboolean (APIENTRY *vdraw_glUnmapBuffer_fn)(GLenum target);
+
+static vdraw_glGenBuffers_fn	vdraw_glGenBuffers = NULL;
+static vdraw_glDeleteBuffers_fn	vdraw_glDeleteBuffers = NULL;
+static vdraw_glBindBuffer_fn	vdraw_glBindBuffer = NULL;
+static vdraw_glBufferData_fn	vdraw_glBufferData = NULL;
+static vdraw_glMapBuffer_fn	vdraw_glMapBuffer = NULL;
+static vdraw_glUnmapBuffer_fn	vdraw_glUnmapBuffer = NULL;
+
+#if defined(GL_MAP_PERSISTENT_BIT) && defined(GL_SYNC_GPU_COMMANDS_COMPLETE)
+#define VDRAW_GL_HAVE_PERSISTENT 1
+typedef void (APIENTRY *vdraw_glBufferStorage_fn)(GLenum target, GLsizeiptr size, const GLvoid *data, GLbitfield flags);
+typedef GLvoid* (APIENTRY *vdraw_glMapBufferRange_fn)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+typedef GLsync (APIENTRY *vdraw_glFenceSync_fn)(GLenum condition, GLbitfield flags);
+typedef GLenum (APIENTRY *vdraw_glClientWaitSync_fn)(GLsync sync, GLbitfield flags, GLuint64 timeout);
+typedef void (APIENTRY *vdraw_glDeleteSync_fn)(GLsync sync);
+
+static vdraw_glBufferStorage_fn		vdraw_glBufferStorage = NULL;
+static vdraw_glMapBufferRange_fn	vdraw_glMapBufferRange = NULL;
+static vdraw_glFenceSync_fn		vdraw_glFenceSync = NULL;
+static vdraw_glClientWaitSync_fn	vdraw_glClientWaitSync = NULL;
+static vdraw_glDeleteSync_fn		vdraw_glDeleteSync = NULL;
+#endif
+
+#define VDRAW_GL_PBO_COUNT 3
+static VDRAW_GL_UPLOAD vdraw_gl_upload = VDRAW_GL_UPLOAD_DIRECT;
+static GLuint vdraw_gl_pbo[VDRAW_GL_PBO_COUNT];
+static void *vdraw_gl_pbo_map[VDRAW_GL_PBO_COUNT];
+#ifdef VDRAW_GL_HAVE_PERSISTENT
+static GLsync vdraw_gl_pbo_fence[VDRAW_GL_PBO_COUNT];
+#endif
+static int vdraw_gl_pbo_cur = 0;
+
+// Upload time instrumentation.
+#define VDRAW_GL_UPLOAD_STAT_FRAMES 600
+static int64_t vdraw_gl_upload_freq = 0;
+static int64_t vdraw_gl_upload_time = 0;
+static int vdraw_gl_upload_frames = 0;
+
+
 /**
  * vdraw_gl_calc_texture_size(): Calculate the texture size for the given scale value.
  * @param scale Scale value.
@@ -68,6 +159,339 @@ static inline int vdraw_gl_calc_texture_size(int scale)
 }
 
 
+/**
+ * vdraw_gl_has_extension(): Check if the OpenGL context supports an extension.
+ * @param ext Extension name.
+ * @return Non-zero if the extension is supported.
+ */
+static int vdraw_gl_has_extension(const char *ext)
+{
+	const char *exts = (const char*)glGetString(GL_EXTENSIONS);
+	const size_t len = strlen(ext);
+	
+	if (!exts)
+		return 0;
+	
+	while ((exts = strstr(exts, ext)) != NULL)
+	{
+		// Make sure this isn't a prefix of another extension.
+		if (exts[len] == ' ' || exts[len] == 0x00)
+			return 1;
+		exts += len;
+	}
+	
+	return 0;
+}
+
+
+/**
+ * vdraw_gl_has_version(): Check the OpenGL context version.
+ * @param major Major version.
+ * @param minor Minor version.
+ * @return Non-zero if the context version is at least major.minor.
+ */
+static int vdraw_gl_has_version(int major, int minor)
+{
+	const char *version = (const char*)glGetString(GL_VERSION);
+	int ctx_major, ctx_minor;
+	
+	if (!version || sscanf(version, "%d.%d", &ctx_major, &ctx_minor) != 2)
+		return 0;
+	
+	return (ctx_major > major || (ctx_major == major && ctx_minor >= minor));
+}
+
+
+/**
+ * vdraw_gl_pbo_init(): Initialize streaming texture uploads.
+ * The OpenGL context must be current, and filterBufferSize must be set.
+ */
+static void vdraw_gl_pbo_init(void)
+{
+	int i;
+	
+	vdraw_gl_upload = VDRAW_GL_UPLOAD_DIRECT;
+	vdraw_gl_pbo_cur = 0;
+	memset(vdraw_gl_pbo, 0x00, sizeof(vdraw_gl_pbo));
+	memset(vdraw_gl_pbo_map, 0x00, sizeof(vdraw_gl_pbo_map));
+#ifdef VDRAW_GL_HAVE_PERSISTENT
+	memset(vdraw_gl_pbo_fence, 0x00, sizeof(vdraw_gl_pbo_fence));
+#endif
+	
+	// Upload time instrumentation.
+	QueryPerformanceFrequency(&vdraw_gl_upload_freq);
+	vdraw_gl_upload_time = 0;
+	vdraw_gl_upload_frames = 0;
+	
+	// Pixel buffer objects are part of OpenGL 2.1.
+	if (!vdraw_gl_has_version(2, 1) &&
+	    !vdraw_gl_has_extension("GL_ARB_pixel_buffer_object"))
+	{
+		LOG_MSG(video, LOG_MSG_LEVEL_INFO,
+			"Pixel buffer objects are not supported. Using direct texture uploads.");
+		return;
+	}
+	
+	vdraw_glGenBuffers	= (vdraw_glGenBuffers_fn)vdraw_gl_get_proc_address("glGenBuffers");
+	vdraw_glDeleteBuffers	= (vdraw_glDeleteBuffers_fn)vdraw_gl_get_proc_address("glDeleteBuffers");
+	vdraw_glBindBuffer	= (vdraw_glBindBuffer_fn)vdraw_gl_get_proc_address("glBindBuffer");
+	vdraw_glBufferData	= (vdraw_glBufferData_fn)vdraw_gl_get_proc_address("glBufferData");
+	vdraw_glMapBuffer	= (vdraw_glMapBuffer_fn)vdraw_gl_get_proc_address("glMapBuffer");
+	vdraw_glUnmapBuffer	= (vdraw_glUnmapBuffer_fn)vdraw_gl_get_proc_address("glUnmapBuffer");
+	if (!vdraw_glGenBuffers || !vdraw_glDeleteBuffers || !vdraw_glBindBuffer ||
+	    !vdraw_glBufferData || !vdraw_glMapBuffer || !vdraw_glUnmapBuffer)
+	{
+		LOG_MSG(video, LOG_MSG_LEVEL_WARNING,
+			"Pixel buffer object functions are missing. Using direct texture uploads.");
+		return;
+	}
+	
+	vdraw_glGenBuffers(VDRAW_GL_PBO_COUNT, vdraw_gl_pbo);
+	vdraw_gl_upload = VDRAW_GL_UPLOAD_ORPHAN;
+	
+#ifdef VDRAW_GL_HAVE_PERSISTENT
+	// Persistent mapping requires GL_ARB_buffer_storage and GL_ARB_sync.
+	if ((vdraw_gl_has_version(4, 4) || vdraw_gl_has_extension("GL_ARB_buffer_storage")) &&
+	    (vdraw_gl_has_version(3, 2) || vdraw_gl_has_extension("GL_ARB_sync")))
+	{
+		vdraw_glBufferStorage	= (vdraw_glBufferStorage_fn)vdraw_gl_get_proc_address("glBufferStorage");
+		vdraw_glMapBufferRange	= (vdraw_glMapBufferRange_fn)vdraw_gl_get_proc_address("glMapBufferRange");
+		vdraw_glFenceSync	= (vdraw_glFenceSync_fn)vdraw_gl_get_proc_address("glFenceSync");
+		vdraw_glClientWaitSync	= (vdraw_glClientWaitSync_fn)vdraw_gl_get_proc_address("glClientWaitSync");
+		vdraw_glDeleteSync	= (vdraw_glDeleteSync_fn)vdraw_gl_get_proc_address("glDeleteSync");
+	}
+	
+	if (vdraw_glBufferStorage && vdraw_glMapBufferRange &&
+	    vdraw_glFenceSync && vdraw_glClientWaitSync && vdraw_glDeleteSync)
+	{
+		const GLbitfield flags = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+		
+		for (i = 0; i < VDRAW_GL_PBO_COUNT; i++)
+		{
+			vdraw_glBindBuffer(GL_PIXEL_UNPACK_BUFFER, vdraw_gl_pbo[i]);
+			vdraw_glBufferStorage(GL_PIXEL_UNPACK_BUFFER, filterBufferSize, NULL, flags);
+			vdraw_gl_pbo_map[i] = vdraw_glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, filterBufferSize, flags);
+			if (!vdraw_gl_pbo_map[i])
+				break;
+		}
+		vdraw_glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		
+		if (i == VDRAW_GL_PBO_COUNT)
+		{
+			vdraw_gl_upload = VDRAW_GL_UPLOAD_PERSISTENT;
+		}
+		else
+		{
+			// Persistent mapping failed. Buffer storage is immutable,
+			// so the PBOs have to be recreated for orphaning.
+			for (i = 0; i < VDRAW_GL_PBO_COUNT; i++)
+			{
+				if (vdraw_gl_pbo_map[i])
+				{
+					vdraw_glBindBuffer(GL_PIXEL_UNPACK_BUFFER, vdraw_gl_pbo[i]);
+					vdraw_glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+					vdraw_gl_pbo_map[i] = NULL;
+				}
+			}
+			vdraw_glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			vdraw_glDeleteBuffers(VDRAW_GL_PBO_COUNT, vdraw_gl_pbo);
+			vdraw_glGenBuffers(VDRAW_GL_PBO_COUNT, vdraw_gl_pbo);
+		}
+	}
+#endif
+	
+	LOG_MSG(video, LOG_MSG_LEVEL_INFO,
+		"Using %s texture uploads.", vdraw_gl_upload_names[vdraw_gl_upload]);
+}
+
+
+/**
+ * vdraw_gl_pbo_end(): Shut down streaming texture uploads.
+ */
+static void vdraw_gl_pbo_end(void)
+{
+	int i;
+	
+	if (vdraw_gl_upload == VDRAW_GL_UPLOAD_DIRECT)
+		return;
+	
+	for (i = 0; i < VDRAW_GL_PBO_COUNT; i++)
+	{
+#ifdef VDRAW_GL_HAVE_PERSISTENT
+		if (vdraw_gl_pbo_fence[i])
+		{
+			vdraw_glDeleteSync(vdraw_gl_pbo_fence[i]);
+			vdraw_gl_pbo_fence[i] = NULL;
+		}
+#endif
+		if (vdraw_gl_pbo_map[i])
+		{
+			vdraw_glBindBuffer(GL_PIXEL_UNPACK_BUFFER, vdraw_gl_pbo[i]);
+			vdraw_glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+			vdraw_gl_pbo_map[i] = NULL;
+		}
+	}
+	
+	vdraw_glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	vdraw_glDeleteBuffers(VDRAW_GL_PBO_COUNT, vdraw_gl_pbo);
+	vdraw_gl_upload = VDRAW_GL_UPLOAD_DIRECT;
+}
+
+
+/**
+ * vdraw_gl_pbo_begin(): Get the buffer for the next frame.
+ * @return Mapped PBO, or NULL to render to filterBuffer.
+ */
+static uint8_t *vdraw_gl_pbo_begin(void)
+{
+	if (vdraw_gl_upload == VDRAW_GL_UPLOAD_DIRECT)
+		return NULL;
+	
+	vdraw_gl_pbo_cur = (vdraw_gl_pbo_cur + 1) % VDRAW_GL_PBO_COUNT;
+	
+#ifdef VDRAW_GL_HAVE_PERSISTENT
+	if (vdraw_gl_upload == VDRAW_GL_UPLOAD_PERSISTENT)
+	{
+		// Wait for this PBO's previous upload to finish.
+		GLsync fence = vdraw_gl_pbo_fence[vdraw_gl_pbo_cur];
+		if (fence)
+		{
+			vdraw_glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+			vdraw_glDeleteSync(fence);
+			vdraw_gl_pbo_fence[vdraw_gl_pbo_cur] = NULL;
+		}
+		return (uint8_t*)vdraw_gl_pbo_map[vdraw_gl_pbo_cur];
+	}
+#endif
+	
+	// Orphan the PBO's storage so the driver doesn't have to wait
+	// for the previous upload from this PBO.
+	vdraw_glBindBuffer(GL_PIXEL_UNPACK_BUFFER, vdraw_gl_pbo[vdraw_gl_pbo_cur]);
+	vdraw_glBufferData(GL_PIXEL_UNPACK_BUFFER, filterBufferSize, NULL, GL_STREAM_DRAW);
+	vdraw_gl_pbo_map[vdraw_gl_pbo_cur] = vdraw_glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+	vdraw_glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	return (uint8_t*)vdraw_gl_pbo_map[vdraw_gl_pbo_cur];
+}
+
+
+/**
+ * vdraw_gl_pbo_end_frame(): Upload the current PBO to the texture.
+ * The unpack parameters must already be set.
+ * @param offset Offset of the image in the PBO.
+ * @param texWidth Width of the image.
+ * @param texHeight Height of the image.
+ */
+static void vdraw_gl_pbo_end_frame(size_t offset, int texWidth, int texHeight)
+{
+	vdraw_glBindBuffer(GL_PIXEL_UNPACK_BUFFER, vdraw_gl_pbo[vdraw_gl_pbo_cur]);
+	
+	if (vdraw_gl_upload == VDRAW_GL_UPLOAD_ORPHAN)
+	{
+		vdraw_glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+		vdraw_gl_pbo_map[vdraw_gl_pbo_cur] = NULL;
+	}
+	
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, texWidth, texHeight,
+			m_pixelFormat, m_pixelType, (const GLvoid*)offset);
+	
+#ifdef VDRAW_GL_HAVE_PERSISTENT
+	if (vdraw_gl_upload == VDRAW_GL_UPLOAD_PERSISTENT)
+		vdraw_gl_pbo_fence[vdraw_gl_pbo_cur] = vdraw_glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+#endif
+	
+	vdraw_glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+
+/**
+ * vdraw_gl_upload_dirty(): Upload the rows of filterBuffer that changed.
+ * The unpack parameters must already be set.
+ * @param rInfo Render information. (MDP_RENDER_VMODE_DIRTY_LINES must be set.)
+ * @param glStart Start of the texture image in filterBuffer.
+ * @param y_start First row of filterBuffer in the texture image.
+ * @param texWidth Width of the texture image.
+ * @param texHeight Height of the texture image.
+ * @param text_top First row of filterBuffer covered by text. (>= 240 * vdraw_scale if none)
+ */
+static void vdraw_gl_upload_dirty(const mdp_render_info_t *rInfo, const uint8_t *glStart,
+				  int y_start, int texWidth, int texHeight, int text_top)
+{
+	const int pitch = rInfo->destPitch;
+	int line, first = -1;
+	
+	for (line = 0; line <= rInfo->height; line++)
+	{
+		int dirty = 0;
+		if (line < rInfo->height)
+		{
+			// Renderers may read lines up to MDP_RENDER_DIRTY_LINES_PAD away.
+			int i;
+			for (i = -MDP_RENDER_DIRTY_LINES_PAD; i <= MDP_RENDER_DIRTY_LINES_PAD; i++)
+				dirty |= rInfo->dirtyLines[line + i];
+			
+			// Text is drawn on top of the renderer's output.
+			if ((line + 1) * vdraw_scale > text_top)
+				dirty = 1;
+		}
+		
+		if (dirty)
+		{
+			if (first < 0)
+				first = line;
+			continue;
+		}
+		else if (first < 0)
+			continue;
+		
+		// Upload the rows for lines [first, line).
+		int top = (first * vdraw_scale) - y_start;
+		int bottom = (line * vdraw_scale) - y_start;
+		first = -1;
+		
+		if (top < 0)
+			top = 0;
+		if (bottom > texHeight)
+			bottom = texHeight;
+		if (bottom <= top)
+			continue;
+		
+		glTexSubImage2D(GL_TEXTURE_2D, 0,
+				0,			// x offset
+				top,			// y offset
+				texWidth,		// width
+				bottom - top,		// height
+				m_pixelFormat, m_pixelType,
+				glStart + (top * pitch));
+	}
+}
+
+
+/**
+ * vdraw_gl_upload_stat(): Add a frame's texture upload time to the statistics.
+ * The average is logged every VDRAW_GL_UPLOAD_STAT_FRAMES frames.
+ * @param ticks Time spent uploading the frame, in performance counter ticks.
+ */
+static void vdraw_gl_upload_stat(int64_t ticks)
+{
+	vdraw_gl_upload_time += ticks;
+	
+	if (++vdraw_gl_upload_frames < VDRAW_GL_UPLOAD_STAT_FRAMES)
+		return;
+	
+	if (vdraw_gl_upload_freq > 0)
+	{
+		LOG_MSG(video, LOG_MSG_LEVEL_DEBUG1,
+			"Texture upload (%s): %.3f ms/frame",
+			vdraw_gl_upload_names[vdraw_gl_upload],
+			((double)vdraw_gl_upload_time * 1000.0) /
+			((double)vdraw_gl_upload_freq * vdraw_gl_upload_frames));
+	}
+	
+	vdraw_gl_upload_time = 0;
+	vdraw_gl_upload_frames = 0;
+}
+
+
 /**
  * vdraw_gl_init(): Initialize OpenGL.
  * @param vp_w Viewport width.
@@ -119,6 +543,9 @@ int vdraw_gl_init(const int vp_w, const int vp_h)
 	glTexImage2D(GL_TEXTURE_2D, 0, 3, textureSize * 2, textureSize, 0,
 		     m_pixelFormat, m_pixelType, NULL);
 	
+	// Initialize streaming texture uploads.
+	vdraw_gl_pbo_init();
+	
 	// OpenGL initialized.
 	return 0;
 }
@@ -131,7 +558,8 @@ void vdraw_gl_end(void)
 {
 	if (filterBuffer)
 	{
-		// Delete the GL textures and filter buffer.
+		// Delete the PBOs, GL textures, and filter buffer.
+		vdraw_gl_pbo_end();
 		glDeleteTextures(1, textures);
 		free(filterBuffer);
 		filterBuffer = NULL;
@@ -159,6 +587,7 @@ void vdraw_gl_clear_screen(void)
 	glClearColor(0.0, 0.0, 0.0, 0.0);
 	glClear(GL_COLOR_BUFFER_BIT);
 	memset(filterBuffer, 0x00, filterBufferSize);
+	vdraw_dirty_lines_invalidate();
 }
 
 
@@ -202,7 +631,13 @@ void vdraw_gl_init_orthographic_projection(void)
 }
 
 
-void vdraw_gl_flip(void)
+/**
+ * vdraw_gl_flip(): Render a frame to the OpenGL texture and draw it.
+ * This may run on the presentation thread, so only the frame
+ * and the OpenGL state may be used.
+ * @param frame Frame.
+ */
+void vdraw_gl_flip(const vdraw_present_frame_t *frame)
 {
 	// Clear the GL surface.
 	// This is needed in order to make sure that we have the
@@ -215,8 +650,24 @@ void vdraw_gl_flip(void)
 	// OpenGL framebuffer pitch.
 	const int pitch = rowLength * bytespp;
 	
+	// Render information.
+	mdp_render_info_t rInfo = frame->rInfo;
+	const BOOL dirty_lines = !!(rInfo.vmodeFlags & MDP_RENDER_VMODE_DIRTY_LINES);
+	
 	// Start of the OpenGL texture buffer.
-	uint8_t *start = filterBuffer;
+	// If the whole image is being redrawn, render directly into a PBO.
+	// Otherwise, filterBuffer has the previous frame.
+	int64_t upload_start, upload_end;
+	uint8_t *base = NULL;
+	QueryPerformanceCounter(&upload_start);
+	if (!dirty_lines)
+		base = vdraw_gl_pbo_begin();
+	QueryPerformanceCounter(&upload_end);
+	int64_t upload_ticks = (upload_end - upload_start);
+	
+	if (!base)
+		base = filterBuffer;
+	uint8_t *start = base;
 	
 	// Position in the texture to start rendering from.
 	// This is modified if STRETCH_V is enabled.
@@ -224,45 +675,47 @@ void vdraw_gl_flip(void)
 	
 	// Set up the render information.
 	// TODO: If STRETCH_V is set, only render the visible area.
-	vdraw_rInfo.destScreen = (void*)start;
-	vdraw_rInfo.width = 320;
-	vdraw_rInfo.height = 240;
-	vdraw_rInfo.destPitch = pitch;
+	rInfo.destScreen = (void*)start;
+	rInfo.width = 320;
+	rInfo.height = 240;
+	rInfo.destPitch = pitch;
 	
 	if (vdraw_needs_conversion)
 	{
 		// Color depth conversion is required.
-		vdraw_rgb_convert(&vdraw_rInfo);
+		vdraw_rgb_convert(&rInfo);
 	}
 	else
 	{
 		// Color conversion is not required.
 		if (vdraw_get_fullscreen())
-			vdraw_blitFS(&vdraw_rInfo);
+			vdraw_blitFS(&rInfo);
 		else
-			vdraw_blitW(&vdraw_rInfo);
+			vdraw_blitW(&rInfo);
 	}
 	
 	const uint8_t stretch_flags = vdraw_get_stretch();
 	
 	// Calculate the texture size.
 	int texHeight = 240 * vdraw_scale;
-	if (VDP_Lines.Visible.Total < 240)
+	int y_start = 0;	// First row of the texture image.
+	if (frame->lines_visible < 240)
 	{
 		// Check for vertical stretch.
-		const unsigned int start_offset = (pitch * VDP_Lines.Visible.Border_Size * vdraw_scale);
+		const unsigned int start_offset = (pitch * frame->lines_border * vdraw_scale);
 		start += start_offset;	// Text starting position.
 		
 		if (stretch_flags & STRETCH_V)
 		{
 			// Vertical stretch is enabled.
-			texHeight = VDP_Lines.Visible.Total * vdraw_scale;
+			texHeight = frame->lines_visible * vdraw_scale;
+			y_start = frame->lines_border * vdraw_scale;
 			glStart += start_offset;
 		}
 	}
 	
 	int texWidth = 320 * vdraw_scale;
-	const int HPix = vdp_getHPix();
+	const int HPix = frame->h_pix;
 	if (HPix < 320)
 	{
 		// Check for horizontal stretch.
@@ -277,21 +730,21 @@ void vdraw_gl_flip(void)
 		}
 	}
 	
-	if (vdraw_msg_visible)
+	int text_top = 240 * vdraw_scale;
+	if (frame->text[0] != 0x00)
 	{
-		// Message is visible.
+		// Draw the message or FPS counter.
 		draw_text(start, rowLength,
 				HPix * vdraw_scale,
-				VDP_Lines.Visible.Total * vdraw_scale,
-				vdraw_msg_text, &vdraw_msg_style);
-	}
-	else if (vdraw_fps_enabled && (Game != NULL) && Settings.Active && !Settings.Paused && !IS_DEBUGGING())
-	{
-		// FPS is enabled.
-		draw_text(start, rowLength,
-				HPix * vdraw_scale,
-				VDP_Lines.Visible.Total * vdraw_scale,
-				vdraw_msg_text, &vdraw_fps_style);
+				frame->lines_visible * vdraw_scale,
+				frame->text, &frame->text_style);
+		
+		// Rows covered by the text.
+		if (vdraw_text_rows > 0)
+		{
+			text_top = ((frame->lines_border + frame->lines_visible) * vdraw_scale) -
+				   vdraw_text_rows;
+		}
 	}
 	
 	// Set the GL MAG filter.
@@ -307,13 +760,30 @@ void vdraw_gl_flip(void)
 	glPixelStorei(GL_UNPACK_ALIGNMENT, 8);
 	
 	// Set the texture data.
-	glTexSubImage2D(GL_TEXTURE_2D, 0,
-			0,			// x offset
-			0,			// y offset
-			texWidth,		// width
-			texHeight,		// height
-			m_pixelFormat, m_pixelType,
-			glStart);
+	QueryPerformanceCounter(&upload_start);
+	if (base != filterBuffer)
+	{
+		// Upload from the PBO.
+		vdraw_gl_pbo_end_frame(glStart - base, texWidth, texHeight);
+	}
+	else if (dirty_lines)
+	{
+		// Only upload the rows that changed.
+		// The rest of the texture still has the previous frame.
+		vdraw_gl_upload_dirty(&rInfo, glStart, y_start, texWidth, texHeight, text_top);
+	}
+	else
+	{
+		glTexSubImage2D(GL_TEXTURE_2D, 0,
+				0,			// x offset
+				0,			// y offset
+				texWidth,		// width
+				texHeight,		// height
+				m_pixelFormat, m_pixelType,
+				glStart);
+	}
+	QueryPerformanceCounter(&upload_end);
+	vdraw_gl_upload_stat(upload_ticks + (upload_end - upload_start));
 	
 	// Corners of the rectangle.
 	glBegin(GL_QUADS);
@@ -42,6 +42,13 @@ int vdraw_gl_is_supported(void);
 void vdraw_gl_init_vsync(void);
 void vdraw_gl_update_vsync(const int fromInitSDLGL);
 
+// Get the address of an OpenGL extension function.
+void *vdraw_gl_get_proc_address(const char *name);
+
+// Threaded presentation.
+void vdraw_gl_init_threads(void);
+void vdraw_gl_set_current(const BOOL current);
+
 // Initialize OpenGL.
 int vdraw_gl_init(const int vp_w, const int vp_h);
 void vdraw_gl_end(void);
@@ -54,7 +61,7 @@ void vdraw_gl_clear_screen(void);
 // GL Orthographic Projection.
 void vdraw_gl_init_orthographic_projection(void);
 
-void vdraw_gl_flip(void);
+void vdraw_gl_flip(const vdraw_present_frame_t *frame);
 int vdraw_gl_update_renderer(const int vp_w, const int vp_h);
 
 #ifdef __cplusplus
@@ -27,6 +27,9 @@
 #include <OpenGL/gl.h>
 #include <OpenGL/OpenGL.h>
 
+// dlsym()
+#include <dlfcn.h>
+
 
 /**
  * vdraw_gl_is_supported(): Checks if OpenGL is supported by the current system.
@@ -63,3 +66,46 @@ void vdraw_gl_update_vsync(const int fromInitSDLGL)
 	if (!vsync && !fromInitSDLGL)
 		vdraw_refresh_video();
 }
+
+
+/**
+ * vdraw_gl_get_proc_address(): Get the address of an OpenGL extension function.
+ * @param name Function name.
+ * @return Function address, or NULL if it isn't available.
+ */
+void *vdraw_gl_get_proc_address(const char *name)
+{
+	// MacOS X exports all supported OpenGL functions from the framework.
+	return dlsym(RTLD_DEFAULT, name);
+}
+
+
+/**
+ * vdraw_gl_init_threads(): Allow the window system to be called from more than one thread.
+ */
+void vdraw_gl_init_threads(void)
+{
+	// Does nothing on MacOS X.
+}
+
+
+// Saved CGL context for vdraw_gl_set_current().
+static CGLContextObj vdraw_gl_cur_ctx = NULL;
+
+/**
+ * vdraw_gl_set_current(): Make the OpenGL context current on this thread.
+ * @param current If TRUE, acquire the context; if FALSE, release it.
+ */
+void vdraw_gl_set_current(const BOOL current)
+{
+	if (!current)
+	{
+		// Save the context so another thread can acquire it.
+		vdraw_gl_cur_ctx = CGLGetCurrentContext();
+		CGLSetCurrentContext(NULL);
+	}
+	else if (vdraw_gl_cur_ctx)
+	{
+		CGLSetCurrentContext(vdraw_gl_cur_ctx);
+	}
+}
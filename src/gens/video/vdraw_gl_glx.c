@@ -23,6 +23,7 @@
 #include "vdraw_gl.h"
 #include "emulator/g_main.hpp"
 #include "macros/log_msg.h"
+#include "vdraw_present.h"
 
 #include <stdlib.h>
 
@@ -280,3 +281,56 @@ void vdraw_gl_update_vsync(const int fromInitSDLGL)
 	if (!fromInitSDLGL)
 		vdraw_refresh_video();
 }
+
+
+/**
+ * vdraw_gl_get_proc_address(): Get the address of an OpenGL extension function.
+ * @param name Function name.
+ * @return Function address, or NULL if it isn't available.
+ */
+void *vdraw_gl_get_proc_address(const char *name)
+{
+	return (void*)glXGetProcAddressARB((const GLubyte*)name);
+}
+
+
+/**
+ * vdraw_gl_init_threads(): Allow Xlib to be called from more than one thread.
+ * Must be called before any other Xlib function.
+ */
+void vdraw_gl_init_threads(void)
+{
+	if (!XInitThreads())
+	{
+		LOG_MSG(video, LOG_MSG_LEVEL_WARNING,
+			"XInitThreads() failed. Threaded presentation will be disabled.");
+		vdraw_present_disable();
+	}
+}
+
+
+// Saved GLX context for vdraw_gl_set_current().
+static Display *vdraw_gl_cur_dpy = NULL;
+static GLXDrawable vdraw_gl_cur_drawable = None;
+static GLXContext vdraw_gl_cur_ctx = NULL;
+
+/**
+ * vdraw_gl_set_current(): Make the OpenGL context current on this thread.
+ * @param current If TRUE, acquire the context; if FALSE, release it.
+ */
+void vdraw_gl_set_current(const BOOL current)
+{
+	if (!current)
+	{
+		// Save the context so another thread can acquire it.
+		vdraw_gl_cur_dpy = glXGetCurrentDisplay();
+		vdraw_gl_cur_drawable = glXGetCurrentDrawable();
+		vdraw_gl_cur_ctx = glXGetCurrentContext();
+		if (vdraw_gl_cur_dpy)
+			glXMakeCurrent(vdraw_gl_cur_dpy, None, NULL);
+	}
+	else if (vdraw_gl_cur_dpy)
+	{
+		glXMakeCurrent(vdraw_gl_cur_dpy, vdraw_gl_cur_drawable, vdraw_gl_cur_ctx);
+	}
+}
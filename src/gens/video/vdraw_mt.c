@@ -0,0 +1,282 @@
+/***************************************************************************
+ * Gens: Video Drawing - Multi-threaded Rendering.                         *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "vdraw_mt.h"
+#include "vdraw.h"
+
+// Message logging.
+#include "macros/log_msg.h"
+
+// MDP includes.
+#include "mdp/mdp_error.h"
+
+// libgsft includes.
+#include "libgsft/gsft_thread.h"
+
+// Minimum number of lines in a band.
+// Smaller bands aren't worth the synchronization overhead.
+#define VDRAW_MT_MIN_BAND_LINES 16
+
+// Render threads. (0 == one per CPU)
+// Set by vdraw_mt_set_threads(); applied by vdraw_mt_blit().
+static volatile int vdraw_mt_threads = 0;
+
+// Blit functions.
+static mdp_render_fn vdraw_mt_blitFS = NULL;
+static mdp_render_fn vdraw_mt_blitW = NULL;
+
+// Worker threads.
+// The thread calling vdraw_mt_blit() also renders bands,
+// so there's one less worker than the number of render threads.
+static gsft_thread_t vdraw_mt_workers[VDRAW_MT_MAX_THREADS - 1];
+static int vdraw_mt_num_workers = 0;
+static int vdraw_mt_start_threads = 0;
+static BOOL vdraw_mt_started = FALSE;
+static BOOL vdraw_mt_quit = FALSE;
+
+static gsft_mutex_t vdraw_mt_mutex;
+static gsft_cond_t vdraw_mt_cond_start;
+static gsft_cond_t vdraw_mt_cond_done;
+
+// Current job.
+static unsigned int vdraw_mt_job_gen = 0;
+static mdp_render_fn vdraw_mt_job_fn = NULL;
+static mdp_render_info_t vdraw_mt_bands[VDRAW_MT_MAX_THREADS];
+static int vdraw_mt_num_bands = 0;
+static int vdraw_mt_next_band = 0;
+static int vdraw_mt_bands_left = 0;
+static int vdraw_mt_job_err = MDP_ERR_OK;
+
+
+/**
+ * vdraw_mt_get_num_threads(): Get the number of render threads to use.
+ * @return Number of render threads.
+ */
+static int vdraw_mt_get_num_threads(void)
+{
+	int threads = vdraw_mt_threads;
+	if (threads <= 0)
+		threads = gsft_thread_num_cpus();
+	if (threads > VDRAW_MT_MAX_THREADS)
+		threads = VDRAW_MT_MAX_THREADS;
+	return threads;
+}
+
+
+/**
+ * vdraw_mt_run_bands(): Render bands until there are none left.
+ * vdraw_mt_mutex must be locked by the caller.
+ */
+static void vdraw_mt_run_bands(void)
+{
+	while (vdraw_mt_next_band < vdraw_mt_num_bands)
+	{
+		const int band = vdraw_mt_next_band++;
+		const mdp_render_fn fn = vdraw_mt_job_fn;
+		gsft_mutex_unlock(&vdraw_mt_mutex);
+
+		int rval = fn(&vdraw_mt_bands[band]);
+
+		gsft_mutex_lock(&vdraw_mt_mutex);
+		if (rval != MDP_ERR_OK && vdraw_mt_job_err == MDP_ERR_OK)
+			vdraw_mt_job_err = rval;
+		if (--vdraw_mt_bands_left == 0)
+			gsft_cond_signal(&vdraw_mt_cond_done);
+	}
+}
+
+
+/**
+ * vdraw_mt_worker(): Render worker thread.
+ * @param param Unused.
+ * @return NULL.
+ */
+static void* vdraw_mt_worker(void *param)
+{
+	((void)param);
+
+	gsft_mutex_lock(&vdraw_mt_mutex);
+	unsigned int gen = vdraw_mt_job_gen;
+	while (1)
+	{
+		while (gen == vdraw_mt_job_gen && !vdraw_mt_quit)
+			gsft_cond_wait(&vdraw_mt_cond_start, &vdraw_mt_mutex);
+		if (vdraw_mt_quit)
+			break;
+
+		gen = vdraw_mt_job_gen;
+		vdraw_mt_run_bands();
+	}
+	gsft_mutex_unlock(&vdraw_mt_mutex);
+
+	return NULL;
+}
+
+
+/**
+ * vdraw_mt_start(): Start the worker threads.
+ * @param threads Number of render threads.
+ * @return 0 on success; non-zero on error.
+ */
+static int vdraw_mt_start(const int threads)
+{
+	gsft_mutex_init(&vdraw_mt_mutex);
+	gsft_cond_init(&vdraw_mt_cond_start);
+	gsft_cond_init(&vdraw_mt_cond_done);
+	vdraw_mt_quit = FALSE;
+	vdraw_mt_start_threads = threads;
+	vdraw_mt_started = TRUE;
+
+	for (vdraw_mt_num_workers = 0; vdraw_mt_num_workers < (threads - 1); vdraw_mt_num_workers++)
+	{
+		if (gsft_thread_create(&vdraw_mt_workers[vdraw_mt_num_workers], vdraw_mt_worker, NULL) != 0)
+		{
+			LOG_MSG(video, LOG_MSG_LEVEL_WARNING,
+				"Could not create render thread %d.", vdraw_mt_num_workers + 1);
+			break;
+		}
+	}
+
+	LOG_MSG(video, LOG_MSG_LEVEL_INFO,
+		"Started %d render worker thread(s).", vdraw_mt_num_workers);
+	return (vdraw_mt_num_workers > 0 ? 0 : 1);
+}
+
+
+/**
+ * vdraw_mt_end(): Stop the worker threads.
+ * This must not be called while vdraw_mt_blit() is running.
+ */
+void vdraw_mt_end(void)
+{
+	if (!vdraw_mt_started)
+		return;
+
+	gsft_mutex_lock(&vdraw_mt_mutex);
+	vdraw_mt_quit = TRUE;
+	gsft_cond_broadcast(&vdraw_mt_cond_start);
+	gsft_mutex_unlock(&vdraw_mt_mutex);
+
+	int i;
+	for (i = 0; i < vdraw_mt_num_workers; i++)
+		gsft_thread_join(vdraw_mt_workers[i]);
+	vdraw_mt_num_workers = 0;
+
+	gsft_cond_destroy(&vdraw_mt_cond_done);
+	gsft_cond_destroy(&vdraw_mt_cond_start);
+	gsft_mutex_destroy(&vdraw_mt_mutex);
+	vdraw_mt_started = FALSE;
+}
+
+
+int vdraw_mt_get_threads(void)
+{
+	return vdraw_mt_threads;
+}
+void vdraw_mt_set_threads(const int new_threads)
+{
+	int threads = new_threads;
+	if (threads < 0)
+		threads = 0;
+	else if (threads > VDRAW_MT_MAX_THREADS)
+		threads = VDRAW_MT_MAX_THREADS;
+
+	// vdraw_mt_blit() may be running on the presentation thread,
+	// so the worker threads are restarted by the next blit.
+	vdraw_mt_threads = threads;
+}
+
+
+void vdraw_mt_set_blit(const BOOL fullscreen, mdp_render_fn blit)
+{
+	if (fullscreen)
+		vdraw_mt_blitFS = blit;
+	else
+		vdraw_mt_blitW = blit;
+}
+
+
+int MDP_FNCALL vdraw_mt_blit(const mdp_render_info_t *renderInfo)
+{
+	const mdp_render_fn fn = (vdraw_get_fullscreen() ? vdraw_mt_blitFS : vdraw_mt_blitW);
+	if (!fn)
+		return -MDP_ERR_FUNCTION_NOT_IMPLEMENTED;
+
+	// If the thread count has changed, stop the worker threads.
+	// They're restarted with the new count below.
+	const int threads = vdraw_mt_get_num_threads();
+	if (vdraw_mt_started && vdraw_mt_start_threads != threads)
+		vdraw_mt_end();
+
+	// Determine the number of bands.
+	int bands = threads;
+	if (bands > (renderInfo->height / VDRAW_MT_MIN_BAND_LINES))
+		bands = (renderInfo->height / VDRAW_MT_MIN_BAND_LINES);
+	if (bands <= 1)
+		return fn(renderInfo);
+
+	if (!vdraw_mt_started)
+	{
+		if (vdraw_mt_start(threads) != 0)
+			return fn(renderInfo);
+	}
+
+	// Split the image into bands.
+	const int band_lines = renderInfo->height / bands;
+	int extra_lines = renderInfo->height % bands;
+	int y = 0;
+	int band;
+	for (band = 0; band < bands; band++)
+	{
+		const int lines = band_lines + (extra_lines > 0 ? 1 : 0);
+		if (extra_lines > 0)
+			extra_lines--;
+
+		mdp_render_info_t *info = &vdraw_mt_bands[band];
+		*info = *renderInfo;
+		info->mdScreen = (uint8_t*)renderInfo->mdScreen + (y * renderInfo->srcPitch);
+		info->destScreen = (uint8_t*)renderInfo->destScreen + (y * vdraw_scale * renderInfo->destPitch);
+		info->height = lines;
+		if (renderInfo->vmodeFlags & MDP_RENDER_VMODE_DIRTY_LINES)
+			info->dirtyLines = renderInfo->dirtyLines + y;
+		y += lines;
+	}
+
+	// Start the job.
+	gsft_mutex_lock(&vdraw_mt_mutex);
+	vdraw_mt_job_fn = fn;
+	vdraw_mt_num_bands = bands;
+	vdraw_mt_next_band = 0;
+	vdraw_mt_bands_left = bands;
+	vdraw_mt_job_err = MDP_ERR_OK;
+	vdraw_mt_job_gen++;
+	gsft_cond_broadcast(&vdraw_mt_cond_start);
+
+	// Render bands on this thread, too.
+	vdraw_mt_run_bands();
+
+	// Wait for the worker threads to finish.
+	while (vdraw_mt_bands_left > 0)
+		gsft_cond_wait(&vdraw_mt_cond_done, &vdraw_mt_mutex);
+	const int rval = vdraw_mt_job_err;
+	gsft_mutex_unlock(&vdraw_mt_mutex);
+
+	return rval;
+}
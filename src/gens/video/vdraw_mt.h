@@ -0,0 +1,59 @@
+/***************************************************************************
+ * Gens: Video Drawing - Multi-threaded Rendering.                         *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef GENS_VDRAW_MT_H
+#define GENS_VDRAW_MT_H
+
+#include "mdp/mdp_render.h"
+#include "libgsft/gsft_bool.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Maximum number of render threads.
+#define VDRAW_MT_MAX_THREADS 16
+
+// Render threads. (0 == one per CPU)
+int	vdraw_mt_get_threads(void);
+void	vdraw_mt_set_threads(const int new_threads);
+
+void	vdraw_mt_end(void);
+
+/**
+ * vdraw_mt_set_blit(): Set the blit function used by vdraw_mt_blit().
+ * @param fullscreen If TRUE, set the fullscreen blit function; otherwise, set the windowed blit function.
+ * @param blit Blit function. (Must be band-safe.)
+ */
+void	vdraw_mt_set_blit(const BOOL fullscreen, mdp_render_fn blit);
+
+/**
+ * vdraw_mt_blit(): Band-parallel blit.
+ * Splits the image into horizontal bands and renders them on the render threads.
+ * @param renderInfo Render information.
+ * @return MDP error code.
+ */
+int MDP_FNCALL vdraw_mt_blit(const mdp_render_info_t *renderInfo);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GENS_VDRAW_MT_H */
@@ -0,0 +1,296 @@
+/***************************************************************************
+ * Gens: Video Drawing - Threaded Presentation.                            *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * Frames are handed from the emulation thread to the presentation thread
+ * through three slots:
+ * - write: Owned by the emulation thread. The next frame is copied here.
+ * - ready: The newest finished frame.
+ * - show: Owned by the presentation thread. Currently being presented.
+ *
+ * vdraw_present_submit() swaps write and ready. The presentation thread
+ * swaps ready and show when there's a new frame. Neither thread waits
+ * for the other to finish with a slot, so the emulator never blocks on
+ * the display. If the display is slower than the emulator, frames that
+ * were never shown are dropped; if it's faster, the last frame stays on
+ * screen until the next one arrives.
+ */
+
+#include "vdraw_present.h"
+#include "vdraw.h"
+
+// Message logging.
+#include "macros/log_msg.h"
+
+// libgsft includes.
+#include "libgsft/gsft_thread.h"
+
+// C includes.
+#include <stdlib.h>
+#include <string.h>
+
+// Number of lines in the dirty line map.
+#define VDRAW_PRESENT_LINES 240
+
+// Threaded presentation.
+static BOOL vdraw_present_enabled = TRUE;
+static BOOL vdraw_present_failed = FALSE;	// Don't retry until the setting is changed.
+static BOOL vdraw_present_unsupported = FALSE;
+
+// Frame slots.
+static vdraw_present_frame_t vdraw_present_frames[3];
+static uint8_t vdraw_present_dirty[3][VDRAW_PRESENT_LINES];
+static int vdraw_present_write = 0;
+static int vdraw_present_ready = 1;
+static int vdraw_present_show = 2;
+static BOOL vdraw_present_fresh = FALSE;	// ready hasn't been shown yet.
+
+// Presentation thread.
+static gsft_thread_t vdraw_present_thread;
+static BOOL vdraw_present_started = FALSE;
+static BOOL vdraw_present_quit = FALSE;
+static gsft_mutex_t vdraw_present_mutex;
+static gsft_cond_t vdraw_present_cond;
+
+static vdraw_present_fn vdraw_present_cb = NULL;
+static vdraw_present_set_current_fn vdraw_present_set_current = NULL;
+
+// Statistics.
+static unsigned int vdraw_present_count_shown = 0;
+static unsigned int vdraw_present_count_dropped = 0;
+
+
+/**
+ * vdraw_present_worker(): Presentation thread.
+ * @param param Unused.
+ * @return NULL.
+ */
+static void* vdraw_present_worker(void *param)
+{
+	((void)param);
+
+	if (vdraw_present_set_current)
+		vdraw_present_set_current(TRUE);
+
+	gsft_mutex_lock(&vdraw_present_mutex);
+	while (1)
+	{
+		while (!vdraw_present_fresh && !vdraw_present_quit)
+			gsft_cond_wait(&vdraw_present_cond, &vdraw_present_mutex);
+		if (vdraw_present_quit)
+			break;
+
+		// Take the newest frame.
+		const int show = vdraw_present_ready;
+		vdraw_present_ready = vdraw_present_show;
+		vdraw_present_show = show;
+		vdraw_present_fresh = FALSE;
+		gsft_mutex_unlock(&vdraw_present_mutex);
+
+		vdraw_present_cb(&vdraw_present_frames[show]);
+
+		gsft_mutex_lock(&vdraw_present_mutex);
+		vdraw_present_count_shown++;
+	}
+	gsft_mutex_unlock(&vdraw_present_mutex);
+
+	// Hand the context back to the emulation thread.
+	if (vdraw_present_set_current)
+		vdraw_present_set_current(FALSE);
+
+	return NULL;
+}
+
+
+/**
+ * vdraw_present_free_frames(): Free the frame buffers.
+ */
+static void vdraw_present_free_frames(void)
+{
+	int i;
+	for (i = 0; i < 3; i++)
+	{
+		free(vdraw_present_frames[i].screen);
+		vdraw_present_frames[i].screen = NULL;
+	}
+}
+
+
+int vdraw_present_start(const size_t screen_size, vdraw_present_fn present,
+			vdraw_present_set_current_fn set_current)
+{
+	if (vdraw_present_started)
+		return 0;
+	if (vdraw_present_failed || vdraw_present_unsupported)
+		return 1;
+
+	int i;
+	for (i = 0; i < 3; i++)
+	{
+		vdraw_present_frame_t *frame = &vdraw_present_frames[i];
+		frame->screen = calloc(1, screen_size);
+		if (!frame->screen)
+		{
+			vdraw_present_free_frames();
+			vdraw_present_failed = TRUE;
+			return 1;
+		}
+		frame->dirty = vdraw_present_dirty[i];
+		frame->dirty_all = TRUE;
+		frame->resized = FALSE;
+		frame->clear = FALSE;
+		frame->text[0] = 0x00;
+	}
+
+	vdraw_present_write = 0;
+	vdraw_present_ready = 1;
+	vdraw_present_show = 2;
+	vdraw_present_fresh = FALSE;
+	vdraw_present_quit = FALSE;
+	vdraw_present_count_shown = 0;
+	vdraw_present_count_dropped = 0;
+	vdraw_present_cb = present;
+	vdraw_present_set_current = set_current;
+
+	gsft_mutex_init(&vdraw_present_mutex);
+	gsft_cond_init(&vdraw_present_cond);
+
+	// The context can only be current on one thread at a time.
+	if (set_current)
+		set_current(FALSE);
+
+	if (gsft_thread_create(&vdraw_present_thread, vdraw_present_worker, NULL) != 0)
+	{
+		LOG_MSG(video, LOG_MSG_LEVEL_WARNING,
+			"Could not create the presentation thread.");
+		if (set_current)
+			set_current(TRUE);
+		gsft_cond_destroy(&vdraw_present_cond);
+		gsft_mutex_destroy(&vdraw_present_mutex);
+		vdraw_present_free_frames();
+		vdraw_present_failed = TRUE;
+		return 1;
+	}
+
+	vdraw_present_started = TRUE;
+	LOG_MSG(video, LOG_MSG_LEVEL_INFO,
+		"Started the presentation thread.");
+	return 0;
+}
+
+
+void vdraw_present_end(void)
+{
+	if (!vdraw_present_started)
+		return;
+
+	gsft_mutex_lock(&vdraw_present_mutex);
+	vdraw_present_quit = TRUE;
+	gsft_cond_signal(&vdraw_present_cond);
+	gsft_mutex_unlock(&vdraw_present_mutex);
+
+	gsft_thread_join(vdraw_present_thread);
+
+	if (vdraw_present_fresh)
+	{
+		// The last frame was never presented.
+		// Its dirty lines are lost, so the next frame must be redrawn completely.
+		vdraw_present_fresh = FALSE;
+		vdraw_present_count_dropped++;
+		vdraw_dirty_lines_invalidate();
+	}
+
+	// The presentation thread released the context before exiting.
+	if (vdraw_present_set_current)
+		vdraw_present_set_current(TRUE);
+
+	LOG_MSG(video, LOG_MSG_LEVEL_DEBUG1,
+		"Stopped the presentation thread: %u frame(s) presented, %u dropped.",
+		vdraw_present_count_shown, vdraw_present_count_dropped);
+
+	gsft_cond_destroy(&vdraw_present_cond);
+	gsft_mutex_destroy(&vdraw_present_mutex);
+	vdraw_present_free_frames();
+	vdraw_present_started = FALSE;
+}
+
+
+BOOL vdraw_present_is_running(void)
+{
+	return vdraw_present_started;
+}
+
+
+void vdraw_present_disable(void)
+{
+	vdraw_present_end();
+	vdraw_present_unsupported = TRUE;
+}
+
+
+vdraw_present_frame_t *vdraw_present_get_frame(void)
+{
+	return &vdraw_present_frames[vdraw_present_write];
+}
+
+
+void vdraw_present_submit(void)
+{
+	gsft_mutex_lock(&vdraw_present_mutex);
+
+	if (vdraw_present_fresh)
+	{
+		// The previous frame was never presented.
+		// Drop it, but keep its dirty lines and display changes.
+		const vdraw_present_frame_t *dropped = &vdraw_present_frames[vdraw_present_ready];
+		vdraw_present_frame_t *frame = &vdraw_present_frames[vdraw_present_write];
+		int i;
+		for (i = 0; i < VDRAW_PRESENT_LINES; i++)
+			frame->dirty[i] |= dropped->dirty[i];
+		frame->dirty_all |= dropped->dirty_all;
+		frame->resized |= dropped->resized;
+		frame->clear |= dropped->clear;
+		vdraw_present_count_dropped++;
+	}
+
+	const int ready = vdraw_present_write;
+	vdraw_present_write = vdraw_present_ready;
+	vdraw_present_ready = ready;
+	vdraw_present_fresh = TRUE;
+
+	gsft_cond_signal(&vdraw_present_cond);
+	gsft_mutex_unlock(&vdraw_present_mutex);
+}
+
+
+BOOL vdraw_present_get_enabled(void)
+{
+	return vdraw_present_enabled;
+}
+void vdraw_present_set_enabled(const BOOL new_enabled)
+{
+	if (vdraw_present_enabled == new_enabled)
+		return;
+
+	// The presentation thread is started by the next vdraw_flip() if enabled.
+	vdraw_present_end();
+	vdraw_present_enabled = new_enabled;
+	vdraw_present_failed = FALSE;
+}
@@ -0,0 +1,124 @@
+/***************************************************************************
+ * Gens: Video Drawing - Threaded Presentation.                            *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef GENS_VDRAW_PRESENT_H
+#define GENS_VDRAW_PRESENT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "libgsft/gsft_bool.h"
+
+#include "mdp/mdp_render.h"
+#include "vdraw_text.hpp"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * vdraw_present_frame_t: A finished frame.
+ * Everything the emulation thread can change while the frame is being
+ * presented is copied here by vdraw_flip(), so the presentation thread
+ * never reads the emulator's state.
+ */
+typedef struct _vdraw_present_frame_t
+{
+	void		*screen;	// MD screen buffer.
+	uint8_t		*dirty;		// Dirty line map. (240 entries)
+	BOOL		dirty_all;	// If TRUE, the whole image must be redrawn.
+	
+	// Render information. mdScreen points into screen.
+	mdp_render_info_t rInfo;
+	
+	// Display size.
+	int		h_pix;		// Horizontal resolution, in pixels.
+	int		lines_visible;	// Visible lines.
+	int		lines_border;	// Lines above the visible area.
+	BOOL		resized;	// Display width changed. The stretch parameters must be adjusted.
+	BOOL		clear;		// Display width decreased. The screen must be cleared.
+	
+	// Onscreen text. (text[0] == 0x00 if no text is visible.)
+	char		text[1024];
+	vdraw_style_t	text_style;
+} vdraw_present_frame_t;
+
+/**
+ * vdraw_present_fn: Present a frame.
+ * Called on the presentation thread.
+ * @param frame Frame.
+ * @return 0 on success; non-zero on error.
+ */
+typedef int (*vdraw_present_fn)(vdraw_present_frame_t *frame);
+
+/**
+ * vdraw_present_set_current_fn: Make the backend's rendering context current on this thread.
+ * @param current If TRUE, acquire the context; if FALSE, release it.
+ */
+typedef void (*vdraw_present_set_current_fn)(const BOOL current);
+
+// Threaded presentation.
+BOOL	vdraw_present_get_enabled(void);
+void	vdraw_present_set_enabled(const BOOL new_enabled);
+
+BOOL	vdraw_present_is_running(void);
+
+/**
+ * vdraw_present_disable(): Never start the presentation thread.
+ * Used if the window system doesn't support threads.
+ */
+void	vdraw_present_disable(void);
+
+/**
+ * vdraw_present_start(): Start the presentation thread.
+ * @param screen_size Size of the MD screen buffer, in bytes.
+ * @param present Present function.
+ * @param set_current Context handoff function. (May be NULL.)
+ * @return 0 on success; non-zero on error.
+ */
+int	vdraw_present_start(const size_t screen_size, vdraw_present_fn present,
+			    vdraw_present_set_current_fn set_current);
+
+/**
+ * vdraw_present_end(): Stop the presentation thread.
+ * A frame that wasn't presented yet is discarded, and the next frame
+ * is redrawn completely. The rendering context is current on the
+ * calling thread when this function returns.
+ */
+void	vdraw_present_end(void);
+
+/**
+ * vdraw_present_get_frame(): Get the frame to fill in.
+ * @return Frame owned by the emulation thread.
+ */
+vdraw_present_frame_t *vdraw_present_get_frame(void);
+
+/**
+ * vdraw_present_submit(): Hand the frame from vdraw_present_get_frame() to the presentation thread.
+ * This never waits for the display. If the previous frame hasn't been
+ * presented yet, it's dropped and its dirty lines, resize, and clear
+ * requests are carried over.
+ */
+void	vdraw_present_submit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GENS_VDRAW_PRESENT_H */
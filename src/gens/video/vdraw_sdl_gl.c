@@ -55,7 +55,7 @@
 static int	vdraw_sdl_gl_init(void);
 static int	vdraw_sdl_gl_end(void);
 
-static int	vdraw_sdl_gl_flip(void);
+static int	vdraw_sdl_gl_present(const vdraw_present_frame_t *frame);
 static void	vdraw_sdl_gl_update_renderer(void);
 static int	vdraw_sdl_gl_reinit_gens_window(void);
 
@@ -73,7 +73,9 @@ const vdraw_backend_t vdraw_backend_sdl_gl =
 	.name			= "SDL+OpenGL",
 	.flags			= VDRAW_BACKEND_FLAG_VSYNC |
 				  VDRAW_BACKEND_FLAG_STRETCH |
-				  VDRAW_BACKEND_FLAG_FULLSCREEN,
+				  VDRAW_BACKEND_FLAG_FULLSCREEN |
+				  VDRAW_BACKEND_FLAG_PERSISTENT |
+				  VDRAW_BACKEND_FLAG_THREADED,
 	
 	.init			= vdraw_sdl_gl_init,
 	.end			= vdraw_sdl_gl_end,
@@ -81,9 +83,11 @@ const vdraw_backend_t vdraw_backend_sdl_gl =
 	.clear_screen		= vdraw_gl_clear_screen,
 	.update_vsync		= vdraw_gl_update_vsync,
 	
-	.flip			= vdraw_sdl_gl_flip,
 	.update_renderer	= vdraw_sdl_gl_update_renderer,
-	.reinit_gens_window	= vdraw_sdl_gl_reinit_gens_window
+	.reinit_gens_window	= vdraw_sdl_gl_reinit_gens_window,
+	
+	.present		= vdraw_sdl_gl_present,
+	.set_current		= vdraw_gl_set_current
 };
 
 
@@ -220,12 +224,13 @@ static int vdraw_sdl_gl_end(void)
 
 
 /**
- * vdraw_sdl_gl_flip(): Flip the screen buffer. [Called by vdraw_flip().]
+ * vdraw_sdl_gl_present(): Present a frame. [Called by vdraw_flip() or the presentation thread.]
+ * @param frame Frame.
  * @return 0 on success; non-zero on error.
  */
-static int vdraw_sdl_gl_flip(void)
+static int vdraw_sdl_gl_present(const vdraw_present_frame_t *frame)
 {
-	vdraw_gl_flip();
+	vdraw_gl_flip(frame);
 	
 	// Swap the SDL GL buffers.
 	SDL_GL_SwapBuffers();
@@ -64,9 +64,14 @@ char vdraw_msg_text[1024];
 
 // Prerendered text for the on-screen display.
 // Each byte represents 8 pixels, or one line for a character.
+// This is only used by draw_text(), which runs on the thread presenting frames.
+static char vdraw_msg_prerender_text[1024];
 static uint8_t vdraw_msg_prerender[16][1024];
 static unsigned int vdraw_msg_prerender_len;
 
+// Number of rows at the bottom of the screen covered by draw_text().
+int vdraw_text_rows = 0;
+
 
 template<typename pixel, unsigned int charSize, bool do2x>
 static inline void drawStr_preRender(pixel *screen, const int pitch, const int x, const int y,
@@ -185,6 +190,11 @@ static inline void T_drawText(pixel *screen, const int pitch, const int w, const
 	const unsigned short lineBreaks = ((vdraw_msg_prerender_len - 1) * charSize) / msgWidth;
 	y -= (lineBreaks * (charSize * 2));
 	
+	// Save the number of rows covered by the text.
+	const int rows = (h - (int)y);
+	if (rows > vdraw_text_rows)
+		vdraw_text_rows = rows;
+	
 	vdraw_style_t textShadowStyle = *style;
 	textShadowStyle.dot_color = 0;
 	
@@ -214,9 +224,16 @@ static inline void T_drawText(pixel *screen, const int pitch, const int w, const
 void draw_text(void *screen, const int pitch, const int w, const int h,
 	       const char *msg, const vdraw_style_t *style)
 {
-	if (!style)
+	if (!style || !msg)
 		return;
 	
+	// Prerender the text if it has changed.
+	if (strcmp(msg, vdraw_msg_prerender_text) != 0)
+	{
+		strlcpy(vdraw_msg_prerender_text, msg, sizeof(vdraw_msg_prerender_text));
+		vdraw_msg_prerender_len = osd_charset_prerender(vdraw_msg_prerender_text, vdraw_msg_prerender);
+	}
+	
 	if (bppOut == 15 || bppOut == 16)
 	{
 		// 15/16-bit color.
@@ -278,9 +295,6 @@ void vdraw_text_write(const char* msg, const int duration)
 	// TODO: Add localization.
 	strlcpy(vdraw_msg_text, msg, sizeof(vdraw_msg_text));
 	
-	// Prerender the text.
-	vdraw_msg_prerender_len = osd_charset_prerender(vdraw_msg_text, vdraw_msg_prerender);
-	
 	if (duration > 0)
 	{
 		// Set the message timer.
@@ -322,9 +336,6 @@ void vdraw_text_vprintf(const int duration, const char* msg, va_list ap)
 	// TODO: Add localization.
 	vszprintf(vdraw_msg_text, sizeof(vdraw_msg_text), msg, ap);
 	
-	// Prerender the text.
-	vdraw_msg_prerender_len = osd_charset_prerender(vdraw_msg_text, vdraw_msg_prerender);
-	
 	if (duration > 0)
 	{
 		// Set the message timer.
@@ -343,7 +354,6 @@ void vdraw_text_vprintf(const int duration, const char* msg, va_list ap)
 void vdraw_text_clear(void)
 {
 	vdraw_msg_text[0] = 0x00;
-	vdraw_msg_prerender_len = 0;
 }
 
 
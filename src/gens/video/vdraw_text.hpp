@@ -71,6 +71,10 @@ void vdraw_msg_timer_update(void);
 // Text buffer.
 extern char vdraw_msg_text[1024];
 
+// Number of rows at the bottom of the screen covered by draw_text().
+// Reset by vdraw_flip().
+extern int vdraw_text_rows;
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,99 @@
+/***************************************************************************
+ * libgsft: Common Functions.                                              *
+ * gsft_simd.h: SIMD intrinsics availability macros.                       *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __GSFT_SIMD_H
+#define __GSFT_SIMD_H
+
+/**
+ * GSFT_SIMD_SSE2: SSE2 intrinsics can be compiled.
+ * GSFT_SIMD_SSE2_ALWAYS: SSE2 is part of the target's baseline ISA,
+ * so no runtime CPU check is needed. (e.g. x86_64)
+ * GSFT_TARGET_SSE2: Function attribute for SSE2 functions.
+ *
+ * GSFT_SIMD_AVX2: AVX2 intrinsics can be compiled.
+ * AVX2 always requires a runtime CPU check. (MDP_CPUFLAG_X86_AVX2)
+ * GSFT_TARGET_AVX2: Function attribute for AVX2 functions.
+ *
+ * Functions marked with GSFT_TARGET_* must only be called
+ * after checking the CPU flags, unless *_ALWAYS is defined.
+ *
+ * GSFT_SIMD_BEGIN_SSE2, GSFT_SIMD_BEGIN_AVX2, GSFT_SIMD_END:
+ * Compile all functions between BEGIN and END for the specified ISA.
+ * Unlike GSFT_TARGET_*, this also applies to templates instantiated
+ * from the region, so generic kernels can be shared between ISAs by
+ * including them in multiple regions. (Use a separate namespace for each.)
+ */
+
+#if defined(__i386__) || defined(__amd64__) || defined(__x86_64__)
+
+/* gcc-4.9 and clang allow intrinsics in functions with a target attribute. */
+#if defined(__clang__) || \
+    (defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#define GSFT_SIMD_TARGET_ATTR 1
+#endif
+
+#if defined(__SSE2__)
+#define GSFT_SIMD_SSE2 1
+#define GSFT_SIMD_SSE2_ALWAYS 1
+#define GSFT_TARGET_SSE2
+#elif defined(GSFT_SIMD_TARGET_ATTR)
+#define GSFT_SIMD_SSE2 1
+#define GSFT_TARGET_SSE2 __attribute__ ((target ("sse2")))
+#endif
+
+#if defined(__AVX2__)
+#define GSFT_SIMD_AVX2 1
+#define GSFT_TARGET_AVX2
+#elif defined(GSFT_SIMD_TARGET_ATTR)
+#define GSFT_SIMD_AVX2 1
+#define GSFT_TARGET_AVX2 __attribute__ ((target ("avx2")))
+#endif
+
+#if defined(GSFT_SIMD_SSE2) || defined(GSFT_SIMD_AVX2)
+#if defined(__clang__)
+#define GSFT_SIMD_BEGIN_SSE2 \
+	_Pragma("clang attribute push (__attribute__((target(\"sse2\"))), apply_to = function)")
+#define GSFT_SIMD_BEGIN_AVX2 \
+	_Pragma("clang attribute push (__attribute__((target(\"avx2\"))), apply_to = function)")
+#define GSFT_SIMD_END \
+	_Pragma("clang attribute pop")
+#else
+#define GSFT_SIMD_BEGIN_SSE2 \
+	_Pragma("GCC push_options") \
+	_Pragma("GCC target(\"sse2\")")
+#define GSFT_SIMD_BEGIN_AVX2 \
+	_Pragma("GCC push_options") \
+	_Pragma("GCC target(\"avx2\")")
+#define GSFT_SIMD_END \
+	_Pragma("GCC pop_options")
+#endif
+#endif
+
+#if defined(GSFT_SIMD_SSE2)
+#include <emmintrin.h>
+#endif
+#if defined(GSFT_SIMD_AVX2)
+#include <immintrin.h>
+#endif
+
+#endif /* defined(__i386__) || defined(__amd64__) || defined(__x86_64__) */
+
+#endif /* __GSFT_SIMD_H */
@@ -0,0 +1,183 @@
+/***************************************************************************
+ * libgsft: Common Functions.                                              *
+ * gsft_thread.c: Portable threading primitives.                           *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "gsft_thread.h"
+
+// C includes.
+#include <stdlib.h>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+
+#ifdef _WIN32
+
+/** Win32 implementation. **/
+
+typedef struct _gsft_thread_start_t
+{
+	gsft_thread_fn fn;
+	void *param;
+} gsft_thread_start_t;
+
+static DWORD WINAPI gsft_thread_start(LPVOID lpParameter)
+{
+	gsft_thread_start_t start = *(gsft_thread_start_t*)lpParameter;
+	free(lpParameter);
+	start.fn(start.param);
+	return 0;
+}
+
+int GSFT_FNCALL gsft_thread_create(gsft_thread_t *thread, gsft_thread_fn fn, void *param)
+{
+	gsft_thread_start_t *start = (gsft_thread_start_t*)malloc(sizeof(*start));
+	if (!start)
+		return -1;
+	start->fn = fn;
+	start->param = param;
+	
+	*thread = CreateThread(NULL, 0, gsft_thread_start, start, 0, NULL);
+	if (!*thread)
+	{
+		free(start);
+		return -2;
+	}
+	return 0;
+}
+
+int GSFT_FNCALL gsft_thread_join(gsft_thread_t thread)
+{
+	if (WaitForSingleObject(thread, INFINITE) != WAIT_OBJECT_0)
+		return -1;
+	CloseHandle(thread);
+	return 0;
+}
+
+int GSFT_FNCALL gsft_thread_num_cpus(void)
+{
+	SYSTEM_INFO si;
+	GetSystemInfo(&si);
+	return (si.dwNumberOfProcessors > 0 ? (int)si.dwNumberOfProcessors : 1);
+}
+
+void GSFT_FNCALL gsft_mutex_init(gsft_mutex_t *mutex)
+	{ InitializeCriticalSection(mutex); }
+void GSFT_FNCALL gsft_mutex_destroy(gsft_mutex_t *mutex)
+	{ DeleteCriticalSection(mutex); }
+void GSFT_FNCALL gsft_mutex_lock(gsft_mutex_t *mutex)
+	{ EnterCriticalSection(mutex); }
+void GSFT_FNCALL gsft_mutex_unlock(gsft_mutex_t *mutex)
+	{ LeaveCriticalSection(mutex); }
+
+void GSFT_FNCALL gsft_cond_init(gsft_cond_t *cond)
+{
+	InitializeCriticalSection(&cond->lock);
+	cond->sema = CreateSemaphore(NULL, 0, 0x7FFFFFFF, NULL);
+	cond->waiters = 0;
+}
+
+void GSFT_FNCALL gsft_cond_destroy(gsft_cond_t *cond)
+{
+	CloseHandle(cond->sema);
+	DeleteCriticalSection(&cond->lock);
+}
+
+void GSFT_FNCALL gsft_cond_wait(gsft_cond_t *cond, gsft_mutex_t *mutex)
+{
+	EnterCriticalSection(&cond->lock);
+	cond->waiters++;
+	LeaveCriticalSection(&cond->lock);
+	
+	// NOTE: Spurious wakeups are possible.
+	// Callers must always check their predicate in a loop.
+	LeaveCriticalSection(mutex);
+	WaitForSingleObject(cond->sema, INFINITE);
+	EnterCriticalSection(mutex);
+}
+
+void GSFT_FNCALL gsft_cond_signal(gsft_cond_t *cond)
+{
+	EnterCriticalSection(&cond->lock);
+	if (cond->waiters > 0)
+	{
+		cond->waiters--;
+		ReleaseSemaphore(cond->sema, 1, NULL);
+	}
+	LeaveCriticalSection(&cond->lock);
+}
+
+void GSFT_FNCALL gsft_cond_broadcast(gsft_cond_t *cond)
+{
+	EnterCriticalSection(&cond->lock);
+	if (cond->waiters > 0)
+	{
+		ReleaseSemaphore(cond->sema, cond->waiters, NULL);
+		cond->waiters = 0;
+	}
+	LeaveCriticalSection(&cond->lock);
+}
+
+#else /* !_WIN32 */
+
+/** pthreads implementation. **/
+
+int GSFT_FNCALL gsft_thread_create(gsft_thread_t *thread, gsft_thread_fn fn, void *param)
+{
+	return pthread_create(thread, NULL, fn, param);
+}
+
+int GSFT_FNCALL gsft_thread_join(gsft_thread_t thread)
+{
+	return pthread_join(thread, NULL);
+}
+
+int GSFT_FNCALL gsft_thread_num_cpus(void)
+{
+#ifdef _SC_NPROCESSORS_ONLN
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	return (cpus > 0 ? (int)cpus : 1);
+#else
+	return 1;
+#endif
+}
+
+void GSFT_FNCALL gsft_mutex_init(gsft_mutex_t *mutex)
+	{ pthread_mutex_init(mutex, NULL); }
+void GSFT_FNCALL gsft_mutex_destroy(gsft_mutex_t *mutex)
+	{ pthread_mutex_destroy(mutex); }
+void GSFT_FNCALL gsft_mutex_lock(gsft_mutex_t *mutex)
+	{ pthread_mutex_lock(mutex); }
+void GSFT_FNCALL gsft_mutex_unlock(gsft_mutex_t *mutex)
+	{ pthread_mutex_unlock(mutex); }
+
+void GSFT_FNCALL gsft_cond_init(gsft_cond_t *cond)
+	{ pthread_cond_init(cond, NULL); }
+void GSFT_FNCALL gsft_cond_destroy(gsft_cond_t *cond)
+	{ pthread_cond_destroy(cond); }
+void GSFT_FNCALL gsft_cond_wait(gsft_cond_t *cond, gsft_mutex_t *mutex)
+	{ pthread_cond_wait(cond, mutex); }
+void GSFT_FNCALL gsft_cond_signal(gsft_cond_t *cond)
+	{ pthread_cond_signal(cond); }
+void GSFT_FNCALL gsft_cond_broadcast(gsft_cond_t *cond)
+	{ pthread_cond_broadcast(cond); }
+
+#endif /* _WIN32 */
@@ -0,0 +1,104 @@
+/***************************************************************************
+ * libgsft: Common Functions.                                              *
+ * gsft_thread.h: Portable threading primitives.                           *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __GSFT_THREAD_H
+#define __GSFT_THREAD_H
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "gsft_fncall.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Threading primitives.
+ * pthreads is used on all systems except Win32.
+ * Win32 uses native threads. Condition variables are emulated
+ * using a semaphore, since CONDITION_VARIABLE requires Vista.
+ */
+#ifdef _WIN32
+typedef HANDLE gsft_thread_t;
+typedef CRITICAL_SECTION gsft_mutex_t;
+typedef struct _gsft_cond_t
+{
+	CRITICAL_SECTION lock;
+	HANDLE sema;
+	int waiters;
+} gsft_cond_t;
+#else
+typedef pthread_t gsft_thread_t;
+typedef pthread_mutex_t gsft_mutex_t;
+typedef pthread_cond_t gsft_cond_t;
+#endif
+
+/**
+ * gsft_thread_fn: Thread entry point.
+ * @param param Parameter passed to gsft_thread_create().
+ * @return Ignored.
+ */
+typedef void* (*gsft_thread_fn)(void *param);
+
+/**
+ * gsft_thread_create(): Create a thread.
+ * @param thread	[out] Thread handle.
+ * @param fn		[in] Thread entry point.
+ * @param param		[in] Parameter for the thread entry point.
+ * @return 0 on success; non-zero on error.
+ */
+DLL_LOCAL int GSFT_FNCALL gsft_thread_create(gsft_thread_t *thread, gsft_thread_fn fn, void *param);
+
+/**
+ * gsft_thread_join(): Wait for a thread to exit.
+ * @param thread Thread handle.
+ * @return 0 on success; non-zero on error.
+ */
+DLL_LOCAL int GSFT_FNCALL gsft_thread_join(gsft_thread_t thread);
+
+/**
+ * gsft_thread_num_cpus(): Get the number of online CPUs.
+ * @return Number of online CPUs. (Always at least 1.)
+ */
+DLL_LOCAL int GSFT_FNCALL gsft_thread_num_cpus(void);
+
+/** Mutexes. **/
+DLL_LOCAL void GSFT_FNCALL gsft_mutex_init(gsft_mutex_t *mutex);
+DLL_LOCAL void GSFT_FNCALL gsft_mutex_destroy(gsft_mutex_t *mutex);
+DLL_LOCAL void GSFT_FNCALL gsft_mutex_lock(gsft_mutex_t *mutex);
+DLL_LOCAL void GSFT_FNCALL gsft_mutex_unlock(gsft_mutex_t *mutex);
+
+/** Condition variables. **/
+DLL_LOCAL void GSFT_FNCALL gsft_cond_init(gsft_cond_t *cond);
+DLL_LOCAL void GSFT_FNCALL gsft_cond_destroy(gsft_cond_t *cond);
+DLL_LOCAL void GSFT_FNCALL gsft_cond_wait(gsft_cond_t *cond, gsft_mutex_t *mutex);
+DLL_LOCAL void GSFT_FNCALL gsft_cond_signal(gsft_cond_t *cond);
+DLL_LOCAL void GSFT_FNCALL gsft_cond_broadcast(gsft_cond_t *cond);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GSFT_THREAD_H */
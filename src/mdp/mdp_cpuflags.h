@@ -42,6 +42,12 @@
 #define MDP_CPUFLAG_X86_SSE4A		((uint32_t)(1 << 10))
 /*! END: MDP v1.0 CPU flags. !*/
 
+/*! BEGIN: MDP v1.1 CPU flags. !*/
+/* AVX and AVX2 are only set if the OS saves the YMM registers. */
+#define MDP_CPUFLAG_X86_AVX		((uint32_t)(1 << 11))
+#define MDP_CPUFLAG_X86_AVX2		((uint32_t)(1 << 12))
+/*! END: MDP v1.1 CPU flags. !*/
+
 #endif /* defined(__i386__) || defined(__amd64__) */
 
 #endif /* __MDP_CPUFLAGS_H */
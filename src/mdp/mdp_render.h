@@ -50,6 +50,16 @@ extern "C" {
 
 /*! END: MDP v1.0 video mode flags. !*/
 
+/*! BEGIN: MDP v1.1 video mode flags. !*/
+
+/**
+ * MDP_RENDER_VMODE_DIRTY_LINES: The dirtyLines field is valid.
+ * Only set if the renderer has MDP_RENDER_FLAG_DIRTY_LINES.
+ */
+#define MDP_RENDER_VMODE_DIRTY_LINES		((uint32_t)(1 << 4))
+
+/*! END: MDP v1.1 video mode flags. !*/
+
 /** Render information struct. **/
 #pragma pack(1)
 typedef struct PACKED _mdp_render_info_t
@@ -71,6 +81,18 @@ typedef struct PACKED _mdp_render_info_t
 	void *data;		/* Extra data set by the plugin. */
 	
 	/*! END: MDP v1.0 render information struct. !*/
+	
+	/*! BEGIN: MDP v1.1 render information struct. !*/
+	
+	/**
+	 * Dirty line map. Only valid if vmodeFlags has MDP_RENDER_VMODE_DIRTY_LINES.
+	 * One byte per source line; nonzero if the line changed since the
+	 * previous frame. Entries from -MDP_RENDER_DIRTY_LINES_PAD to
+	 * (height - 1 + MDP_RENDER_DIRTY_LINES_PAD) may be read.
+	 */
+	const uint8_t *dirtyLines;
+	
+	/*! END: MDP v1.1 render information struct. !*/
 } mdp_render_info_t;
 #pragma pack()
 
@@ -87,6 +109,31 @@ typedef struct PACKED _mdp_render_info_t
 #define MDP_RENDER_FLAG_RGB_888to888	((uint32_t)(1 << 8))
 /*! END: MDP v1.0 render plugin flags. !*/
 
+/*! BEGIN: MDP v1.1 render plugin flags. !*/
+/**
+ * MDP_RENDER_FLAG_BAND_SAFE: The blit function may be called on horizontal
+ * bands of the image, possibly from multiple threads at once.
+ * Each call gets a render info struct whose mdScreen and destScreen point to
+ * the first line of the band, and whose height is the height of the band.
+ * Source lines above and below the band are valid and may be read, so the
+ * blit function must not treat the first and last lines of a band as the
+ * edges of the image. The blit function must not modify shared state.
+ */
+#define MDP_RENDER_FLAG_BAND_SAFE	((uint32_t)(1 << 16))
+
+/**
+ * MDP_RENDER_FLAG_DIRTY_LINES: The blit function understands dirtyLines.
+ * If MDP_RENDER_VMODE_DIRTY_LINES is set, the destination buffer contains
+ * the previous frame's output, and the blit function may skip output lines
+ * whose source lines (and the neighboring lines they read, up to
+ * MDP_RENDER_DIRTY_LINES_PAD lines away) are all clean.
+ */
+#define MDP_RENDER_FLAG_DIRTY_LINES	((uint32_t)(1 << 17))
+
+/* Number of valid dirtyLines entries above and below the image. */
+#define MDP_RENDER_DIRTY_LINES_PAD	2
+/*! END: MDP v1.1 render plugin flags. !*/
+
 /* Render plugin function definition. */
 typedef int (MDP_FNCALL *mdp_render_fn)(const mdp_render_info_t *renderInfo);
 
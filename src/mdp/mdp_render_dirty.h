@@ -0,0 +1,102 @@
+/***************************************************************************
+ * MDP: Mega Drive Plugins - Dirty Line Rendering Helper.                  *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __MDP_RENDER_DIRTY_H
+#define __MDP_RENDER_DIRTY_H
+
+#include "mdp_render.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * mdp_render_dirty_line(): Check if a source line needs to be re-rendered.
+ * @param dirtyLines Dirty line map.
+ * @param y Source line.
+ * @param radius Number of lines above and below y that affect its output.
+ * @return Non-zero if the line needs to be re-rendered.
+ */
+static inline int mdp_render_dirty_line(const uint8_t *dirtyLines, int y, int radius)
+{
+	int i;
+	for (i = y - radius; i <= y + radius; i++)
+	{
+		if (dirtyLines[i])
+			return 1;
+	}
+	return 0;
+}
+
+/**
+ * mdp_render_dirty_blit(): Blit only the lines that need to be re-rendered.
+ * If renderInfo doesn't have a dirty line map, the whole image is blitted.
+ * Otherwise, blit is called once for each run of lines that needs to be
+ * re-rendered, using the band conventions of MDP_RENDER_FLAG_BAND_SAFE.
+ * @param renderInfo Render information.
+ * @param scale Number of destination lines per source line.
+ * @param radius Number of source lines above and below a line that affect
+ * its output. (0 to MDP_RENDER_DIRTY_LINES_PAD)
+ * @param blit Band-safe blit function.
+ * @return MDP error code.
+ */
+static inline int mdp_render_dirty_blit(const mdp_render_info_t *renderInfo,
+					int scale, int radius, mdp_render_fn blit)
+{
+	mdp_render_info_t band;
+	int y, start, ret;
+
+	if (!(renderInfo->vmodeFlags & MDP_RENDER_VMODE_DIRTY_LINES))
+		return blit(renderInfo);
+
+	band = *renderInfo;
+	band.vmodeFlags &= ~MDP_RENDER_VMODE_DIRTY_LINES;
+
+	for (y = 0; y < renderInfo->height; y++)
+	{
+		if (!mdp_render_dirty_line(renderInfo->dirtyLines, y, radius))
+			continue;
+
+		/* Find the end of this run. */
+		start = y;
+		while (y + 1 < renderInfo->height &&
+		       mdp_render_dirty_line(renderInfo->dirtyLines, y + 1, radius))
+		{
+			y++;
+		}
+
+		band.mdScreen = (uint8_t*)renderInfo->mdScreen + (start * renderInfo->srcPitch);
+		band.destScreen = (uint8_t*)renderInfo->destScreen + (start * scale * renderInfo->destPitch);
+		band.height = (y - start + 1);
+		band.dirtyLines = renderInfo->dirtyLines + start;
+
+		ret = blit(&band);
+		if (ret != 0)
+			return ret;
+	}
+
+	return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MDP_RENDER_DIRTY_H */
@@ -21,15 +21,103 @@
 
 #include "main.h"
 #include "plugin_check.h"
+#include "render.hpp"
+
+// MDP includes.
+#include "mdp/mdp_cpuflags.h"
 
 // C includes.
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 // libgsft includes.
 #include "libgsft/gsft_szprintf.h"
 #include "libgsft/gsft_strlcpy.h"
 
+/**
+ * get_cpu_flags(): Get the CPU flags.
+ * @return MDP CPU flags.
+ */
+static uint32_t get_cpu_flags(void)
+{
+	uint32_t cpuFlags = 0;
+#if defined(__GNUC__) && (defined(__i386__) || defined(__amd64__)) && \
+    ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 8))
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("mmx"))
+		cpuFlags |= MDP_CPUFLAG_X86_MMX;
+	if (__builtin_cpu_supports("sse"))
+		cpuFlags |= MDP_CPUFLAG_X86_SSE;
+	if (__builtin_cpu_supports("sse2"))
+		cpuFlags |= MDP_CPUFLAG_X86_SSE2;
+	if (__builtin_cpu_supports("sse3"))
+		cpuFlags |= MDP_CPUFLAG_X86_SSE3;
+	if (__builtin_cpu_supports("ssse3"))
+		cpuFlags |= MDP_CPUFLAG_X86_SSSE3;
+	if (__builtin_cpu_supports("sse4.1"))
+		cpuFlags |= MDP_CPUFLAG_X86_SSE41;
+	if (__builtin_cpu_supports("sse4.2"))
+		cpuFlags |= MDP_CPUFLAG_X86_SSE42;
+	if (__builtin_cpu_supports("avx"))
+		cpuFlags |= MDP_CPUFLAG_X86_AVX;
+	if (__builtin_cpu_supports("avx2"))
+		cpuFlags |= MDP_CPUFLAG_X86_AVX2;
+#endif
+	return cpuFlags;
+}
+
+
+/**
+ * usage(): Print the usage information.
+ * @param exe_name Executable name.
+ */
+static void usage(const char *exe_name)
+{
+	fprintf(stderr, "Usage: %s [options] filename [filename...]\n\n"
+		"Options:\n"
+		"  -b, --bench             Benchmark each renderer.\n"
+		"  -i, --iterations=N      Number of blits per benchmark. (default is %d)\n"
+		"  -c, --cpuflags=FLAGS    Mask the detected CPU flags. (hex)\n"
+		"  -g, --golden=FILE       Check the renderer output against golden hashes.\n"
+		"  -w, --write-golden=FILE Write the renderer output hashes to a file.\n",
+		exe_name, renderer_options.iterations);
+}
+
+
+/**
+ * get_option_arg(): Get the argument for an option.
+ * @param argc Number of arguments.
+ * @param argv Arguments.
+ * @param i [in, out] Index of the current argument.
+ * @param short_opt Short option. ("-x")
+ * @param long_opt Long option. ("--xxx")
+ * @return Option argument, or NULL if argv[*i] isn't this option.
+ */
+static const char *get_option_arg(int argc, char *argv[], int *i,
+				  const char *short_opt, const char *long_opt)
+{
+	const char *arg = argv[*i];
+	const size_t long_len = strlen(long_opt);
+	
+	if (!strcmp(arg, short_opt) || !strcmp(arg, long_opt))
+	{
+		// Argument is the next parameter.
+		if (*i + 1 >= argc)
+			return NULL;
+		(*i)++;
+		return argv[*i];
+	}
+	else if (!strncmp(arg, long_opt, long_len) && arg[long_len] == '=')
+	{
+		// Argument is part of this parameter.
+		return &arg[long_len + 1];
+	}
+	
+	return NULL;
+}
+
+
 int main(int argc, char *argv[])
 {
 	fprintf(stderr, "MDP: Mega Drive Plugins %d.%d.%d\n"
@@ -50,32 +138,73 @@ int main(int argc, char *argv[])
 #endif
 	       );
 	
-	// Check parameters.
-	if (argc <= 1)
-	{
-		// No plugins specified.
-		const char *exe_name;
+	const char *exe_name;
 #ifdef _WIN32
-		// Only display the filename.
-		exe_name = strrchr(argv[0], DIRSEP_CHR);
-		if (!exe_name)
-			exe_name = argv[0];
-		else
-			exe_name++;
-#else
-		// Display the whole argv[0].
+	// Only display the filename.
+	exe_name = strrchr(argv[0], DIRSEP_CHR);
+	if (!exe_name)
 		exe_name = argv[0];
+	else
+		exe_name++;
+#else
+	// Display the whole argv[0].
+	exe_name = argv[0];
 #endif
-		
-		fprintf(stderr, "Usage: %s filename [filename...]\n", exe_name);
+	
+	// Parse options.
+	const char *golden_read = NULL;
+	const char *golden_write = NULL;
+	renderer_options.cpuFlags = get_cpu_flags();
+	
+	int i;
+	for (i = 1; i < argc; i++)
+	{
+		const char *arg;
+		if (argv[i][0] != '-')
+		{
+			// First plugin filename.
+			break;
+		}
+		else if (!strcmp(argv[i], "-b") || !strcmp(argv[i], "--bench"))
+			renderer_options.bench = 1;
+		else if ((arg = get_option_arg(argc, argv, &i, "-i", "--iterations")) != NULL)
+			renderer_options.iterations = atoi(arg);
+		else if ((arg = get_option_arg(argc, argv, &i, "-c", "--cpuflags")) != NULL)
+			renderer_options.cpuFlags &= (uint32_t)strtoul(arg, NULL, 16);
+		else if ((arg = get_option_arg(argc, argv, &i, "-g", "--golden")) != NULL)
+			golden_read = arg;
+		else if ((arg = get_option_arg(argc, argv, &i, "-w", "--write-golden")) != NULL)
+			golden_write = arg;
+		else
+		{
+			fprintf(stderr, "%s: unrecognized option '%s'\n", exe_name, argv[i]);
+			usage(exe_name);
+			return EXIT_FAILURE;
+		}
+	}
+	
+	// Check parameters.
+	const int first_plugin = i;
+	if (first_plugin >= argc)
+	{
+		// No plugins specified.
+		usage(exe_name);
 		return EXIT_FAILURE;
 	}
 	
+	// Load the golden hashes.
+	if (golden_read && renderer_golden_load(golden_read) != 0)
+	{
+		fprintf(stderr, "%s: cannot open golden hash file '%s'\n", exe_name, golden_read);
+		return EXIT_FAILURE;
+	}
+	
+	printf("CPU flags: 0x%08X\n\n", renderer_options.cpuFlags);
+	
 	// Check all plugins.
-	int i;
 	int success_count = 0;
 	char dll_filename[PATH_MAX];
-	for (i = 1; i < argc; i++)
+	for (i = first_plugin; i < argc; i++)
 	{
 #ifndef _WIN32
 		// If a relative pathname is specified, add "./" to it.
@@ -99,6 +228,16 @@ int main(int argc, char *argv[])
 		putchar('\n');
 	}
 	
+	const int plugin_count = argc - first_plugin;
 	printf("%d/%d plugin%s tested successfully.\n",
-	       success_count, argc-1, (success_count == 1 ? "" : "s"));
+	       success_count, plugin_count, (success_count == 1 ? "" : "s"));
+	
+	// Save the golden hashes.
+	if (golden_write && renderer_golden_save(golden_write) != 0)
+	{
+		fprintf(stderr, "%s: cannot write golden hash file '%s'\n", exe_name, golden_write);
+		return EXIT_FAILURE;
+	}
+	
+	return (success_count == plugin_count ? EXIT_SUCCESS : EXIT_FAILURE);
 }
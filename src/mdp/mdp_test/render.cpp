@@ -24,19 +24,52 @@
 
 #include "mdp/mdp_error.h"
 
+// MDP includes.
+#include "mdp/mdp_cpuflags.h"
+
+// libgsft includes.
+#include "libgsft/gsft_szprintf.h"
+
 // C includes.
 #include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+// Timer.
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
 // C++ includes.
 #include <list>
+#include <map>
+#include <string>
 using std::list;
+using std::map;
+using std::string;
 
 // List of plugins.
 list<mdp_render_t*> lstPlugins;
 typedef list<mdp_render_t*>::iterator iterPlugin_t;
 
+// Renderer test options.
+renderer_options_t renderer_options =
+{
+	0,	// cpuFlags
+	0,	// bench
+	100,	// iterations
+};
+
+// Golden hashes.
+// Key: "tag\tvmode WxH"
+static map<string, uint64_t> golden_expected;
+static map<string, uint64_t> golden_actual;
+static int golden_is_loaded = 0;
+typedef map<string, uint64_t>::iterator iterGolden_t;
+
 static int renderer_test(mdp_render_t *renderer);
 
 
@@ -198,137 +231,538 @@ int renderer_test_all(void)
 }
 
 
+/** Test image. **/
+
 /**
- * renderer_test(): Test a renderer.
- * @param renderer Renderer.
+ * The source buffer is laid out like the emulator's MD screen buffer:
+ * 336 pixels per line, with the image starting at pixel 8.
+ * There are two extra lines above and below the image, since some
+ * renderers read outside of the image.
  */
-static int renderer_test(mdp_render_t *renderer)
+#define TEST_SRC_PITCH		336
+#define TEST_SRC_OFFSET_X	8
+#define TEST_SRC_LINES		(240 + 4)
+#define TEST_SRC_OFFSET_Y	2
+
+/**
+ * test_sizes[]: Image sizes to test.
+ * These are the MD's H40/H32 and V28/V30 display modes.
+ */
+static const struct
 {
-	if (!renderer)
-		return -MDP_ERR_INVALID_PARAMETERS;
+	int width;
+	int height;
+} test_sizes[] =
+{
+	{320, 224},
+	{320, 240},
+	{256, 224},
+	{256, 240},
+};
+
+/**
+ * test_cpu_levels[]: CPU flag levels to test.
+ * Each level is masked with renderer_options.cpuFlags.
+ * Levels that are identical to the previous level are skipped.
+ */
+static const struct
+{
+	const char *name;
+	uint32_t cpuFlags;
+} test_cpu_levels[] =
+{
+	{"C",		0},
+#if defined(__i386__) || defined(__amd64__)
+	{"MMX",		MDP_CPUFLAG_X86_MMX | MDP_CPUFLAG_X86_MMXEXT |
+			MDP_CPUFLAG_X86_3DNOW | MDP_CPUFLAG_X86_3DNOWEXT |
+			MDP_CPUFLAG_X86_SSE},
+	{"SSE2",	~(MDP_CPUFLAG_X86_AVX | MDP_CPUFLAG_X86_AVX2)},
+	{"AVX2",	~0U},
+#endif
+};
+
+#define TEST_ARRAY_SIZE(x) ((int)(sizeof(x) / sizeof(x[0])))
+
+// Color mode names.
+static const char *const vmode_names[3] = {"555", "565", "888"};
+
+/**
+ * test_pattern_color(): Get a test pattern color.
+ * The test pattern has flat areas, diagonal lines, gradients, and noise,
+ * so the edge detection paths of most renderers are used.
+ * @param x X position.
+ * @param y Y position.
+ * @return RGB888 color.
+ */
+static uint32_t test_pattern_color(int x, int y)
+{
+	static const uint32_t palette[4] = {0x000000, 0xF8F8F8, 0xE02020, 0x2060C0};
+	
+	// Pseudo-random value for this pixel.
+	uint32_t rnd = ((uint32_t)x * 0x9E3779B1U) ^ ((uint32_t)y * 0x85EBCA77U);
+	rnd ^= (rnd >> 15);
+	rnd *= 0x2C1B3C6DU;
+	rnd ^= (rnd >> 12);
 	
+	switch (((x >> 4) + (y >> 4)) & 3)
+	{
+		case 0:
+			// Flat area.
+			return palette[((x >> 4) ^ (y >> 3)) & 3];
+		case 1:
+			// Diagonal lines.
+			return palette[((x + y) / 3) & 3];
+		case 2:
+			// Gradient.
+			return (((x * 3) & 0xFF) << 16) | (((y * 5) & 0xFF) << 8) | ((x ^ y) & 0xFF);
+		default:
+			// Noise.
+			return palette[rnd & 3];
+	}
+}
+
+/**
+ * test_pattern_fill(): Fill the source buffer with the test pattern.
+ * @param src Source buffer.
+ * @param vmode Color mode.
+ */
+static void test_pattern_fill(uint8_t *src, uint32_t vmode)
+{
+	for (int y = 0; y < TEST_SRC_LINES; y++)
+	{
+		for (int x = 0; x < TEST_SRC_PITCH; x++)
+		{
+			const uint32_t c = test_pattern_color(x, y);
+			const unsigned int r = (c >> 16) & 0xFF;
+			const unsigned int g = (c >> 8) & 0xFF;
+			const unsigned int b = c & 0xFF;
+			const int px = (y * TEST_SRC_PITCH) + x;
+			
+			switch (vmode)
+			{
+				case MDP_RENDER_VMODE_RGB_555:
+					((uint16_t*)src)[px] = ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3);
+					break;
+				case MDP_RENDER_VMODE_RGB_565:
+					((uint16_t*)src)[px] = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+					break;
+				case MDP_RENDER_VMODE_RGB_888:
+				default:
+					((uint32_t*)src)[px] = c;
+					break;
+			}
+		}
+	}
+}
+
+/**
+ * test_hash(): Hash the visible area of an image. (64-bit FNV-1a)
+ * Pixels are hashed in little-endian byte order,
+ * so the hash is the same on all systems.
+ * @param buf Image.
+ * @param pitch Pitch of the image, in bytes.
+ * @param width Image width, in pixels.
+ * @param height Image height, in pixels.
+ * @param bpp Bytes per pixel. (2, 4)
+ * @return Hash.
+ */
+static uint64_t test_hash(const uint8_t *buf, int pitch, int width, int height, int bpp)
+{
+	uint64_t hash = 0xCBF29CE484222325ULL;
+	for (int y = 0; y < height; y++, buf += pitch)
+	{
+		for (int x = 0; x < width; x++)
+		{
+			uint32_t px = (bpp == 4 ? ((const uint32_t*)buf)[x] : ((const uint16_t*)buf)[x]);
+			for (int i = bpp; i != 0; i--, px >>= 8)
+			{
+				hash ^= (px & 0xFF);
+				hash *= 0x100000001B3ULL;
+			}
+		}
+	}
+	return hash;
+}
+
+/**
+ * test_timer_ms(): Get the current time.
+ * @return Current time, in milliseconds.
+ */
+static double test_timer_ms(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER freq, count;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&count);
+	return ((double)count.QuadPart * 1000.0) / (double)freq.QuadPart;
+#else
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return ((double)tv.tv_sec * 1000.0) + ((double)tv.tv_usec / 1000.0);
+#endif
+}
+
+/**
+ * test_buf_check(): Check if a buffer only contains a single value.
+ * @param buf Buffer.
+ * @param size Size of the buffer.
+ * @param chr Expected value.
+ * @return 0 if the buffer only contains chr; non-zero otherwise.
+ */
+static int test_buf_check(const uint8_t *buf, int size, uint8_t chr)
+{
+	for (int i = 0; i < size; i++)
+	{
+		if (buf[i] != chr)
+			return 1;
+	}
+	return 0;
+}
+
+
+/**
+ * renderer_test_vmode(): Test a renderer with a single video mode and image size.
+ * @param renderer Renderer.
+ * @param src_vmode Source color mode.
+ * @param dst_vmode Destination color mode.
+ * @param width Image width.
+ * @param height Image height.
+ * @return 0 if the test passed; non-zero otherwise.
+ */
+static int renderer_test_vmode(mdp_render_t *renderer,
+			       uint32_t src_vmode, uint32_t dst_vmode,
+			       int width, int height)
+{
 	int passed = 1;
+	const int src_bpp = (src_vmode == MDP_RENDER_VMODE_RGB_888 ? 4 : 2);
+	const int dst_bpp = (dst_vmode == MDP_RENDER_VMODE_RGB_888 ? 4 : 2);
+	const int scale = renderer->scale;
 	
-	putchar('\n');
-	TEST_START_ARGS("Testing renderer '%s'", renderer->tag);
+	char key[128];
+	szprintf(key, sizeof(key), "%s\t%sto%s %dx%d", renderer->tag,
+		 vmode_names[src_vmode], vmode_names[dst_vmode], width, height);
+	
+	TEST_START_ARGS("RGB%s -> RGB%s, %dx%d",
+			vmode_names[src_vmode], vmode_names[dst_vmode], width, height);
 	putchar('\n');
 	
-	// Print supported video formats.
-	TEST_INFO_ARGS("renderer_test(): Supported video formats for renderer '%s':", renderer->tag);
-	if (renderer->flags & MDP_RENDER_FLAG_RGB_555to555)
-		TEST_INFO_ARGS("\tRGB555 -> RGB555");
-	if (renderer->flags & MDP_RENDER_FLAG_RGB_555to565)
-		TEST_INFO_ARGS("\tRGB555 -> RGB565");
-	if (renderer->flags & MDP_RENDER_FLAG_RGB_555to888)
-		TEST_INFO_ARGS("\tRGB555 -> RGB888");
-	if (renderer->flags & MDP_RENDER_FLAG_RGB_565to555)
-		TEST_INFO_ARGS("\tRGB565 -> RGB555");
-	if (renderer->flags & MDP_RENDER_FLAG_RGB_565to565)
-		TEST_INFO_ARGS("\tRGB565 -> RGB565");
-	if (renderer->flags & MDP_RENDER_FLAG_RGB_565to888)
-		TEST_INFO_ARGS("\tRGB565 -> RGB888");
-	if (renderer->flags & MDP_RENDER_FLAG_RGB_888to555)
-		TEST_INFO_ARGS("\tRGB888 -> RGB555");
-	if (renderer->flags & MDP_RENDER_FLAG_RGB_888to565)
-		TEST_INFO_ARGS("\tRGB888 -> RGB565");
-	if (renderer->flags & MDP_RENDER_FLAG_RGB_888to888)
-		TEST_INFO_ARGS("\tRGB888 -> RGB888");
-	
-	// Allocate a source buffer large enough for 336x240, 32-bit color.
-	// The buffer also has 16 bytes of padding at the beginning.
-	int src_size = (336*240*4)+16;
+	// Allocate the source buffer and fill it with the test pattern.
+	// A copy is kept to make sure the renderer doesn't modify it.
+	const int src_pitch = TEST_SRC_PITCH * src_bpp;
+	const int src_size = src_pitch * TEST_SRC_LINES;
 	uint8_t *src = (uint8_t*)malloc(src_size);
+	uint8_t *src_orig = (uint8_t*)malloc(src_size);
+	test_pattern_fill(src, src_vmode);
+	memcpy(src_orig, src, src_size);
 	
-	// Allocate a destination buffer large enough for 3 times 336*240.
-	int dest_size = (336 * renderer->scale) * (240 * renderer->scale) * 4;
+	// Allocate a destination buffer large enough for 3 times the image.
+	// The image is rendered to the middle third.
+	const int dest_pitch = width * scale * dst_bpp;
+	const int dest_size = dest_pitch * height * scale;
 	uint8_t *dest = (uint8_t*)malloc(dest_size * 3);
-	
-	// Test 565to565.
-	TEST_START("Testing RGB565 -> RGB565");
-	putchar('\n');
-	
-	// TODO: More video modes.
-	
-	// Fill the source and destination buffers with a random value.
-	uint8_t rnd_chr = 0x7A; // TODO: Use a random value.
-	memset(src, rnd_chr, src_size);
-	memset(dest, rnd_chr, dest_size * 3);
+	const uint8_t rnd_chr = 0x7A;
 	
 	// Create the render information.
 	mdp_render_info_t render_info;
-	render_info.destScreen = &dest[dest_size];		// Start in the middle of the dest buffer.
-	render_info.mdScreen = &src[16];			// Start at 16 bytes into the src buffer.
-	render_info.destPitch = (320 * renderer->scale) * 2;	// Destination pitch.
-	render_info.srcPitch = 336 * 2;				// Source pitch.
-	render_info.width = 320;				// Width.
-	render_info.height = 224;				// Height.
-	render_info.cpuFlags = 0xFFFFFFFF;			// TODO: Use actual CPU flags.
-	render_info.vmodeFlags = MDP_RENDER_VMODE_CREATE(MDP_RENDER_VMODE_RGB_565, MDP_RENDER_VMODE_RGB_565);
+	render_info.destScreen = &dest[dest_size];
+	render_info.mdScreen = &src[(TEST_SRC_OFFSET_Y * src_pitch) + (TEST_SRC_OFFSET_X * src_bpp)];
+	render_info.destPitch = dest_pitch;
+	render_info.srcPitch = src_pitch;
+	render_info.width = width;
+	render_info.height = height;
+	render_info.vmodeFlags = MDP_RENDER_VMODE_CREATE(src_vmode, dst_vmode);
 	render_info.data = NULL;
 	
-	// Run the renderer.
-	renderer->blit(&render_info);
-	
-	// Check the source buffer to make sure it wasn't changed.
-	uint8_t *src_chk = &src[src_size-1];
-	unsigned int i;
-	for (i = src_size; i != 0; i--)
+	// Test each CPU level.
+	uint64_t hash = 0;
+	uint32_t prev_cpuFlags = ~0U;
+	for (int level = 0; level < TEST_ARRAY_SIZE(test_cpu_levels); level++)
 	{
-		if (*src_chk != rnd_chr)
+		const uint32_t cpuFlags = (test_cpu_levels[level].cpuFlags & renderer_options.cpuFlags);
+		if (level > 0 && cpuFlags == prev_cpuFlags)
+			continue;
+		prev_cpuFlags = cpuFlags;
+		render_info.cpuFlags = cpuFlags;
+		
+		// Run the renderer.
+		memset(dest, rnd_chr, dest_size * 3);
+		int rval = renderer->blit(&render_info);
+		if (rval != MDP_ERR_OK)
 		{
-			// Source buffer was changed!
-			TEST_FAIL("Source buffer was modified!");
+			TEST_FAIL_ARGS("%s: blit() returned MDP error code 0x%08X.",
+				       test_cpu_levels[level].name, -rval);
 			passed = 0;
 			break;
 		}
-		src_chk--;
+		
+		// Make sure the renderer only wrote to the visible area.
+		if (memcmp(src, src_orig, src_size) != 0)
+		{
+			TEST_FAIL_ARGS("%s: Source buffer was modified!", test_cpu_levels[level].name);
+			passed = 0;
+			memcpy(src, src_orig, src_size);
+		}
+		if (test_buf_check(dest, dest_size, rnd_chr))
+		{
+			TEST_FAIL_ARGS("%s: Destination buffer was modified before the visible area.",
+				       test_cpu_levels[level].name);
+			passed = 0;
+		}
+		if (test_buf_check(&dest[dest_size * 2], dest_size, rnd_chr))
+		{
+			TEST_FAIL_ARGS("%s: Destination buffer was modified after the visible area.",
+				       test_cpu_levels[level].name);
+			passed = 0;
+		}
+		
+		// All CPU levels must have the same output.
+		const uint64_t level_hash = test_hash(&dest[dest_size], dest_pitch,
+						      width * scale, height * scale, dst_bpp);
+		if (level == 0)
+		{
+			hash = level_hash;
+		}
+		else if (level_hash != hash)
+		{
+			TEST_FAIL_ARGS("%s: Output doesn't match the C version.", test_cpu_levels[level].name);
+			passed = 0;
+		}
+		
+		// Benchmark this CPU level.
+		if (renderer_options.bench && renderer_options.iterations > 0)
+		{
+			const double start = test_timer_ms();
+			for (int i = renderer_options.iterations; i != 0; i--)
+				renderer->blit(&render_info);
+			const double ms = (test_timer_ms() - start) / renderer_options.iterations;
+			
+			// MPix/s is measured in source pixels.
+			TEST_INFO_ARGS("%-4s %8.3f ms/frame, %8.2f MPix/s",
+				       test_cpu_levels[level].name, ms,
+				       (ms > 0 ? ((double)(width * height) / (ms * 1000.0)) : 0.0));
+		}
 	}
-	if (i == 0)
-		TEST_PASS_MSG("Source buffer was not modified.");
-	
-	// Check the destination buffer to make sure the correct areas were written.
 	
-	// Check the prebuffer.
-	uint8_t *dest_chk = &dest[dest_size-1];
-	for (i = dest_size; i != 0; i--)
+	// Band-safe renderers must have the same output if the image is rendered in bands.
+	if (passed && (renderer->flags & MDP_RENDER_FLAG_BAND_SAFE))
 	{
-		if (*dest_chk != rnd_chr)
+		memset(dest, rnd_chr, dest_size * 3);
+		render_info.cpuFlags = renderer_options.cpuFlags;
+		const int band_height = (height + 3) / 4;
+		for (int y = 0; y < height; y += band_height)
 		{
-			// Destination prebuffer was changed!
-			TEST_FAIL("Destination buffer was modified before the visible area.");
+			mdp_render_info_t band_info = render_info;
+			band_info.mdScreen = (uint8_t*)render_info.mdScreen + (y * src_pitch);
+			band_info.destScreen = (uint8_t*)render_info.destScreen + (y * scale * dest_pitch);
+			band_info.height = (y + band_height > height ? height - y : band_height);
+			renderer->blit(&band_info);
+		}
+		
+		if (test_hash(&dest[dest_size], dest_pitch, width * scale, height * scale, dst_bpp) != hash)
+		{
+			TEST_FAIL("Output rendered in bands doesn't match the full image.");
 			passed = 0;
-			break;
 		}
-		dest_chk--;
 	}
-	if (i == 0)
-		TEST_PASS_MSG("Destination buffer was not modified before the visible area.");
 	
-	// TODO: Check the main buffer.
-	TEST_INFO("TODO: Check the main rendering buffer.");
-	
-	// Check the postbuffer.
-	dest_chk = &dest[(dest_size*3)-1];
-	for (i = dest_size; i != 0; i--)
+	// Dirty-line renderers must produce the full image if only the changed lines are rendered.
+	if (passed && (renderer->flags & MDP_RENDER_FLAG_DIRTY_LINES))
 	{
-		if (*dest_chk != rnd_chr)
+		render_info.cpuFlags = renderer_options.cpuFlags;
+		
+		// Render the original image.
+		memset(dest, rnd_chr, dest_size * 3);
+		renderer->blit(&render_info);
+		
+		// Change a few lines, including two adjacent lines.
+		uint8_t dirty[MDP_RENDER_DIRTY_LINES_PAD + TEST_SRC_LINES + MDP_RENDER_DIRTY_LINES_PAD];
+		memset(dirty, 0x00, sizeof(dirty));
+		const int changed[3] = {height / 3, (height * 2) / 3, ((height * 2) / 3) + 1};
+		for (int i = 0; i < TEST_ARRAY_SIZE(changed); i++)
+		{
+			uint8_t *line = (uint8_t*)render_info.mdScreen + (changed[i] * src_pitch);
+			for (int x = 0; x < width * src_bpp; x++)
+				line[x] ^= 0x5A;
+			dirty[MDP_RENDER_DIRTY_LINES_PAD + changed[i]] = 1;
+		}
+		
+		// Render the changed lines on top of the original image.
+		mdp_render_info_t dirty_info = render_info;
+		dirty_info.vmodeFlags |= MDP_RENDER_VMODE_DIRTY_LINES;
+		dirty_info.dirtyLines = &dirty[MDP_RENDER_DIRTY_LINES_PAD];
+		renderer->blit(&dirty_info);
+		const uint64_t dirty_hash = test_hash(&dest[dest_size], dest_pitch,
+						      width * scale, height * scale, dst_bpp);
+		if (test_buf_check(dest, dest_size, rnd_chr) ||
+		    test_buf_check(&dest[dest_size * 2], dest_size, rnd_chr))
 		{
-			// Destination postbuffer was changed!
-			TEST_FAIL("Destination buffer was modified after the visible area.");
+			TEST_FAIL("Dirty line rendering modified the destination buffer outside of the visible area.");
+			passed = 0;
+		}
+		
+		// Render the changed image in full.
+		renderer->blit(&render_info);
+		if (test_hash(&dest[dest_size], dest_pitch, width * scale, height * scale, dst_bpp) != dirty_hash)
+		{
+			TEST_FAIL("Output rendered with dirty lines doesn't match the full image.");
 			passed = 0;
-			break;
 		}
-		dest_chk--;
+		
+		memcpy(src, src_orig, src_size);
 	}
-	if (i == 0)
-		TEST_PASS_MSG("Destination buffer was not modified after the visible area.");
 	
-	// Free the buffers.
+	// Check the golden hash.
+	if (passed)
+	{
+		golden_actual[key] = hash;
+		if (golden_is_loaded)
+		{
+			iterGolden_t iter = golden_expected.find(key);
+			if (iter == golden_expected.end())
+			{
+				TEST_WARN_ARGS("No golden hash. (%016llX)", (unsigned long long)hash);
+			}
+			else if (iter->second != hash)
+			{
+				TEST_FAIL_ARGS("Output hash %016llX doesn't match the golden hash %016llX.",
+					       (unsigned long long)hash, (unsigned long long)iter->second);
+				passed = 0;
+			}
+		}
+	}
+	
+	if (passed)
+		TEST_PASS();
+	
 	free(src);
+	free(src_orig);
 	free(dest);
+	return (passed ? MDP_ERR_OK : -MDP_ERR_UNKNOWN);
+}
+
+
+/**
+ * renderer_test(): Test a renderer.
+ * Each supported video mode is tested with each image size.
+ * @param renderer Renderer.
+ */
+static int renderer_test(mdp_render_t *renderer)
+{
+	if (!renderer)
+		return -MDP_ERR_INVALID_PARAMETERS;
+	
+	int passed = 1;
+	
 	putchar('\n');
+	TEST_START_ARGS("Testing renderer '%s'", renderer->tag);
+	putchar('\n');
+	
+	if (renderer->scale <= 0)
+	{
+		TEST_FAIL_ARGS("Invalid scaling ratio: %d", renderer->scale);
+		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
+	}
+	
+	// Test all supported video modes.
+	// MDP_RENDER_FLAG_RGB_*to* are ordered by source mode, then destination mode.
+	int vmodes_tested = 0;
+	for (uint32_t src_vmode = 0; src_vmode < 3; src_vmode++)
+	{
+		for (uint32_t dst_vmode = 0; dst_vmode < 3; dst_vmode++)
+		{
+			if (!(renderer->flags & (1U << ((src_vmode * 3) + dst_vmode))))
+				continue;
+			
+			vmodes_tested++;
+			for (int i = 0; i < TEST_ARRAY_SIZE(test_sizes); i++)
+			{
+				if (renderer_test_vmode(renderer, src_vmode, dst_vmode,
+							test_sizes[i].width, test_sizes[i].height) != 0)
+				{
+					passed = 0;
+				}
+			}
+		}
+	}
+	
+	if (vmodes_tested == 0)
+	{
+		TEST_FAIL("Renderer doesn't support any video modes.");
+		passed = 0;
+	}
 	
+	putchar('\n');
 	if (passed)
 		return MDP_ERR_OK;
 	return -MDP_ERR_UNKNOWN;
 }
+
+
+/**
+ * renderer_golden_load(): Load golden hashes from a file.
+ * Each line has the format: "hash vmode WxH tag"
+ * Lines starting with '#' are comments.
+ * @param filename Filename.
+ * @return 0 on success; non-zero on error.
+ */
+int renderer_golden_load(const char *filename)
+{
+	FILE *f = fopen(filename, "r");
+	if (!f)
+		return -1;
+	
+	char line[256];
+	while (fgets(line, sizeof(line), f))
+	{
+		// Remove the trailing newline.
+		line[strcspn(line, "\r\n")] = 0;
+		if (line[0] == '#' || line[0] == 0)
+			continue;
+		
+		char hash_str[32], vmode[16], size[16];
+		int tag_pos = 0;
+		if (sscanf(line, "%31s %15s %15s %n", hash_str, vmode, size, &tag_pos) != 3 ||
+		    tag_pos == 0 || line[tag_pos] == 0)
+		{
+			// Invalid line.
+			continue;
+		}
+		
+		string key = string(&line[tag_pos]) + '\t' + vmode + ' ' + size;
+		golden_expected[key] = strtoull(hash_str, NULL, 16);
+	}
+	
+	fclose(f);
+	golden_is_loaded = 1;
+	return 0;
+}
+
+
+/**
+ * renderer_golden_save(): Save the hashes from this run as golden hashes.
+ * @param filename Filename.
+ * @return 0 on success; non-zero on error.
+ */
+int renderer_golden_save(const char *filename)
+{
+	FILE *f = fopen(filename, "w");
+	if (!f)
+		return -1;
+	
+	fprintf(f, "# MDP Test Suite: Renderer golden hashes.\n"
+		   "# Generated by \"mdp_test -w\" with all render plugins.\n"
+		   "# Format: hash vmode WxH tag\n");
+	for (iterGolden_t iter = golden_actual.begin();
+	     iter != golden_actual.end(); iter++)
+	{
+		// Key: "tag\tvmode WxH"
+		const string &key = iter->first;
+		const size_t tab = key.find('\t');
+		fprintf(f, "%016llX %s %s\n", (unsigned long long)iter->second,
+			key.substr(tab + 1).c_str(), key.substr(0, tab).c_str());
+	}
+	
+	fclose(f);
+	return 0;
+}
+
@@ -24,6 +24,7 @@
 
 #include "mdp/mdp.h"
 #include "mdp/mdp_render.h"
+#include "mdp/mdp_stdint.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,10 +33,26 @@ extern "C" {
 int mdp_host_renderer_register(mdp_t *plugin, mdp_render_t *renderer);
 int mdp_host_renderer_unregister(mdp_t *plugin, mdp_render_t *renderer);
 
+/**
+ * renderer_options_t: Renderer test options.
+ */
+typedef struct _renderer_options_t
+{
+	uint32_t cpuFlags;	/* CPU flags to test with. */
+	int bench;		/* If non-zero, benchmark each renderer. */
+	int iterations;		/* Number of blits per benchmark. */
+} renderer_options_t;
+
+extern renderer_options_t renderer_options;
+
 int renderer_clear(void);
 
 int renderer_test_all(void);
 
+/** Golden hashes. **/
+int renderer_golden_load(const char *filename);
+int renderer_golden_save(const char *filename);
+
 #ifdef __cplusplus
 }
 #endif
@@ -43,7 +43,8 @@ mdp_render_t mdp_render =
 	
 	.scale = 2,
 	.flags = MDP_RENDER_FLAG_RGB_555to555 |
-		 MDP_RENDER_FLAG_RGB_565to565
+		 MDP_RENDER_FLAG_RGB_565to565 |
+		 MDP_RENDER_FLAG_RGB_888to888
 };
 
 static mdp_func_t mdp_func =
@@ -56,11 +57,11 @@ mdp_t mdp =
 {
 	// Plugin version information.
 	.interfaceVersion = MDP_VERSION(1, 0, 0),
-	.pluginVersion = MDP_VERSION(1, 0, 0),
+	.pluginVersion = MDP_VERSION(1, 1, 0),
 	
 	// CPU flags.
-	.cpuFlagsSupported = MDP_CPUFLAG_X86_MMX,
-	.cpuFlagsRequired = MDP_CPUFLAG_X86_MMX,
+	.cpuFlagsSupported = MDP_CPUFLAG_X86_MMX | MDP_CPUFLAG_X86_SSE2 | MDP_CPUFLAG_X86_AVX2,
+	.cpuFlagsRequired = 0,
 	
 	// UUID: 5c03f2ff-1c20-4f9b-b81c-458de6c7880d
 	.uuid = {0x5C, 0x03, 0xF2, 0xFF,
@@ -0,0 +1,399 @@
+/***************************************************************************
+ * MDP: 2xSaI, Super 2xSaI, and Super Eagle renderers. (C++ versions)      *
+ *                                                                         *
+ * Copyright (c) 1999-2002 by Stéphane Dallongeville                       *
+ * Copyright (c) 2003-2004 by Stéphane Akhoun                              *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ * 2xSaI Copyright (c) by Derek Liauw Kie Fa and Robert J. Ohannessian     *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation; either version 2.1 of the License, or  *
+ * (at your option) any later version.                                     *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef MDP_RENDER_SAI_HPP
+#define MDP_RENDER_SAI_HPP
+
+#include <stdlib.h>
+#include <string.h>
+
+// MDP includes.
+#include "mdp/mdp_stdint.h"
+#include "mdp/mdp_cpuflags.h"
+#include "mdp/mdp_error.h"
+#include "mdp/mdp_render.h"
+
+// SIMD intrinsics.
+#include "libgsft/gsft_simd.h"
+
+/**
+ * Output is identical to the 16-bit MMX versions, as long as the pixels
+ * outside of the image are black. (The MMX versions read whatever is in
+ * memory around the image.) Pixels outside of the image are black here.
+ */
+
+enum SAI_FILTER
+{
+	SAI_2XSAI		= 0,
+	SAI_SUPER_2XSAI		= 1,
+	SAI_SUPER_EAGLE		= 2,
+};
+
+/**
+ * sai_masks: Color masks for interpolation.
+ */
+template<typename pixel>
+struct sai_masks
+{
+	pixel colorMask;	// Pixel bits, excluding the lowest bit of each component.
+	pixel lowPixelMask;	// Lowest bit of each component.
+	pixel qcolorMask;	// Pixel bits, excluding the lowest two bits of each component.
+	pixel qlowPixelMask;	// Lowest two bits of each component.
+};
+
+static const sai_masks<uint16_t> sai_masks_15 = {0x7BDE, 0x0421, 0x739C, 0x0C63};
+static const sai_masks<uint16_t> sai_masks_16 = {0xF7DE, 0x0821, 0xE79C, 0x1863};
+static const sai_masks<uint32_t> sai_masks_32 = {0xFEFEFE, 0x010101, 0xFCFCFC, 0x030303};
+
+
+/**
+ * ops<pixel>: Vector operations used by the kernels.
+ * - vec: Vector type. (N pixels)
+ * - load(), set1(), zero(): Load a vector.
+ * - vand(), vor(), vxor(), vandnot(): Bitwise operations. vandnot(a, b) == (~a & b)
+ * - eq(), gt(): Compare pixels. gt() is a signed comparison.
+ * - add(), sub(), srl1(), srl2(): Per-pixel arithmetic.
+ * - any(): Check if any bits are set.
+ * - store2(): Interleave two vectors and store them.
+ */
+
+/** Scalar version. Also used for the end of each line in the SIMD versions. **/
+namespace sai_scalar
+{
+	template<typename pixel>
+	struct ops
+	{
+		typedef pixel vec;
+		enum { N = 1 };
+
+		static inline vec load(const pixel *p)		{ return *p; }
+		static inline vec set1(pixel n)			{ return n; }
+		static inline vec zero(void)			{ return 0; }
+		static inline vec vand(vec a, vec b)		{ return (a & b); }
+		static inline vec vor(vec a, vec b)		{ return (a | b); }
+		static inline vec vxor(vec a, vec b)		{ return (a ^ b); }
+		static inline vec vandnot(vec a, vec b)		{ return (~a & b); }
+		static inline vec eq(vec a, vec b)		{ return (a == b ? (pixel)~0 : 0); }
+		static inline vec add(vec a, vec b)		{ return (pixel)(a + b); }
+		static inline vec sub(vec a, vec b)		{ return (pixel)(a - b); }
+		static inline vec srl1(vec a)			{ return (a >> 1); }
+		static inline vec srl2(vec a)			{ return (a >> 2); }
+		static inline bool any(vec a)			{ return (a != 0); }
+
+		static inline vec gt(vec a, vec b)
+		{
+			if (sizeof(pixel) == 2)
+				return ((int16_t)a > (int16_t)b ? (pixel)~0 : 0);
+			return ((int32_t)a > (int32_t)b ? (pixel)~0 : 0);
+		}
+
+		static inline void store2(pixel *dst, vec a, vec b)
+		{
+			dst[0] = a;
+			dst[1] = b;
+		}
+	};
+
+#include "sai_kernel.hpp"
+}
+
+
+/** SIMD versions. **/
+
+#if defined(GSFT_SIMD_SSE2)
+GSFT_SIMD_BEGIN_SSE2
+namespace sai_sse2
+{
+	struct vops
+	{
+		typedef __m128i vec;
+
+		static inline vec zero(void)			{ return _mm_setzero_si128(); }
+		static inline vec vand(vec a, vec b)		{ return _mm_and_si128(a, b); }
+		static inline vec vor(vec a, vec b)		{ return _mm_or_si128(a, b); }
+		static inline vec vxor(vec a, vec b)		{ return _mm_xor_si128(a, b); }
+		static inline vec vandnot(vec a, vec b)		{ return _mm_andnot_si128(a, b); }
+		static inline bool any(vec a)			{ return (_mm_movemask_epi8(a) != 0); }
+	};
+
+	template<typename pixel> struct ops;
+
+	template<> struct ops<uint16_t> : vops
+	{
+		enum { N = 8 };
+
+		static inline vec load(const uint16_t *p)	{ return _mm_loadu_si128((const __m128i*)p); }
+		static inline vec set1(uint16_t n)		{ return _mm_set1_epi16((short)n); }
+		static inline vec eq(vec a, vec b)		{ return _mm_cmpeq_epi16(a, b); }
+		static inline vec gt(vec a, vec b)		{ return _mm_cmpgt_epi16(a, b); }
+		static inline vec add(vec a, vec b)		{ return _mm_add_epi16(a, b); }
+		static inline vec sub(vec a, vec b)		{ return _mm_sub_epi16(a, b); }
+		static inline vec srl1(vec a)			{ return _mm_srli_epi16(a, 1); }
+		static inline vec srl2(vec a)			{ return _mm_srli_epi16(a, 2); }
+
+		static inline void store2(uint16_t *dst, vec a, vec b)
+		{
+			_mm_storeu_si128((__m128i*)dst, _mm_unpacklo_epi16(a, b));
+			_mm_storeu_si128((__m128i*)(dst + N), _mm_unpackhi_epi16(a, b));
+		}
+	};
+
+	template<> struct ops<uint32_t> : vops
+	{
+		enum { N = 4 };
+
+		static inline vec load(const uint32_t *p)	{ return _mm_loadu_si128((const __m128i*)p); }
+		static inline vec set1(uint32_t n)		{ return _mm_set1_epi32((int)n); }
+		static inline vec eq(vec a, vec b)		{ return _mm_cmpeq_epi32(a, b); }
+		static inline vec gt(vec a, vec b)		{ return _mm_cmpgt_epi32(a, b); }
+		static inline vec add(vec a, vec b)		{ return _mm_add_epi32(a, b); }
+		static inline vec sub(vec a, vec b)		{ return _mm_sub_epi32(a, b); }
+		static inline vec srl1(vec a)			{ return _mm_srli_epi32(a, 1); }
+		static inline vec srl2(vec a)			{ return _mm_srli_epi32(a, 2); }
+
+		static inline void store2(uint32_t *dst, vec a, vec b)
+		{
+			_mm_storeu_si128((__m128i*)dst, _mm_unpacklo_epi32(a, b));
+			_mm_storeu_si128((__m128i*)(dst + N), _mm_unpackhi_epi32(a, b));
+		}
+	};
+
+#include "sai_kernel.hpp"
+}
+GSFT_SIMD_END
+#endif /* GSFT_SIMD_SSE2 */
+
+#if defined(GSFT_SIMD_AVX2)
+GSFT_SIMD_BEGIN_AVX2
+namespace sai_avx2
+{
+	struct vops
+	{
+		typedef __m256i vec;
+
+		static inline vec zero(void)			{ return _mm256_setzero_si256(); }
+		static inline vec vand(vec a, vec b)		{ return _mm256_and_si256(a, b); }
+		static inline vec vor(vec a, vec b)		{ return _mm256_or_si256(a, b); }
+		static inline vec vxor(vec a, vec b)		{ return _mm256_xor_si256(a, b); }
+		static inline vec vandnot(vec a, vec b)		{ return _mm256_andnot_si256(a, b); }
+		static inline bool any(vec a)			{ return !_mm256_testz_si256(a, a); }
+
+		/**
+		 * AVX2 unpack instructions work within 128-bit lanes.
+		 * Swap the middle lanes to get the results in order.
+		 */
+		static inline void vstore_lanes(void *dst, vec lo, vec hi)
+		{
+			_mm256_storeu_si256((__m256i*)dst, _mm256_permute2x128_si256(lo, hi, 0x20));
+			_mm256_storeu_si256((__m256i*)dst + 1, _mm256_permute2x128_si256(lo, hi, 0x31));
+		}
+	};
+
+	template<typename pixel> struct ops;
+
+	template<> struct ops<uint16_t> : vops
+	{
+		enum { N = 16 };
+
+		static inline vec load(const uint16_t *p)	{ return _mm256_loadu_si256((const __m256i*)p); }
+		static inline vec set1(uint16_t n)		{ return _mm256_set1_epi16((short)n); }
+		static inline vec eq(vec a, vec b)		{ return _mm256_cmpeq_epi16(a, b); }
+		static inline vec gt(vec a, vec b)		{ return _mm256_cmpgt_epi16(a, b); }
+		static inline vec add(vec a, vec b)		{ return _mm256_add_epi16(a, b); }
+		static inline vec sub(vec a, vec b)		{ return _mm256_sub_epi16(a, b); }
+		static inline vec srl1(vec a)			{ return _mm256_srli_epi16(a, 1); }
+		static inline vec srl2(vec a)			{ return _mm256_srli_epi16(a, 2); }
+
+		static inline void store2(uint16_t *dst, vec a, vec b)
+			{ vstore_lanes(dst, _mm256_unpacklo_epi16(a, b), _mm256_unpackhi_epi16(a, b)); }
+	};
+
+	template<> struct ops<uint32_t> : vops
+	{
+		enum { N = 8 };
+
+		static inline vec load(const uint32_t *p)	{ return _mm256_loadu_si256((const __m256i*)p); }
+		static inline vec set1(uint32_t n)		{ return _mm256_set1_epi32((int)n); }
+		static inline vec eq(vec a, vec b)		{ return _mm256_cmpeq_epi32(a, b); }
+		static inline vec gt(vec a, vec b)		{ return _mm256_cmpgt_epi32(a, b); }
+		static inline vec add(vec a, vec b)		{ return _mm256_add_epi32(a, b); }
+		static inline vec sub(vec a, vec b)		{ return _mm256_sub_epi32(a, b); }
+		static inline vec srl1(vec a)			{ return _mm256_srli_epi32(a, 1); }
+		static inline vec srl2(vec a)			{ return _mm256_srli_epi32(a, 2); }
+
+		static inline void store2(uint32_t *dst, vec a, vec b)
+			{ vstore_lanes(dst, _mm256_unpacklo_epi32(a, b), _mm256_unpackhi_epi32(a, b)); }
+	};
+
+#include "sai_kernel.hpp"
+}
+GSFT_SIMD_END
+#endif /* GSFT_SIMD_AVX2 */
+
+
+/**
+ * sai_simd_available(): Check if a SIMD version can be used.
+ * @param cpuFlags CPU flags.
+ * @return Non-zero if a SIMD version can be used.
+ */
+static inline int sai_simd_available(uint32_t cpuFlags)
+{
+#if defined(GSFT_SIMD_SSE2_ALWAYS)
+	((void)cpuFlags);
+	return 1;
+#elif defined(GSFT_SIMD_SSE2)
+	return !!(cpuFlags & (MDP_CPUFLAG_X86_SSE2 | MDP_CPUFLAG_X86_AVX2));
+#else
+	((void)cpuFlags);
+	return 0;
+#endif
+}
+
+
+/**
+ * sai_render(): Render an image using the fastest available version.
+ * @param filter Filter. (SAI_FILTER)
+ * @param pixel Pixel type. (uint16_t, uint32_t)
+ * @param dst Destination image.
+ * @param dstPitch Destination pitch, in bytes.
+ * @param src Source image.
+ * @param srcPitch Source pitch, in bytes.
+ * @param width Source width.
+ * @param height Source height.
+ * @param masks Color masks.
+ * @param cpuFlags CPU flags.
+ * @return MDP error code.
+ */
+template<int filter, typename pixel>
+static int sai_render(pixel *dst, int dstPitch,
+		      const pixel *src, int srcPitch,
+		      int width, int height,
+		      const sai_masks<pixel> &masks, uint32_t cpuFlags)
+{
+	typedef void (*sai_line_fn)(const pixel *const *src, int x, int width,
+				    const sai_masks<pixel> &masks,
+				    pixel *dst0, pixel *dst1);
+	sai_line_fn sai_line = sai_scalar::sai_line<filter, pixel>;
+#if defined(GSFT_SIMD_AVX2)
+	if (cpuFlags & MDP_CPUFLAG_X86_AVX2)
+		sai_line = sai_avx2::sai_line<filter, pixel>;
+	else
+#endif
+#if defined(GSFT_SIMD_SSE2)
+#if !defined(GSFT_SIMD_SSE2_ALWAYS)
+	if (cpuFlags & MDP_CPUFLAG_X86_SSE2)
+#endif
+		sai_line = sai_sse2::sai_line<filter, pixel>;
+#endif
+	((void)cpuFlags);
+
+	dstPitch /= sizeof(pixel);
+	srcPitch /= sizeof(pixel);
+
+	// The kernels read one pixel to the left of the current pixel
+	// and two pixels to the right, from the previous line and
+	// the next two lines. Source lines are copied into buffers
+	// with black borders so the edges don't need special handling.
+	const int pad = 2;
+	const int row_size = (width + (pad * 2));
+	pixel *row_buf = (pixel*)calloc(row_size * 4, sizeof(pixel));
+	if (!row_buf)
+		return -MDP_ERR_OUT_OF_MEMORY;
+
+	// rows[0] is the previous line, which is black for the first line.
+	pixel *rows[4];
+	for (int i = 0; i < 4; i++)
+	{
+		rows[i] = &row_buf[(row_size * i) + pad];
+		if (i > 0 && (i - 1) < height)
+			memcpy(rows[i], &src[(i - 1) * srcPitch], width * sizeof(pixel));
+	}
+
+	for (int y = 0; y < height; y++)
+	{
+		sai_line(rows, 0, width, masks, dst, dst + dstPitch);
+		dst += (dstPitch * 2);
+
+		// Next line.
+		pixel *const next = rows[0];
+		rows[0] = rows[1];
+		rows[1] = rows[2];
+		rows[2] = rows[3];
+		rows[3] = next;
+		if ((y + 3) < height)
+			memcpy(next, &src[(y + 3) * srcPitch], width * sizeof(pixel));
+		else
+			memset(next, 0x00, width * sizeof(pixel));
+	}
+
+	free(row_buf);
+	return MDP_ERR_OK;
+}
+
+
+/**
+ * sai_blit(): Render an image using the fastest available version.
+ * @param filter Filter. (SAI_FILTER)
+ * @param render_info Render information.
+ * @return MDP error code.
+ */
+template<int filter>
+static inline int sai_blit(const mdp_render_info_t *render_info)
+{
+	if (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) !=
+	    MDP_RENDER_VMODE_GET_DST(render_info->vmodeFlags))
+	{
+		// Renderer only supports identical src/dst modes.
+		return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
+	}
+
+	switch (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags))
+	{
+		case MDP_RENDER_VMODE_RGB_555:
+			return sai_render<filter, uint16_t>(
+				    (uint16_t*)render_info->destScreen, render_info->destPitch,
+				    (const uint16_t*)render_info->mdScreen, render_info->srcPitch,
+				    render_info->width, render_info->height,
+				    sai_masks_15, render_info->cpuFlags);
+
+		case MDP_RENDER_VMODE_RGB_565:
+			return sai_render<filter, uint16_t>(
+				    (uint16_t*)render_info->destScreen, render_info->destPitch,
+				    (const uint16_t*)render_info->mdScreen, render_info->srcPitch,
+				    render_info->width, render_info->height,
+				    sai_masks_16, render_info->cpuFlags);
+
+		case MDP_RENDER_VMODE_RGB_888:
+			return sai_render<filter, uint32_t>(
+				    (uint32_t*)render_info->destScreen, render_info->destPitch,
+				    (const uint32_t*)render_info->mdScreen, render_info->srcPitch,
+				    render_info->width, render_info->height,
+				    sai_masks_32, render_info->cpuFlags);
+
+		default:
+			// Unsupported video mode.
+			return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
+	}
+}
+
+#endif /* MDP_RENDER_SAI_HPP */
@@ -0,0 +1,349 @@
+/***************************************************************************
+ * MDP: 2xSaI, Super 2xSaI, and Super Eagle renderers. (kernels)           *
+ *                                                                         *
+ * Copyright (c) 1999-2002 by Stéphane Dallongeville                       *
+ * Copyright (c) 2003-2004 by Stéphane Akhoun                              *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ * 2xSaI Copyright (c) by Derek Liauw Kie Fa and Robert J. Ohannessian     *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation; either version 2.1 of the License, or  *
+ * (at your option) any later version.                                     *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * This file is included once for each instruction set by sai.hpp.
+ * There are no include guards.
+ *
+ * Required definitions:
+ * - ops<pixel>: Vector operations for one pixel type. (See sai.hpp.)
+ *
+ * Each kernel is a direct translation of the corresponding MMX
+ * function, with one pixel per lane. Masks are all ones or all zeroes.
+ */
+
+/**
+ * sai_vmasks: Color masks, loaded into vectors.
+ */
+template<typename pixel>
+struct sai_vmasks
+{
+	typedef ops<pixel> op;
+	typedef typename op::vec vec;
+
+	vec colorMask, lowPixelMask;
+	vec qcolorMask, qlowPixelMask;
+	vec one;
+
+	explicit sai_vmasks(const sai_masks<pixel> &m)
+		: colorMask(op::set1(m.colorMask))
+		, lowPixelMask(op::set1(m.lowPixelMask))
+		, qcolorMask(op::set1(m.qcolorMask))
+		, qlowPixelMask(op::set1(m.qlowPixelMask))
+		, one(op::set1(1))
+	{ }
+};
+
+/**
+ * sai_interp(): Average two pixels.
+ */
+template<typename pixel>
+static inline typename ops<pixel>::vec sai_interp(
+		typename ops<pixel>::vec a, typename ops<pixel>::vec b,
+		const sai_vmasks<pixel> &vm)
+{
+	typedef ops<pixel> op;
+	return op::add(op::add(op::srl1(op::vand(a, vm.colorMask)),
+			       op::srl1(op::vand(b, vm.colorMask))),
+		       op::vand(op::vand(b, vm.lowPixelMask), a));
+}
+
+/**
+ * sai_qinterp(): Average four pixels.
+ */
+template<typename pixel>
+static inline typename ops<pixel>::vec sai_qinterp(
+		typename ops<pixel>::vec a, typename ops<pixel>::vec b,
+		typename ops<pixel>::vec c, typename ops<pixel>::vec d,
+		const sai_vmasks<pixel> &vm)
+{
+	typedef ops<pixel> op;
+	const typename op::vec hi =
+		op::add(op::add(op::srl2(op::vand(a, vm.qcolorMask)), op::srl2(op::vand(b, vm.qcolorMask))),
+			op::add(op::srl2(op::vand(c, vm.qcolorMask)), op::srl2(op::vand(d, vm.qcolorMask))));
+	const typename op::vec lo =
+		op::add(op::add(op::vand(a, vm.qlowPixelMask), op::vand(b, vm.qlowPixelMask)),
+			op::add(op::vand(c, vm.qlowPixelMask), op::vand(d, vm.qlowPixelMask)));
+	return op::add(hi, op::vand(op::srl2(lo), vm.qlowPixelMask));
+}
+
+/**
+ * sai_guess_pair(): Score one pair of neighbors for the "guess" step.
+ * @param r Score. (+1 if fewer than two neighbors match A; -1 if fewer than two match B)
+ * @param one 1 in lanes that are being guessed; 0 in other lanes.
+ */
+template<typename pixel>
+static inline void sai_guess_pair(typename ops<pixel>::vec &r,
+				  typename ops<pixel>::vec A, typename ops<pixel>::vec B,
+				  typename ops<pixel>::vec P, typename ops<pixel>::vec Q,
+				  typename ops<pixel>::vec one)
+{
+	typedef ops<pixel> op;
+	const typename op::vec x = op::add(op::vand(op::eq(P, A), one), op::vand(op::eq(Q, A), one));
+	const typename op::vec y = op::add(op::vand(op::eq(P, B), one), op::vand(op::eq(Q, B), one));
+	r = op::add(r, op::vandnot(op::gt(x, one), one));
+	r = op::sub(r, op::vandnot(op::gt(y, one), one));
+}
+
+/**
+ * sai_guess(): Decide between A and B using the surrounding pixels.
+ * @param mask Lanes to guess.
+ * @param maskA [in/out] Mask of lanes that use A.
+ * @param maskB [in/out] Mask of lanes that use B.
+ * @param raw_maskB If true, OR the score into maskB instead of (score < 0).
+ * The MMX versions of 2xSaI and Super Eagle do this, which sets
+ * low bits of B in the output when A is chosen.
+ */
+template<typename pixel>
+static inline void sai_guess(typename ops<pixel>::vec mask,
+			     typename ops<pixel>::vec A, typename ops<pixel>::vec B,
+			     typename ops<pixel>::vec P0, typename ops<pixel>::vec Q0,
+			     typename ops<pixel>::vec P1, typename ops<pixel>::vec Q1,
+			     typename ops<pixel>::vec P2, typename ops<pixel>::vec Q2,
+			     typename ops<pixel>::vec P3, typename ops<pixel>::vec Q3,
+			     typename ops<pixel>::vec &maskA, typename ops<pixel>::vec &maskB,
+			     bool raw_maskB, const sai_vmasks<pixel> &vm)
+{
+	typedef ops<pixel> op;
+	if (!op::any(mask))
+		return;
+
+	const typename op::vec one = op::vand(mask, vm.one);
+	typename op::vec r = op::zero();
+	sai_guess_pair<pixel>(r, A, B, P0, Q0, one);
+	sai_guess_pair<pixel>(r, A, B, P1, Q1, one);
+	sai_guess_pair<pixel>(r, A, B, P2, Q2, one);
+	sai_guess_pair<pixel>(r, A, B, P3, Q3, one);
+
+	maskA = op::vor(maskA, op::gt(r, op::zero()));
+	maskB = op::vor(maskB, (raw_maskB ? r : op::gt(op::zero(), r)));
+}
+
+/**
+ * sai_pick(): Select from two pixels and a fallback.
+ * Same as (a & maskA) | (b & maskB) | (c if (maskA | maskB) == 0).
+ * maskB may have partial lanes; see sai_guess().
+ */
+template<typename pixel>
+static inline typename ops<pixel>::vec sai_pick(
+		typename ops<pixel>::vec maskA, typename ops<pixel>::vec a,
+		typename ops<pixel>::vec maskB, typename ops<pixel>::vec b,
+		typename ops<pixel>::vec c)
+{
+	typedef ops<pixel> op;
+	return op::vor(op::vor(op::vand(maskA, a), op::vand(maskB, b)),
+		       op::vand(op::eq(op::vor(maskA, maskB), op::zero()), c));
+}
+
+/**
+ * sai_block(): Render one vector of source pixels.
+ * @param filter Filter. (SAI_FILTER)
+ * @param src Source rows. (y-1, y, y+1, y+2; pointing at the first pixel)
+ * @param dst0 First destination row.
+ * @param dst1 Second destination row.
+ */
+template<int filter, typename pixel>
+static inline void sai_block(const pixel *const *src, const sai_vmasks<pixel> &vm,
+			     pixel *dst0, pixel *dst1)
+{
+	typedef ops<pixel> op;
+	typedef typename op::vec vec;
+
+	if (filter == SAI_2XSAI)
+	{
+		/**
+		 * I|E F|J
+		 * G|A B|K
+		 * H|C D|L
+		 * M|N O|P
+		 */
+		const vec I = op::load(src[0] - 1), E = op::load(src[0]), F = op::load(src[0] + 1), J = op::load(src[0] + 2);
+		const vec G = op::load(src[1] - 1), A = op::load(src[1]), B = op::load(src[1] + 1), K = op::load(src[1] + 2);
+		const vec H = op::load(src[2] - 1), C = op::load(src[2]), D = op::load(src[2] + 1), L = op::load(src[2] + 2);
+		const vec M = op::load(src[3] - 1), N = op::load(src[3]), O = op::load(src[3] + 1);
+
+		const vec AeqD = op::eq(A, D), BeqC = op::eq(B, C);
+
+		// Top right pixel.
+		vec mask1 = op::vor(op::vandnot(BeqC, op::vand(op::vand(AeqD, op::eq(A, E)), op::eq(B, L))),
+				    op::vandnot(op::eq(B, E), op::vand(op::vand(op::eq(A, C), op::eq(A, F)), op::eq(B, J))));
+		vec mask2 = op::vor(op::vandnot(AeqD, op::vand(op::vand(BeqC, op::eq(B, F)), op::eq(A, H))),
+				    op::vandnot(op::eq(A, F), op::vand(op::vand(op::eq(B, D), op::eq(B, E)), op::eq(A, I))));
+		const vec top1 = sai_pick<pixel>(mask1, A, mask2, B, sai_interp<pixel>(A, B, vm));
+
+		// Bottom left pixel.
+		mask1 = op::vor(op::vandnot(op::eq(C, B), op::vand(op::vand(AeqD, op::eq(A, G)), op::eq(C, O))),
+				op::vandnot(op::eq(C, G), op::vand(op::vand(op::eq(A, H), op::eq(A, B)), op::eq(C, M))));
+		mask2 = op::vor(op::vandnot(AeqD, op::vand(op::vand(op::eq(C, B), op::eq(C, H)), op::eq(A, F))),
+				op::vandnot(op::eq(A, H), op::vand(op::vand(op::eq(C, D), op::eq(C, G)), op::eq(A, I))));
+		const vec bottom0 = sai_pick<pixel>(mask1, A, mask2, C, sai_interp<pixel>(A, C, vm));
+
+		// Bottom right pixel.
+		const vec both = op::vand(AeqD, BeqC);
+		const vec all = op::vand(both, op::eq(A, B));
+		mask1 = op::vor(op::vandnot(BeqC, AeqD), all);
+		mask2 = op::vandnot(AeqD, BeqC);
+		sai_guess<pixel>(op::vxor(both, all), A, B, E, G, F, K, H, N, L, O, mask1, mask2, true, vm);
+		const vec bottom1 = sai_pick<pixel>(mask1, A, mask2, B, sai_qinterp<pixel>(A, B, C, D, vm));
+
+		op::store2(dst0, A, top1);
+		op::store2(dst1, bottom0, bottom1);
+	}
+	else
+	{
+		/**
+		 * B0 B1 B2 B3
+		 *  4  5  6 S2
+		 *  1  2  3 S1
+		 * A0 A1 A2 A3
+		 */
+		const vec cB0 = op::load(src[0] - 1), cB1 = op::load(src[0]), cB2 = op::load(src[0] + 1), cB3 = op::load(src[0] + 2);
+		const vec c4 = op::load(src[1] - 1), c5 = op::load(src[1]), c6 = op::load(src[1] + 1), cS2 = op::load(src[1] + 2);
+		const vec c1 = op::load(src[2] - 1), c2 = op::load(src[2]), c3 = op::load(src[2] + 1), cS1 = op::load(src[2] + 2);
+		const vec cA0 = op::load(src[3] - 1), cA1 = op::load(src[3]), cA2 = op::load(src[3] + 1), cA3 = op::load(src[3] + 2);
+
+		const vec I56 = sai_interp<pixel>(c5, c6, vm);
+		const vec I5556 = sai_interp<pixel>(I56, c5, vm);
+		const vec I5666 = sai_interp<pixel>(I56, c6, vm);
+		const vec I23 = sai_interp<pixel>(c2, c3, vm);
+		const vec I2223 = sai_interp<pixel>(I23, c2, vm);
+		const vec I2333 = sai_interp<pixel>(I23, c3, vm);
+
+		if (filter == SAI_SUPER_2XSAI)
+		{
+			// NOTE: The MMX version compares color5 and color2
+			// with I23Pixel instead of color6 here.
+			const vec eq53 = op::eq(c5, c3), eqI2 = op::eq(I23, c2);
+			const vec both = op::vand(eq53, eqI2);
+			const vec all = op::vand(both, op::eq(c5, I23));
+			vec mask26 = op::vandnot(eq53, eqI2);
+			vec mask35 = op::vor(op::vandnot(eqI2, eq53), all);
+			sai_guess<pixel>(op::vxor(both, all), c5, c6, cB1, c4, cB2, cS2, c1, cA1, cS1, cA2,
+					 mask35, mask26, false, vm);
+
+			const vec I52 = sai_interp<pixel>(c5, c2, vm);
+
+			// final1a
+			vec cond = op::vor(op::vandnot(op::eq(cB2, c2), op::vand(mask26, op::eq(c1, c2))),
+					   op::vandnot(op::vor(op::eq(c5, c1), op::eq(cB0, c2)),
+						       op::vand(op::eq(c3, c2), op::eq(c4, c2))));
+			const vec final1a = op::vor(op::vand(cond, I52), op::vandnot(cond, c5));
+
+			// final2a
+			cond = op::vor(op::vandnot(op::eq(cA2, c5), op::vand(mask35, op::eq(c4, c5))),
+				       op::vandnot(op::vor(op::eq(c2, c4), op::eq(cA0, c5)),
+						   op::vand(op::eq(c6, c5), op::eq(c1, c5))));
+			const vec final2a = op::vor(op::vand(cond, I52), op::vandnot(cond, c2));
+
+			// final2b
+			// NOTE: The MMX version compares the (colorA1 == color3) mask
+			// with color3, and uses color5 instead of color2 here.
+			const vec eqA1_3 = op::eq(cA1, c3);
+			const vec q3 = op::vandnot(op::vor(op::eq(cA0, c3), op::eq(c2, cA2)),
+						   op::vand(op::eq(c6, c3), eqA1_3));
+			const vec q2 = op::vandnot(op::vor(op::eq(eqA1_3, c3), op::eq(cA3, c5)),
+						   op::vand(op::eq(cA2, c5), op::eq(c2, c5)));
+			vec none = op::vor(op::vor(q3, q2), op::vor(mask35, mask26));
+			const vec final2b = op::vor(op::vor(op::vor(op::vand(q3, I2333), op::vand(q2, I2223)),
+							    op::vor(op::vand(mask26, c2), op::vand(mask35, c3))),
+						    op::vandnot(none, I23));
+
+			// final1b
+			const vec eqB1_6 = op::eq(cB1, c6);
+			const vec q6 = op::vandnot(op::vor(op::eq(cB0, c6), op::eq(c5, cB2)),
+						   op::vand(op::eq(c3, c6), eqB1_6));
+			const vec q5 = op::vandnot(op::vor(op::eq(eqB1_6, c6), op::eq(cB3, c5)),
+						   op::vand(op::eq(cB2, c5), op::eq(c2, c5)));
+			none = op::vor(op::vor(q6, q5), op::vor(mask35, mask26));
+			const vec final1b = op::vor(op::vor(op::vor(op::vand(q6, I5666), op::vand(q5, I5556)),
+							    op::vor(op::vand(mask26, c6), op::vand(mask35, c5))),
+						    op::vandnot(none, I56));
+
+			op::store2(dst0, final1a, final1b);
+			op::store2(dst1, final2a, final2b);
+		}
+		else /* if (filter == SAI_SUPER_EAGLE) */
+		{
+			const vec eq53 = op::eq(c5, c3), eq62 = op::eq(c6, c2);
+			vec mask35 = op::vandnot(eq62, eq53);
+			vec mask26 = op::vandnot(eq53, eq62);
+			const vec mask35b = op::vand(mask35,
+				op::vor(op::vand(op::eq(cS1, c5), op::eq(c4, c5)), op::vand(op::eq(cA2, c5), op::eq(cB1, c5))));
+			const vec mask26b = op::vand(mask26,
+				op::vor(op::vand(op::eq(c1, c6), op::eq(cS2, c6)), op::vand(op::eq(cA1, c6), op::eq(cB2, c6))));
+
+			const vec both = op::vand(eq53, eq62);
+			sai_guess<pixel>(op::vandnot(op::eq(c5, c6), both), c5, c6, cB1, c4, cB2, cS2, c1, cA1, cS1, cA2,
+					 mask35, mask26, true, vm);
+
+			// Pixels that are copied directly.
+			const vec copy = op::vandnot(op::vor(mask35, mask26), op::vor(op::eq(c5, c2), op::eq(c6, c3)));
+			// Pixels that aren't matched by any rule.
+			const vec none = op::eq(op::vor(op::vor(copy, mask35), mask26), op::zero());
+			const vec p35 = op::vxor(mask35, mask35b);
+			const vec p26 = op::vxor(mask26, mask26b);
+			const vec copy35 = op::vor(op::vor(copy, p35), mask35b);
+			const vec copy26 = op::vor(op::vor(copy, p26), mask26b);
+
+			const vec final1a = op::vor(op::vor(op::vand(c5, copy35), op::vand(p26, I56)),
+						    op::vor(op::vand(mask26b, I5666), op::vand(none, I5556)));
+			const vec final1b = op::vor(op::vor(op::vand(c6, copy26), op::vand(p35, I56)),
+						    op::vor(op::vand(mask35b, I5556), op::vand(none, I5666)));
+			const vec final2a = op::vor(op::vor(op::vand(c2, copy26), op::vand(p35, I23)),
+						    op::vor(op::vand(mask35b, I2333), op::vand(none, I2223)));
+			const vec final2b = op::vor(op::vor(op::vand(c3, copy35), op::vand(p26, I23)),
+						    op::vor(op::vand(mask26b, I2223), op::vand(none, I2333)));
+
+			op::store2(dst0, final1a, final1b);
+			op::store2(dst1, final2a, final2b);
+		}
+	}
+}
+
+/**
+ * sai_line(): Render part of a line.
+ * Pixels that don't fill a whole vector are rendered by the scalar version.
+ * @param filter Filter. (SAI_FILTER)
+ * @param src Source rows. (y-1, y, y+1, y+2)
+ * @param x First source pixel.
+ * @param width Width of the source rows.
+ * @param dst0 First destination row.
+ * @param dst1 Second destination row.
+ */
+template<int filter, typename pixel>
+static void sai_line(const pixel *const *src, int x, int width,
+		     const sai_masks<pixel> &masks,
+		     pixel *dst0, pixel *dst1)
+{
+	typedef ops<pixel> op;
+	const sai_vmasks<pixel> vm(masks);
+
+	for (; x + (int)op::N <= width; x += op::N)
+	{
+		const pixel *const rows[4] = {src[0] + x, src[1] + x, src[2] + x, src[3] + x};
+		sai_block<filter, pixel>(rows, vm, &dst0[x * 2], &dst1[x * 2]);
+	}
+
+	if (x < width)
+		sai_scalar::sai_line<filter, pixel>(src, x, width, masks, dst0, dst1);
+}
@@ -33,6 +33,13 @@ md_ntsc_setup_t const md_ntsc_rgb        = {{{0, 0, 0, 0,.2,  0,.7, -1, -1,-1}},
 
 #include "md_ntsc_impl.h"
 
+// SIMD blitters.
+#include "md_ntsc_simd.hpp"
+
+// MDP includes.
+#include "mdp/mdp_cpuflags.h"
+#include "mdp/mdp_error.h"
+
 #include <string.h>
 #include <stdlib.h>
 
@@ -89,6 +96,18 @@ void md_ntsc_init(md_ntsc_t* ntsc, md_ntsc_setup_t const* setup)
 		{
 			gen_kernel(&impl, y, i, q, ntsc->table [entry]);
 			correct_errors(rgb, ntsc->table [entry]);
+			
+			/* Rearrange the kernel for the SIMD blitters. */
+			/* Same indexes as MD_NTSC_RGB_OUT(). */
+			for (int n = 0; n < md_ntsc_in_chunk; n++)
+			{
+				const md_ntsc_rgb_t* kernel = &ntsc->table [entry] [(n & 1) * 16];
+				for (int x = 0; x < md_ntsc_out_chunk; x++)
+				{
+					ntsc->simd_table [entry] [n] [x    ] = (uint32_t)kernel [(x + 8 - n*2) % 8    ];
+					ntsc->simd_table [entry] [n] [x + 8] = (uint32_t)kernel [(x + 8 - n*2) % 8 + 8];
+				}
+			}
 		}
 	}
 }
@@ -118,11 +137,10 @@ static inline void T_interpolate_line(const pixel *prev_line_in, const pixel *ne
 	// Previous real line: 0
 	// Next real line: 2
 	
-	memset(out_line, 0xFF, line_width);
 	for (unsigned int x = line_width; x != 0; x--)
 	{
 		const pixel prev = *prev_line_in++;
-		const pixel next = (next_line_in ? *next_line_in++ : 0);
+		const pixel next = *next_line_in++;
 		
 		// Mix RGB without losing low bits.
 		const uint32_t mixed = (prev + next) + ((prev ^ next) & lowPixelMask);
@@ -145,160 +163,162 @@ static inline void T_interpolate_line(const pixel *prev_line_in, const pixel *ne
 }
 
 
-// Double-scan line buffers.
-// NOTE: Statically allocating these makes the NTSC renderer non-reentrant!
-static unsigned int prev_dbl_buf_size = 0;
-static void *dbl_buf[2] = {NULL, NULL};
-
 /**
- * T_md_ntsc_blit(): Templated NTSC blit function.
+ * T_md_ntsc_row(): Templated NTSC row function.
+ * @param ntsc NTSC filter.
+ * @param line_in Input row. (RGB565)
+ * @param in_width Width of the input row.
+ * @param line_out Output row. (in_width * 2)
  */
 template<typename pixel, pixel maskR, pixel maskG, pixel maskB, int shiftR, int shiftG, int shiftB>
-static inline void T_md_ntsc_blit(md_ntsc_t const* ntsc, uint16_t const* input,
-				  int in_row_width, int in_width, int height,
-				  pixel *rgb_out, int out_pitch,
-				  unsigned int effects, pixel lowPixelMask, pixel darkenMask)
+static void T_md_ntsc_row(md_ntsc_t const* ntsc, uint16_t const* line_in,
+			  int in_width, pixel *line_out)
 {
 	const int chunk_count = in_width / md_ntsc_in_chunk - 1;
 	
-	/* Calculate the output pitch difference for one scanline. */
-	const int outPitchDiff = (out_pitch / sizeof(pixel));
-	
-	/* Double-scan line buffers. */
-	const unsigned int dbl_buf_size = (in_width * sizeof(pixel) * 2);
-	int dbl_buf_write = 0;	// Current double-scan line buffer to write to.
-	
-	if (prev_dbl_buf_size != dbl_buf_size)
-	{
-		// Reallocate the double-scan line buffers.
-		free(dbl_buf[0]);
-		free(dbl_buf[1]);
-		dbl_buf[0] = malloc(dbl_buf_size);
-		dbl_buf[1] = malloc(dbl_buf_size);
-	}
+	MD_NTSC_BEGIN_ROW(ntsc, md_ntsc_black,
+			  line_in[0], line_in[1], line_in[2]);
+	line_in += 3;
 	
-	unsigned int line = 0;
-	while (height--)
+	for (int n = chunk_count; n; --n)
 	{
-		// Switch the double-scan line buffers.
-		dbl_buf_write = !dbl_buf_write;
-		
-		uint16_t const* line_in = input;
-		MD_NTSC_BEGIN_ROW(ntsc, md_ntsc_black,
-				  line_in[0], line_in[1], line_in[2]);
-		pixel *restrict line_out = (pixel*)dbl_buf[dbl_buf_write];
-		int n;
-		line_in += 3;
-		
-		for (n = chunk_count; n; --n)
-		{
-			/* order of input and output pixels must not be altered */
-			MD_NTSC_COLOR_IN(0, ntsc, line_in[0]);
-			MD_NTSC_RGB_OUT(0, line_out[0]);
-			MD_NTSC_RGB_OUT(1, line_out[1]);
-			
-			MD_NTSC_COLOR_IN(1, ntsc, line_in[1]);
-			MD_NTSC_RGB_OUT(2, line_out[2]);
-			MD_NTSC_RGB_OUT(3, line_out[3]);
-			
-			MD_NTSC_COLOR_IN(2, ntsc, line_in[2]);
-			MD_NTSC_RGB_OUT(4, line_out[4]);
-			MD_NTSC_RGB_OUT(5, line_out[5]);
-			
-			MD_NTSC_COLOR_IN(3, ntsc, line_in[3]);
-			MD_NTSC_RGB_OUT(6, line_out[6]);
-			MD_NTSC_RGB_OUT(7, line_out[7]);
-			
-			line_in  += 4;
-			line_out += 8;
-		}
-		
-		/* finish final pixels */
+		/* order of input and output pixels must not be altered */
 		MD_NTSC_COLOR_IN(0, ntsc, line_in[0]);
 		MD_NTSC_RGB_OUT(0, line_out[0]);
 		MD_NTSC_RGB_OUT(1, line_out[1]);
 		
-		MD_NTSC_COLOR_IN(1, ntsc, md_ntsc_black);
+		MD_NTSC_COLOR_IN(1, ntsc, line_in[1]);
 		MD_NTSC_RGB_OUT(2, line_out[2]);
 		MD_NTSC_RGB_OUT(3, line_out[3]);
 		
-		MD_NTSC_COLOR_IN(2, ntsc, md_ntsc_black);
+		MD_NTSC_COLOR_IN(2, ntsc, line_in[2]);
 		MD_NTSC_RGB_OUT(4, line_out[4]);
 		MD_NTSC_RGB_OUT(5, line_out[5]);
 		
-		MD_NTSC_COLOR_IN(3, ntsc, md_ntsc_black);
+		MD_NTSC_COLOR_IN(3, ntsc, line_in[3]);
 		MD_NTSC_RGB_OUT(6, line_out[6]);
 		MD_NTSC_RGB_OUT(7, line_out[7]);
 		
+		line_in  += 4;
+		line_out += 8;
+	}
+	
+	/* finish final pixels */
+	MD_NTSC_COLOR_IN(0, ntsc, line_in[0]);
+	MD_NTSC_RGB_OUT(0, line_out[0]);
+	MD_NTSC_RGB_OUT(1, line_out[1]);
+	
+	MD_NTSC_COLOR_IN(1, ntsc, md_ntsc_black);
+	MD_NTSC_RGB_OUT(2, line_out[2]);
+	MD_NTSC_RGB_OUT(3, line_out[3]);
+	
+	MD_NTSC_COLOR_IN(2, ntsc, md_ntsc_black);
+	MD_NTSC_RGB_OUT(4, line_out[4]);
+	MD_NTSC_RGB_OUT(5, line_out[5]);
+	
+	MD_NTSC_COLOR_IN(3, ntsc, md_ntsc_black);
+	MD_NTSC_RGB_OUT(6, line_out[6]);
+	MD_NTSC_RGB_OUT(7, line_out[7]);
+}
+
+
+/**
+ * T_md_ntsc_blit(): Templated NTSC blit function.
+ * This function is band-safe: it doesn't use any static buffers,
+ * and with interpolation enabled, the last output line is interpolated
+ * with the source line below the image.
+ * @return MDP error code.
+ */
+template<typename pixel, pixel maskR, pixel maskG, pixel maskB, int shiftR, int shiftG, int shiftB>
+static inline int T_md_ntsc_blit(md_ntsc_t const* ntsc, uint16_t const* input,
+				 int in_row_width, int in_width, int height,
+				 pixel *rgb_out, int out_pitch,
+				 unsigned int effects, pixel lowPixelMask, pixel darkenMask,
+				 uint32_t cpuFlags)
+{
+	// Row function.
+	typedef void (*md_ntsc_row_fn)(md_ntsc_t const* ntsc, uint16_t const* line_in,
+				       int in_width, pixel *line_out);
+	md_ntsc_row_fn md_ntsc_row = T_md_ntsc_row<pixel, maskR, maskG, maskB, shiftR, shiftG, shiftB>;
+#if defined(GSFT_SIMD_AVX2)
+	if (cpuFlags & MDP_CPUFLAG_X86_AVX2)
+		md_ntsc_row = md_ntsc_avx2::T_md_ntsc_row_simd<pixel, maskR, maskG, maskB, shiftR, shiftG, shiftB>;
+	else
+#endif
+#if defined(GSFT_SIMD_SSE2)
+#if !defined(GSFT_SIMD_SSE2_ALWAYS)
+	if (cpuFlags & MDP_CPUFLAG_X86_SSE2)
+#endif
+		md_ntsc_row = md_ntsc_sse2::T_md_ntsc_row_simd<pixel, maskR, maskG, maskB, shiftR, shiftG, shiftB>;
+#endif
+	((void)cpuFlags);
+	
+	/* Calculate the output pitch difference for one scanline. */
+	const int outPitchDiff = (out_pitch / sizeof(pixel));
+	
+	/* Double-scan line buffers. */
+	/* These are allocated on each call so bands can be rendered in parallel. */
+	const int out_width = (in_width * 2);
+	const size_t dbl_buf_size = (out_width * sizeof(pixel));
+	pixel *dbl_buf[2];
+	dbl_buf[0] = (pixel*)malloc(dbl_buf_size * 2);
+	if (!dbl_buf[0])
+		return -MDP_ERR_OUT_OF_MEMORY;
+	dbl_buf[1] = dbl_buf[0] + out_width;
+	int dbl_buf_cur = 0;	// Double-scan line buffer containing the current line.
+	bool dbl_buf_valid = false;
+	
+	while (height--)
+	{
+		if (!dbl_buf_valid)
+			md_ntsc_row(ntsc, input, in_width, dbl_buf[dbl_buf_cur]);
+		dbl_buf_valid = false;
+		
 		/* Write the pixels to the display. */
-		memcpy(rgb_out, dbl_buf[dbl_buf_write], dbl_buf_size);
+		memcpy(rgb_out, dbl_buf[dbl_buf_cur], dbl_buf_size);
 		rgb_out += outPitchDiff;
 		
 		if (!(effects & (MDP_MD_NTSC_EFFECT_SCANLINE | MDP_MD_NTSC_EFFECT_INTERP)))
 		{
 			// Scanlines and interpolation are disabled.
 			// Do a simple double-scan.
-			memcpy(rgb_out, dbl_buf[dbl_buf_write], dbl_buf_size);
-			rgb_out += outPitchDiff;
+			memcpy(rgb_out, dbl_buf[dbl_buf_cur], dbl_buf_size);
+		}
+		else if (effects & MDP_MD_NTSC_EFFECT_INTERP)
+		{
+			// Interpolation is enabled.
+			// Interpolate the current line and the next line.
+			// The next line is kept for the next iteration.
+			md_ntsc_row(ntsc, input + in_row_width, in_width, dbl_buf[!dbl_buf_cur]);
+			T_interpolate_line<pixel>(dbl_buf[dbl_buf_cur], dbl_buf[!dbl_buf_cur],
+						  rgb_out, out_width, effects,
+						  lowPixelMask, darkenMask);
+			dbl_buf_cur = !dbl_buf_cur;
+			dbl_buf_valid = true;
 		}
 		else
 		{
-			if (effects & MDP_MD_NTSC_EFFECT_INTERP)
-			{
-				// Interpolation is enabled.
-				if (line != 0)
-				{
-					// Past line 0. Interpolate the current line and the previous line.
-					
-					// Current doubled line: 3
-					// Output line: 1
-					// Previous real line: 0
-					// Next real line: 2
-					
-					T_interpolate_line<pixel>(
-							(pixel*)dbl_buf[!dbl_buf_write],
-							(pixel*)dbl_buf[dbl_buf_write],
-							(rgb_out - (outPitchDiff * 2)),
-							(in_width * 2), effects,
-							lowPixelMask, darkenMask);
-				}
-				rgb_out += outPitchDiff;
-			}
-			else
+			// Interpolation is disabled. Add a scanline effect.
+			const pixel *in = dbl_buf[dbl_buf_cur];
+			pixel *out = rgb_out;
+			
+			// Write the scanline.
+			for (unsigned int x = out_width; x != 0; x--)
 			{
-				// Interpolation is disabled. Add a scanline effect.
-				const pixel *in = (pixel*)dbl_buf[dbl_buf_write];
-				pixel *out = rgb_out;
+				const pixel prev = *in++;
 				
-				// Write the scanline.
-				for (unsigned int x = (in_width * 2); x != 0; x--)
-				{
-					const pixel prev = *in++;
-					
-					// Darken by 12%.
-					*out++ = prev - (prev >> 3 & darkenMask);
-				}
-				
-				// Next line.
-				rgb_out += outPitchDiff;
+				// Darken by 12%.
+				*out++ = prev - (prev >> 3 & darkenMask);
 			}
 		}
 		
 		// Next row.
+		rgb_out += outPitchDiff;
 		input += in_row_width;
-		line++;
 	}
 	
-	if (effects & MDP_MD_NTSC_EFFECT_INTERP)
-	{
-		// Make sure the last line is drawn correctly.
-		T_interpolate_line<pixel>(
-				(pixel*)dbl_buf[!dbl_buf_write],
-				NULL,
-				(rgb_out - outPitchDiff),
-				(in_width * 2), effects,
-				lowPixelMask, darkenMask);
-	}
+	free(dbl_buf[0]);
+	return MDP_ERR_OK;
 }
 
 
@@ -308,7 +328,6 @@ static inline void T_md_ntsc_blit(md_ntsc_t const* ntsc, uint16_t const* input,
 
 /* MDP includes. */
 #include "mdp/mdp_stdint.h"
-#include "mdp/mdp_error.h"
 static md_ntsc_t *mdp_md_ntsc = NULL;
 
 // NTSC setup struct.
@@ -377,38 +396,41 @@ int MDP_FNCALL mdp_md_ntsc_blit(const mdp_render_info_t *render_info)
 	{
 		case MDP_RENDER_VMODE_RGB_565:
 			// 16-bit color.
-			T_md_ntsc_blit<uint16_t, 0xF800, 0x07E0, 0x001F, 13, 8, 4>
+			return T_md_ntsc_blit<uint16_t, 0xF800, 0x07E0, 0x001F, 13, 8, 4>
 					(mdp_md_ntsc,
 					 (uint16_t*)render_info->mdScreen,
 					 render_info->srcPitch / 2,
 					 render_info->width, render_info->height,
 					 (uint16_t*)render_info->destScreen,
 					 render_info->destPitch,
-					 mdp_md_ntsc_effects, 0x0821, 0x18E3);
+					 mdp_md_ntsc_effects, 0x0821, 0x18E3,
+					 render_info->cpuFlags);
 			break;
 		
 		case MDP_RENDER_VMODE_RGB_555:
 			// 15-bit color.
-			T_md_ntsc_blit<uint16_t, 0x7C00, 0x03E0, 0x001F, 14, 9, 4>
+			return T_md_ntsc_blit<uint16_t, 0x7C00, 0x03E0, 0x001F, 14, 9, 4>
 					(mdp_md_ntsc,
 					 (uint16_t*)render_info->mdScreen,
 					 render_info->srcPitch / 2,
 					 render_info->width, render_info->height,
 					 (uint16_t*)render_info->destScreen,
 					 render_info->destPitch,
-					 mdp_md_ntsc_effects, 0x0421, 0x0C63);
+					 mdp_md_ntsc_effects, 0x0421, 0x0C63,
+					 render_info->cpuFlags);
 			break;
 		
 		case MDP_RENDER_VMODE_RGB_888:
 			// 32-bit color.
-			T_md_ntsc_blit<uint32_t, (uint32_t)0xFF0000, (uint32_t)0x00FF00, (uint32_t)0x0000FF, 5, 3, 1>
+			return T_md_ntsc_blit<uint32_t, (uint32_t)0xFF0000, (uint32_t)0x00FF00, (uint32_t)0x0000FF, 5, 3, 1>
 					(mdp_md_ntsc,
 					 (uint16_t*)render_info->mdScreen,
 					 render_info->srcPitch / 2,
 					 render_info->width, render_info->height,
 					 (uint32_t*)render_info->destScreen,
 					 render_info->destPitch,
-					 mdp_md_ntsc_effects, (uint32_t)0x010101, (uint32_t)0x0F0F0F);
+					 mdp_md_ntsc_effects, (uint32_t)0x010101, (uint32_t)0x0F0F0F,
+					 render_info->cpuFlags);
 			break;
 		
 		default:
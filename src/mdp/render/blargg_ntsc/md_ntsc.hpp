@@ -7,6 +7,7 @@
 #include "md_ntsc_config.h"
 
 // MDP includes.
+#include "mdp/mdp_stdint.h"
 #include "mdp/mdp_fncall.h"
 #include "mdp/mdp_render.h"
 
@@ -112,6 +113,12 @@ enum { md_ntsc_entry_size = 2 * 16 };
 typedef unsigned long md_ntsc_rgb_t;
 struct md_ntsc_t {
 	md_ntsc_rgb_t table [md_ntsc_palette_size] [md_ntsc_entry_size];
+	
+	/* Kernels for the SIMD blitters, truncated to 32 bits.
+	   [entry] [input pixel position in chunk] [output pixel]
+	   Output pixels 0-7 are from the current chunk (kernelN in MD_NTSC_RGB_OUT);
+	   8-15 are from the previous chunk (kernelxN). Both are pre-rotated. */
+	uint32_t simd_table [md_ntsc_palette_size] [md_ntsc_in_chunk] [md_ntsc_out_chunk * 2];
 };
 
 #define MD_NTSC_BGR9( ntsc, n ) (ntsc)->table [n & 0x1FF]
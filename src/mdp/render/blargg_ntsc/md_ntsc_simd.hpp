@@ -0,0 +1,140 @@
+/***************************************************************************
+ * MDP: Blargg's NTSC Filter. (SIMD blitters)                              *
+ *                                                                         *
+ * Copyright (c) 2006 by Shay Green                                        *
+ * SIMD version Copyright (c) 2008-2010 by David Korth                     *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation; either version 2.1 of the License, or  *
+ * (at your option) any later version.                                     *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef MD_NTSC_SIMD_HPP
+#define MD_NTSC_SIMD_HPP
+
+#include "md_ntsc.hpp"
+
+// SIMD intrinsics.
+#include "libgsft/gsft_simd.h"
+
+/**
+ * md_ntsc_simd_index(): Get the palette entry for an RGB565 input pixel.
+ * Same as MD_NTSC_RGB16(), but returns an index instead of a pointer.
+ * @param n RGB565 pixel.
+ * @return Palette entry. (0x00BBBGGGRRR)
+ */
+static inline unsigned int md_ntsc_simd_index(unsigned int n)
+{
+	return ((n >> 13 & 0x007) | (n >> 5 & 0x038) | (n << 4 & 0x1C0));
+}
+
+#if defined(GSFT_SIMD_SSE2)
+GSFT_SIMD_BEGIN_SSE2
+namespace md_ntsc_sse2
+{
+	typedef __m128i vec;
+	enum { LANES = 4 };
+
+	static inline vec vload(const uint32_t *p)	{ return _mm_loadu_si128((const __m128i*)p); }
+	static inline vec vset1(uint32_t n)		{ return _mm_set1_epi32((int)n); }
+	static inline vec vadd(vec a, vec b)		{ return _mm_add_epi32(a, b); }
+	static inline vec vsub(vec a, vec b)		{ return _mm_sub_epi32(a, b); }
+	static inline vec vand(vec a, vec b)		{ return _mm_and_si128(a, b); }
+	static inline vec vor(vec a, vec b)		{ return _mm_or_si128(a, b); }
+	static inline vec vsel(vec mask, vec a, vec b)
+		{ return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b)); }
+	static inline vec vsrl(vec a, int n)		{ return _mm_srli_epi32(a, n); }
+
+	/**
+	 * vmask_ge(): Create a mask of lanes whose output pixel is >= first.
+	 * @param base Output pixel in lane 0.
+	 * @param first First output pixel to select.
+	 */
+	static inline vec vmask_ge(int base, int first)
+	{
+		return _mm_cmpgt_epi32(_mm_add_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(base)),
+				       _mm_set1_epi32(first - 1));
+	}
+
+	/**
+	 * vstore_out(): Store a chunk of output pixels.
+	 * @param dst Destination.
+	 * @param v Output pixels. (8 / LANES vectors)
+	 */
+	static inline void vstore_out(uint16_t *dst, const vec *v)
+	{
+		// Sign-extend the pixels so packs_epi32 doesn't saturate them.
+		const vec lo = _mm_srai_epi32(_mm_slli_epi32(v[0], 16), 16);
+		const vec hi = _mm_srai_epi32(_mm_slli_epi32(v[1], 16), 16);
+		_mm_storeu_si128((__m128i*)dst, _mm_packs_epi32(lo, hi));
+	}
+	static inline void vstore_out(uint32_t *dst, const vec *v)
+	{
+		_mm_storeu_si128((__m128i*)dst, v[0]);
+		_mm_storeu_si128((__m128i*)(dst + 4), v[1]);
+	}
+
+#include "md_ntsc_simd_kernel.hpp"
+}
+GSFT_SIMD_END
+#endif /* GSFT_SIMD_SSE2 */
+
+#if defined(GSFT_SIMD_AVX2)
+GSFT_SIMD_BEGIN_AVX2
+namespace md_ntsc_avx2
+{
+	typedef __m256i vec;
+	enum { LANES = 8 };
+
+	static inline vec vload(const uint32_t *p)	{ return _mm256_loadu_si256((const __m256i*)p); }
+	static inline vec vset1(uint32_t n)		{ return _mm256_set1_epi32((int)n); }
+	static inline vec vadd(vec a, vec b)		{ return _mm256_add_epi32(a, b); }
+	static inline vec vsub(vec a, vec b)		{ return _mm256_sub_epi32(a, b); }
+	static inline vec vand(vec a, vec b)		{ return _mm256_and_si256(a, b); }
+	static inline vec vor(vec a, vec b)		{ return _mm256_or_si256(a, b); }
+	static inline vec vsel(vec mask, vec a, vec b)	{ return _mm256_blendv_epi8(b, a, mask); }
+	static inline vec vsrl(vec a, int n)		{ return _mm256_srli_epi32(a, n); }
+
+	/**
+	 * vmask_ge(): Create a mask of lanes whose output pixel is >= first.
+	 * @param base Output pixel in lane 0.
+	 * @param first First output pixel to select.
+	 */
+	static inline vec vmask_ge(int base, int first)
+	{
+		return _mm256_cmpgt_epi32(_mm256_add_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(base)),
+					  _mm256_set1_epi32(first - 1));
+	}
+
+	/**
+	 * vstore_out(): Store a chunk of output pixels.
+	 * @param dst Destination.
+	 * @param v Output pixels. (8 / LANES vectors)
+	 */
+	static inline void vstore_out(uint16_t *dst, const vec *v)
+	{
+		// packus_epi32 works within 128-bit lanes.
+		const vec packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(v[0], v[0]), 0x08);
+		_mm_storeu_si128((__m128i*)dst, _mm256_castsi256_si128(packed));
+	}
+	static inline void vstore_out(uint32_t *dst, const vec *v)
+	{
+		_mm256_storeu_si256((__m256i*)dst, v[0]);
+	}
+
+#include "md_ntsc_simd_kernel.hpp"
+}
+GSFT_SIMD_END
+#endif /* GSFT_SIMD_AVX2 */
+
+#endif /* MD_NTSC_SIMD_HPP */
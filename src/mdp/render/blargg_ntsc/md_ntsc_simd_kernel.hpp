@@ -0,0 +1,130 @@
+/***************************************************************************
+ * MDP: Blargg's NTSC Filter. (SIMD row kernel)                            *
+ *                                                                         *
+ * Copyright (c) 2006 by Shay Green                                        *
+ * SIMD version Copyright (c) 2008-2010 by David Korth                     *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation; either version 2.1 of the License, or  *
+ * (at your option) any later version.                                     *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * This file is included once for each instruction set by md_ntsc_simd.hpp.
+ * There are no include guards.
+ *
+ * Required definitions:
+ * - vec: Vector of 32-bit lanes.
+ * - LANES: Number of lanes in vec. (4 or 8)
+ * - vload(), vset1(), vadd(), vsub(), vand(), vor(), vsel(), vsrl(): Vector operations.
+ * - vmask_ge(), vstore_out(): Helper functions.
+ */
+
+/**
+ * T_md_ntsc_row_simd(): Filter one row.
+ * Output is identical to MD_NTSC_RGB_OUT(); only the low 32 bits
+ * of md_ntsc_rgb_t affect the output pixels.
+ * @param ntsc NTSC filter.
+ * @param line_in Input row. (RGB565)
+ * @param in_width Width of the input row.
+ * @param line_out Output row. (in_width * 2)
+ */
+template<typename pixel, pixel maskR, pixel maskG, pixel maskB, int shiftR, int shiftG, int shiftB>
+static void T_md_ntsc_row_simd(md_ntsc_t const* ntsc, uint16_t const* line_in,
+			       int in_width, pixel *line_out)
+{
+	enum { PARTS = md_ntsc_out_chunk / LANES };
+	const int chunks = in_width / md_ntsc_in_chunk;
+	const int last_in = (chunks * md_ntsc_in_chunk) - 1;
+
+	// For input pixel i of a chunk, output pixels >= i*2 use the current chunk's
+	// kernel. The previous output pixels still use the previous chunk's kernel.
+	vec mask[md_ntsc_in_chunk][PARTS];
+	for (int i = 0; i < md_ntsc_in_chunk; i++)
+	{
+		for (int part = 0; part < PARTS; part++)
+			mask[i][part] = vmask_ge(part * LANES, i * 2);
+	}
+
+	const vec clamp_mask = vset1((uint32_t)md_ntsc_clamp_mask);
+	const vec clamp_add = vset1((uint32_t)md_ntsc_clamp_add);
+	const vec vmaskR = vset1(maskR);
+	const vec vmaskG = vset1(maskG);
+	const vec vmaskB = vset1(maskB);
+
+	// Output pixel x of chunk k is the sum of, for each input pixel i:
+	// - x >= i*2: lo(k) + hi(k-1)
+	// - x <  i*2: lo(k-1) + hi(k-2)
+	// where lo() and hi() are the two halves of simd_table[][i].
+	// Keep hi(k-1) and the previous sum so each chunk only loads its own kernels.
+	// The first chunk is (black, line_in[0], line_in[1], line_in[2]),
+	// and the chunk before it is all black.
+	vec hi_prev[md_ntsc_in_chunk][PARTS];
+	vec sum_prev[md_ntsc_in_chunk][PARTS];
+	for (int i = 0; i < md_ntsc_in_chunk; i++)
+	{
+		const uint32_t *black = ntsc->simd_table[md_ntsc_black][i];
+		const int x = i - 1;
+		const unsigned int entry = (x >= 0 && x <= last_in ? md_ntsc_simd_index(line_in[x]) : (unsigned int)md_ntsc_black);
+		const uint32_t *kernel = ntsc->simd_table[entry][i];
+		for (int part = 0; part < PARTS; part++)
+		{
+			sum_prev[i][part] = vadd(vload(&kernel[part * LANES]),
+						 vload(&black[md_ntsc_out_chunk + part * LANES]));
+			hi_prev[i][part] = vload(&kernel[md_ntsc_out_chunk + part * LANES]);
+		}
+	}
+
+	for (int chunk = 1; chunk <= chunks; chunk++)
+	{
+		const int x0 = (chunk * md_ntsc_in_chunk) - 1;
+		vec raw[PARTS];
+		for (int part = 0; part < PARTS; part++)
+			raw[part] = vset1(0);
+
+		for (int i = 0; i < md_ntsc_in_chunk; i++)
+		{
+			const int x = x0 + i;
+			const unsigned int entry = (x <= last_in ? md_ntsc_simd_index(line_in[x]) : (unsigned int)md_ntsc_black);
+			const uint32_t *kernel = ntsc->simd_table[entry][i];
+			for (int part = 0; part < PARTS; part++)
+			{
+				const vec sum = vadd(vload(&kernel[part * LANES]), hi_prev[i][part]);
+				raw[part] = vadd(raw[part], vsel(mask[i][part], sum, sum_prev[i][part]));
+				sum_prev[i][part] = sum;
+				hi_prev[i][part] = vload(&kernel[md_ntsc_out_chunk + part * LANES]);
+			}
+		}
+
+		vec out[PARTS];
+		for (int part = 0; part < PARTS; part++)
+		{
+			vec r = raw[part];
+
+			// MD_NTSC_CLAMP_()
+			const vec sub = vand(vsrl(r, 9), clamp_mask);
+			vec clamp = vsub(clamp_add, sub);
+			r = vor(r, clamp);
+			clamp = vsub(clamp, sub);
+			r = vand(r, clamp);
+
+			// MD_NTSC_RGB_OUT_()
+			out[part] = vor(vor(vand(vsrl(r, shiftR), vmaskR),
+					    vand(vsrl(r, shiftG), vmaskG)),
+					vand(vsrl(r, shiftB), vmaskB));
+		}
+
+		vstore_out(line_out, out);
+		line_out += md_ntsc_out_chunk;
+	}
+}
@@ -46,7 +46,8 @@ mdp_render_t mdp_render =
 	.scale = 2,
 	.flags = MDP_RENDER_FLAG_RGB_565to555 |
 		 MDP_RENDER_FLAG_RGB_565to565 |
-		 MDP_RENDER_FLAG_RGB_565to888
+		 MDP_RENDER_FLAG_RGB_565to888 |
+		 MDP_RENDER_FLAG_BAND_SAFE
 };
 
 static mdp_func_t mdp_func =
@@ -59,10 +60,10 @@ mdp_t mdp =
 {
 	// Plugin version information.
 	.interfaceVersion = MDP_VERSION(1, 0, 0),
-	.pluginVersion = MDP_VERSION(1, 1, 1),
+	.pluginVersion = MDP_VERSION(1, 2, 0),
 	
 	// CPU flags.
-	.cpuFlagsSupported = 0,
+	.cpuFlagsSupported = MDP_CPUFLAG_X86_SSE2 | MDP_CPUFLAG_X86_AVX2,
 	.cpuFlagsRequired = 0,
 	
 	// UUID: 78a37c47-ecbe-41a4-b446-732a84899840
@@ -30,6 +30,9 @@
 #include "mdp/mdp_stdint.h"
 #include "mdp/mdp_error.h"
 
+// SIMD versions.
+#include "../scalex_common/scalex_simd.hpp"
+
 // MDP Host Services.
 static const mdp_host_t *mdp_render_epx_host_srv = NULL;
 
@@ -76,12 +79,20 @@ int MDP_FNCALL mdp_render_epx_end(void)
  * @param srcPitch Pitch of mdScreen.
  * @param width Width of the image.
  * @param height Height of the image.
+ * @param cpuFlags CPU flags.
  */
 template<typename pixel>
 static inline void T_mdp_render_epx_cpp(pixel *destScreen, pixel *mdScreen,
 					int destPitch, int srcPitch,
-					int width, int height)
+					int width, int height, uint32_t cpuFlags)
 {
+	if (!scalex_epx_simd<pixel>(destScreen, destPitch, mdScreen, srcPitch,
+				    width, height, cpuFlags))
+	{
+		// SIMD version was used.
+		return;
+	}
+	
 	destPitch /= sizeof(pixel);
 	srcPitch /= sizeof(pixel);
 	
@@ -123,7 +134,7 @@ static inline void T_mdp_render_epx_cpp(pixel *destScreen, pixel *mdScreen,
 int MDP_FNCALL mdp_render_epx_cpp(const mdp_render_info_t *render_info)
 {
 	if (!render_info)
-		return -MDP_ERR_RENDER_INVALID_RENDERINFO;;
+		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
 	
 	if (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) !=
 	    MDP_RENDER_VMODE_GET_DST(render_info->vmodeFlags))
@@ -140,7 +151,8 @@ int MDP_FNCALL mdp_render_epx_cpp(const mdp_render_info_t *render_info)
 				    (uint16_t*)render_info->destScreen,
 				    (uint16_t*)render_info->mdScreen,
 				    render_info->destPitch, render_info->srcPitch,
-				    render_info->width, render_info->height);
+				    render_info->width, render_info->height,
+				    render_info->cpuFlags);
 			break;
 		
 		case MDP_RENDER_VMODE_RGB_888:
@@ -148,7 +160,8 @@ int MDP_FNCALL mdp_render_epx_cpp(const mdp_render_info_t *render_info)
 				    (uint32_t*)render_info->destScreen,
 				    (uint32_t*)render_info->mdScreen,
 				    render_info->destPitch, render_info->srcPitch,
-				    render_info->width, render_info->height);
+				    render_info->width, render_info->height,
+				    render_info->cpuFlags);
 			break;
 		
 		default:
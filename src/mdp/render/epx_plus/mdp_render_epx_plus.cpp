@@ -30,13 +30,14 @@
 #include "mdp/mdp_stdint.h"
 #include "mdp/mdp_error.h"
 
-// Mask constants.
+// Scalar and SIMD versions.
+#include "../scalex_common/scalex_simd.hpp"
+
+// Mask constants for scalex_blend().
 #define MASK_DIV2_15		((uint16_t)(0x3DEF))
 #define MASK_DIV2_16		((uint16_t)(0x7BEF))
 #define MASK_DIV2_32		((uint32_t)(0x7F7F7F7F))
 
-#define BLEND(a, b, mask) ((((a) >> 1) & mask) + (((b) >> 1) & mask))
-
 // MDP Host Services.
 static const mdp_host_t *mdp_render_epx_plus_host_srv = NULL;
 
@@ -83,67 +84,33 @@ int MDP_FNCALL mdp_render_epx_plus_end(void)
  * @param srcPitch Pitch of mdScreen.
  * @param width Width of the image.
  * @param height Height of the image.
- * @param mask Mask for BLEND().
+ * @param mask Mask for scalex_blend().
+ * @param cpuFlags CPU flags.
  */
 template<typename pixel>
 static inline void T_mdp_render_epx_plus_cpp(pixel *destScreen, pixel *mdScreen,
 					     int destPitch, int srcPitch,
-					     int width, int height, pixel mask)
+					     int width, int height, pixel mask,
+					     uint32_t cpuFlags)
 {
+	if (!scalex_epx_plus_simd<pixel>(destScreen, destPitch, mdScreen, srcPitch,
+					 width, height, mask, cpuFlags))
+	{
+		// SIMD version was used.
+		return;
+	}
+	
 	destPitch /= sizeof(pixel);
 	srcPitch /= sizeof(pixel);
 	
 	for (int y = 0; y < height; y++)
 	{
-		pixel *SrcLine = &mdScreen[y * srcPitch];
+		const pixel *SrcLine = &mdScreen[y * srcPitch];
 		pixel *DstLine1 = &destScreen[(y * 2) * destPitch];
 		pixel *DstLine2 = &destScreen[((y * 2) + 1) * destPitch];
 		
-		pixel UL = *(SrcLine - srcPitch - 1);
-		pixel U  = *(SrcLine - srcPitch);
-		pixel UR = *(SrcLine - srcPitch + 1);
-		pixel LL = *(SrcLine - 2);
-		pixel L  = *(SrcLine - 1);
-		pixel C  = *(SrcLine);
-		pixel R  = *(SrcLine + 1);
-		pixel RR = *(SrcLine + 2);
-		pixel DL = *(SrcLine + srcPitch - 1);
-		pixel D  = *(SrcLine + srcPitch);
-		pixel DR = *(SrcLine + srcPitch + 1);
-		
 		for (int x = 0; x < width; x++)
-		{
-			UL = U, U = UR;
-			LL = L, L = C, C = R, R = RR;
-			DL = D, D = DR;
-			
-			UR = *(SrcLine - srcPitch + 1);
-			RR = *(SrcLine + 2);
-			DR = *(SrcLine + srcPitch + 1);
-			
-			pixel UU, DD;
-			if (L != R && U != D)
-			{
-				UU = *(SrcLine - (2 * srcPitch));
-				DD = *(SrcLine + (2 * srcPitch));
-			}
-			
-			*DstLine1++ = (L != R && U != D && U == L && (UR == R || DL == D || R != RR || D != DD))
-					? ((UR == DL && (L == LL || U == UU))      ? BLEND(C, U, mask) : U)
-					: ((L == U && C == UR && L != C && L == D) ? BLEND(C, L, mask) : C);
-			*DstLine1++ = (R != L && U != D && U == R && (UL == L || DR == D || L != LL || D != DD))
-					? ((UL == DR && (R == RR || U == UU))      ? BLEND(C, U, mask) : U)
-					: ((R == U && C == UL && R != C && R == D) ? BLEND(C, R, mask) : C);
-			
-			*DstLine2++ = (L != R && D != U && D == L && (DR == R || UL == U || R != RR || U != UU))
-					? ((DR == UL && (L == LL || D == DD))      ? BLEND(C, D, mask) : D)
-					: ((L == D && C == DR && L != C && L == U) ? BLEND(C, L, mask) : C);
-			*DstLine2++ = (R != L && D != U && D == R && (DL == L || UR == U || L != LL || U != UU))
-					? ((DL == UR && (R == RR || D == DD))      ? BLEND(C, D, mask) : D)
-					: ((R == D && C == DL && R != C && R == U) ? BLEND(C, R, mask) : C);
-			
-			SrcLine++;
-		}
+			scalex_epx_plus_px(DstLine1, DstLine2, SrcLine, srcPitch, x, mask);
 	}
 }
 
@@ -151,7 +118,7 @@ static inline void T_mdp_render_epx_plus_cpp(pixel *destScreen, pixel *mdScreen,
 int MDP_FNCALL mdp_render_epx_plus_cpp(const mdp_render_info_t *render_info)
 {
 	if (!render_info)
-		return -MDP_ERR_RENDER_INVALID_RENDERINFO;;
+		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
 	
 	if (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) !=
 	    MDP_RENDER_VMODE_GET_DST(render_info->vmodeFlags))
@@ -169,7 +136,8 @@ int MDP_FNCALL mdp_render_epx_plus_cpp(const mdp_render_info_t *render_info)
 				    (uint16_t*)render_info->mdScreen,
 				    render_info->destPitch, render_info->srcPitch,
 				    render_info->width, render_info->height,
-				    (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) == MDP_RENDER_VMODE_RGB_565 ? MASK_DIV2_16 : MASK_DIV2_15));
+				    (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) == MDP_RENDER_VMODE_RGB_565 ? MASK_DIV2_16 : MASK_DIV2_15),
+				    render_info->cpuFlags);
 			break;
 		
 		case MDP_RENDER_VMODE_RGB_888:
@@ -178,7 +146,8 @@ int MDP_FNCALL mdp_render_epx_plus_cpp(const mdp_render_info_t *render_info)
 				    (uint32_t*)render_info->mdScreen,
 				    render_info->destPitch, render_info->srcPitch,
 				    render_info->width, render_info->height,
-				    MASK_DIV2_32);
+				    MASK_DIV2_32, render_info->cpuFlags);
+			break;
 		
 		default:
 			// Unsupported video mode.
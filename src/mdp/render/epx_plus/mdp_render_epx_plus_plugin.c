@@ -45,7 +45,8 @@ mdp_render_t mdp_render =
 	.scale = 2,
 	.flags = MDP_RENDER_FLAG_RGB_555to555 |
 		 MDP_RENDER_FLAG_RGB_565to565 |
-		 MDP_RENDER_FLAG_RGB_888to888
+		 MDP_RENDER_FLAG_RGB_888to888 |
+		 MDP_RENDER_FLAG_BAND_SAFE
 };
 
 static mdp_func_t mdp_func =
@@ -58,10 +59,10 @@ mdp_t mdp =
 {
 	// Plugin version information.
 	.interfaceVersion = MDP_VERSION(1, 0, 0),
-	.pluginVersion = MDP_VERSION(1, 0, 0),
+	.pluginVersion = MDP_VERSION(1, 1, 0),
 	
 	// CPU flags.
-	.cpuFlagsSupported = 0,
+	.cpuFlagsSupported = MDP_CPUFLAG_X86_SSE2 | MDP_CPUFLAG_X86_AVX2,
 	.cpuFlagsRequired = 0,
 	
 	// UUID: 7473b2a7-ef03-48a4-a791-158b9006ef88
@@ -39,7 +39,6 @@ DLL_LOCAL int MDP_FNCALL mdp_render_hq2x_end(void);
 
 DLL_LOCAL int MDP_FNCALL mdp_render_hq2x_cpp(const mdp_render_info_t *render_info);
 
-DLL_LOCAL extern uint32_t *mdp_render_hq2x_RGB16to32;
 DLL_LOCAL extern uint32_t *mdp_render_hq2x_RGB16toYUV;
 
 #ifdef __cplusplus
@@ -28,24 +28,6 @@
 #include <stdlib.h>
 
 
-/**
- * mdp_render_hq2x_build_RGB16to32(): Build a 16-bit RGB to 32-bit RGB table.
- * @return RGB16to32.
- */
-uint32_t* MDP_FNCALL mdp_render_hq2x_build_RGB16to32(void)
-{
-	uint32_t *RGB16to32 = (uint32_t*)(malloc(65536 * sizeof(uint32_t)));
-	
-	// Initialize the 16-bit to 32-bit conversion table.
-	int i;
-	for (i = 0; i < 65536; i++)
-		RGB16to32[i] = ((i & 0xF800) << 8) + ((i & 0x07E0) << 5) + ((i & 0x001F) << 3);
-	
-	// Return the pointer.
-	return RGB16to32;
-}
-
-
 /**
  * mdp_render_hq2x_build_RGB16toYUV(): Build a 16-bit RGB to YUV table.
  * @return RGB16toYUV.
@@ -31,7 +31,6 @@
 extern "C" {
 #endif
 
-DLL_LOCAL uint32_t* MDP_FNCALL mdp_render_hq2x_build_RGB16to32(void);
 DLL_LOCAL uint32_t* MDP_FNCALL mdp_render_hq2x_build_RGB16toYUV(void);
 
 #ifdef __cplusplus
@@ -28,34 +28,23 @@
 #include "mdp_render_hq3x.h"
 #include "mdp_render_hq3x_plugin.h"
 #include "mdp_render_hq3x_RGB.h"
+#include "mdp_render_hq3x_kernel.hpp"
 
 // C includes.
 #include <stdlib.h>
-#include <string.h>
 
 // MDP includes.
 #include "mdp/mdp_stdint.h"
 #include "mdp/mdp_cpuflags.h"
 #include "mdp/mdp_error.h"
 
-// x86 asm versions.
-#ifdef GENS_X86_ASM
-#include "mdp_render_hq3x_x86.h"
-#endif /* GENS_X86_ASM */
-
 // MDP Host Services.
 static const mdp_host_t *mdp_render_hq3x_host_srv;
 
-// RGB lookup tables.
-uint32_t *mdp_render_hq3x_RGB16to32 = NULL;
+// RGB lookup table.
 uint32_t *mdp_render_hq3x_RGB16toYUV = NULL;
 
 
-// TODO: Proper 15-bit color support.
-// It "works' right now in 15-bit, but the output is different than with 16-bit.
-// My first attempt at 15-bit support resulted in massive failure. :(
-
-
 /**
  * mdp_render_hq3x_end(): Initialize the hq3x plugin.
  * @return MDP error code.
@@ -85,10 +74,6 @@ int MDP_FNCALL mdp_render_hq3x_end(void)
 	// Unregister the renderer.
 	mdp_render_hq3x_host_srv->renderer_unregister(&mdp, &mdp_render);
 	
-	// If the RGB16to32 table was allocated, free it.
-	free(mdp_render_hq3x_RGB16to32);
-	mdp_render_hq3x_RGB16to32 = NULL;
-	
 	// If the RGB16toYUV table was allocated, free it.
 	free(mdp_render_hq3x_RGB16toYUV);
 	mdp_render_hq3x_RGB16toYUV = NULL;
@@ -105,45 +90,7 @@ int MDP_FNCALL mdp_render_hq3x_end(void)
  */
 int MDP_FNCALL mdp_render_hq3x_cpp(const mdp_render_info_t *render_info)
 {
-	if (!render_info)
-		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
-	
-	if (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) !=
-	    MDP_RENDER_VMODE_GET_DST(render_info->vmodeFlags))
-	{
-		// Renderer only supports identical src/dst modes.
-		return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
-	}
-	
-	int mode565;
-	switch (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags))
-	{
-		case MDP_RENDER_VMODE_RGB_555:
-			mode565 = 0;
-			break;
-		case MDP_RENDER_VMODE_RGB_565:
-			mode565 = 1;
-			break;
-		default:
-			// Unsupported video mode.
-			return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
-	}
-	
-	// Make sure the lookup tables are initialized.
-	if (!mdp_render_hq3x_RGB16to32)
-		mdp_render_hq3x_RGB16to32 = mdp_render_hq3x_build_RGB16to32();
-	if (!mdp_render_hq3x_RGB16toYUV)
-		mdp_render_hq3x_RGB16toYUV = mdp_render_hq3x_build_RGB16toYUV();
-	
-	if (render_info->cpuFlags & MDP_CPUFLAG_X86_MMX)
-	{
-		mdp_render_hq3x_16_x86_mmx(
-			    (uint16_t*)render_info->destScreen,
-			    (uint16_t*)render_info->mdScreen,
-			    render_info->destPitch, render_info->srcPitch,
-			    render_info->width, render_info->height,
-			    mode565);
-	}
-	
-	return MDP_ERR_OK;
+	return T_hqx_blit<mdp_render_hq3x_kernel>(render_info,
+				&mdp_render_hq3x_RGB16toYUV,
+				mdp_render_hq3x_build_RGB16toYUV);
 }
@@ -0,0 +1,5313 @@
+/***************************************************************************
+ * MDP: hq4x renderer. (Kernel)                                            *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ * hq4x Copyright (c) 2003 by Maxim Stepin                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation; either version 2.1 of the License, or  *
+ * (at your option) any later version.                                     *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef MDP_RENDER_HQ4X_KERNEL_HPP
+#define MDP_RENDER_HQ4X_KERNEL_HPP
+
+#include "mdp/render/hqx_common/hqx_common.hpp"
+
+/**
+ * mdp_render_hq4x_kernel: hq4x kernel for T_hqx_render().
+ * The case table is the same as the original hq4x implementation.
+ */
+struct mdp_render_hq4x_kernel
+{
+	static const int scale = 4;
+	
+	template<typename pixel, class interp>
+	static inline void blit(pixel *dp, const int dpL, const pixel *w,
+				const uint32_t *yuv, const unsigned int pattern);
+};
+
+// Output pixel macros.
+// PIXELyx_n: Output pixel (x, y) using rule n.
+#define PIXEL00_0	dp[0] = w[5];
+#define PIXEL00_11	dp[0] = interp::Interp1(w[5], w[4]);
+#define PIXEL00_12	dp[0] = interp::Interp1(w[5], w[2]);
+#define PIXEL00_20	dp[0] = interp::Interp2(w[5], w[2], w[4]);
+#define PIXEL00_50	dp[0] = interp::Interp5(w[2], w[4]);
+#define PIXEL00_80	dp[0] = interp::Interp8(w[5], w[1]);
+#define PIXEL00_81	dp[0] = interp::Interp8(w[5], w[4]);
+#define PIXEL00_82	dp[0] = interp::Interp8(w[5], w[2]);
+#define PIXEL01_0	dp[1] = w[5];
+#define PIXEL01_10	dp[1] = interp::Interp1(w[5], w[1]);
+#define PIXEL01_12	dp[1] = interp::Interp1(w[5], w[2]);
+#define PIXEL01_14	dp[1] = interp::Interp1(w[2], w[5]);
+#define PIXEL01_21	dp[1] = interp::Interp2(w[2], w[5], w[4]);
+#define PIXEL01_31	dp[1] = interp::Interp3(w[5], w[4]);
+#define PIXEL01_50	dp[1] = interp::Interp5(w[2], w[5]);
+#define PIXEL01_60	dp[1] = interp::Interp6(w[5], w[2], w[4]);
+#define PIXEL01_61	dp[1] = interp::Interp6(w[5], w[2], w[1]);
+#define PIXEL01_82	dp[1] = interp::Interp8(w[5], w[2]);
+#define PIXEL01_83	dp[1] = interp::Interp8(w[2], w[4]);
+#define PIXEL02_0	dp[2] = w[5];
+#define PIXEL02_10	dp[2] = interp::Interp1(w[5], w[3]);
+#define PIXEL02_11	dp[2] = interp::Interp1(w[5], w[2]);
+#define PIXEL02_13	dp[2] = interp::Interp1(w[2], w[5]);
+#define PIXEL02_21	dp[2] = interp::Interp2(w[2], w[5], w[6]);
+#define PIXEL02_32	dp[2] = interp::Interp3(w[5], w[6]);
+#define PIXEL02_50	dp[2] = interp::Interp5(w[2], w[5]);
+#define PIXEL02_60	dp[2] = interp::Interp6(w[5], w[2], w[6]);
+#define PIXEL02_61	dp[2] = interp::Interp6(w[5], w[2], w[3]);
+#define PIXEL02_81	dp[2] = interp::Interp8(w[5], w[2]);
+#define PIXEL02_83	dp[2] = interp::Interp8(w[2], w[6]);
+#define PIXEL03_0	dp[3] = w[5];
+#define PIXEL03_11	dp[3] = interp::Interp1(w[5], w[2]);
+#define PIXEL03_12	dp[3] = interp::Interp1(w[5], w[6]);
+#define PIXEL03_20	dp[3] = interp::Interp2(w[5], w[2], w[6]);
+#define PIXEL03_50	dp[3] = interp::Interp5(w[2], w[6]);
+#define PIXEL03_80	dp[3] = interp::Interp8(w[5], w[3]);
+#define PIXEL03_81	dp[3] = interp::Interp8(w[5], w[2]);
+#define PIXEL03_82	dp[3] = interp::Interp8(w[5], w[6]);
+#define PIXEL10_0	dp[dpL] = w[5];
+#define PIXEL10_10	dp[dpL] = interp::Interp1(w[5], w[1]);
+#define PIXEL10_11	dp[dpL] = interp::Interp1(w[5], w[4]);
+#define PIXEL10_13	dp[dpL] = interp::Interp1(w[4], w[5]);
+#define PIXEL10_21	dp[dpL] = interp::Interp2(w[4], w[5], w[2]);
+#define PIXEL10_32	dp[dpL] = interp::Interp3(w[5], w[2]);
+#define PIXEL10_50	dp[dpL] = interp::Interp5(w[4], w[5]);
+#define PIXEL10_60	dp[dpL] = interp::Interp6(w[5], w[4], w[2]);
+#define PIXEL10_61	dp[dpL] = interp::Interp6(w[5], w[4], w[1]);
+#define PIXEL10_81	dp[dpL] = interp::Interp8(w[5], w[4]);
+#define PIXEL10_83	dp[dpL] = interp::Interp8(w[4], w[2]);
+#define PIXEL11_0	dp[dpL + 1] = w[5];
+#define PIXEL11_30	dp[dpL + 1] = interp::Interp3(w[5], w[1]);
+#define PIXEL11_31	dp[dpL + 1] = interp::Interp3(w[5], w[4]);
+#define PIXEL11_32	dp[dpL + 1] = interp::Interp3(w[5], w[2]);
+#define PIXEL11_70	dp[dpL + 1] = interp::Interp7(w[5], w[4], w[2]);
+#define PIXEL12_0	dp[dpL + 2] = w[5];
+#define PIXEL12_30	dp[dpL + 2] = interp::Interp3(w[5], w[3]);
+#define PIXEL12_31	dp[dpL + 2] = interp::Interp3(w[5], w[2]);
+#define PIXEL12_32	dp[dpL + 2] = interp::Interp3(w[5], w[6]);
+#define PIXEL12_70	dp[dpL + 2] = interp::Interp7(w[5], w[6], w[2]);
+#define PIXEL13_0	dp[dpL + 3] = w[5];
+#define PIXEL13_10	dp[dpL + 3] = interp::Interp1(w[5], w[3]);
+#define PIXEL13_12	dp[dpL + 3] = interp::Interp1(w[5], w[6]);
+#define PIXEL13_14	dp[dpL + 3] = interp::Interp1(w[6], w[5]);
+#define PIXEL13_21	dp[dpL + 3] = interp::Interp2(w[6], w[5], w[2]);
+#define PIXEL13_31	dp[dpL + 3] = interp::Interp3(w[5], w[2]);
+#define PIXEL13_50	dp[dpL + 3] = interp::Interp5(w[6], w[5]);
+#define PIXEL13_60	dp[dpL + 3] = interp::Interp6(w[5], w[6], w[2]);
+#define PIXEL13_61	dp[dpL + 3] = interp::Interp6(w[5], w[6], w[3]);
+#define PIXEL13_82	dp[dpL + 3] = interp::Interp8(w[5], w[6]);
+#define PIXEL13_83	dp[dpL + 3] = interp::Interp8(w[6], w[2]);
+#define PIXEL20_0	dp[dpL * 2] = w[5];
+#define PIXEL20_10	dp[dpL * 2] = interp::Interp1(w[5], w[7]);
+#define PIXEL20_12	dp[dpL * 2] = interp::Interp1(w[5], w[4]);
+#define PIXEL20_14	dp[dpL * 2] = interp::Interp1(w[4], w[5]);
+#define PIXEL20_21	dp[dpL * 2] = interp::Interp2(w[4], w[5], w[8]);
+#define PIXEL20_31	dp[dpL * 2] = interp::Interp3(w[5], w[8]);
+#define PIXEL20_50	dp[dpL * 2] = interp::Interp5(w[4], w[5]);
+#define PIXEL20_60	dp[dpL * 2] = interp::Interp6(w[5], w[4], w[8]);
+#define PIXEL20_61	dp[dpL * 2] = interp::Interp6(w[5], w[4], w[7]);
+#define PIXEL20_82	dp[dpL * 2] = interp::Interp8(w[5], w[4]);
+#define PIXEL20_83	dp[dpL * 2] = interp::Interp8(w[4], w[8]);
+#define PIXEL21_0	dp[dpL * 2 + 1] = w[5];
+#define PIXEL21_30	dp[dpL * 2 + 1] = interp::Interp3(w[5], w[7]);
+#define PIXEL21_31	dp[dpL * 2 + 1] = interp::Interp3(w[5], w[8]);
+#define PIXEL21_32	dp[dpL * 2 + 1] = interp::Interp3(w[5], w[4]);
+#define PIXEL21_70	dp[dpL * 2 + 1] = interp::Interp7(w[5], w[4], w[8]);
+#define PIXEL22_0	dp[dpL * 2 + 2] = w[5];
+#define PIXEL22_30	dp[dpL * 2 + 2] = interp::Interp3(w[5], w[9]);
+#define PIXEL22_31	dp[dpL * 2 + 2] = interp::Interp3(w[5], w[6]);
+#define PIXEL22_32	dp[dpL * 2 + 2] = interp::Interp3(w[5], w[8]);
+#define PIXEL22_70	dp[dpL * 2 + 2] = interp::Interp7(w[5], w[6], w[8]);
+#define PIXEL23_0	dp[dpL * 2 + 3] = w[5];
+#define PIXEL23_10	dp[dpL * 2 + 3] = interp::Interp1(w[5], w[9]);
+#define PIXEL23_11	dp[dpL * 2 + 3] = interp::Interp1(w[5], w[6]);
+#define PIXEL23_13	dp[dpL * 2 + 3] = interp::Interp1(w[6], w[5]);
+#define PIXEL23_21	dp[dpL * 2 + 3] = interp::Interp2(w[6], w[5], w[8]);
+#define PIXEL23_32	dp[dpL * 2 + 3] = interp::Interp3(w[5], w[8]);
+#define PIXEL23_50	dp[dpL * 2 + 3] = interp::Interp5(w[6], w[5]);
+#define PIXEL23_60	dp[dpL * 2 + 3] = interp::Interp6(w[5], w[6], w[8]);
+#define PIXEL23_61	dp[dpL * 2 + 3] = interp::Interp6(w[5], w[6], w[9]);
+#define PIXEL23_81	dp[dpL * 2 + 3] = interp::Interp8(w[5], w[6]);
+#define PIXEL23_83	dp[dpL * 2 + 3] = interp::Interp8(w[6], w[8]);
+#define PIXEL30_0	dp[dpL * 3] = w[5];
+#define PIXEL30_11	dp[dpL * 3] = interp::Interp1(w[5], w[8]);
+#define PIXEL30_12	dp[dpL * 3] = interp::Interp1(w[5], w[4]);
+#define PIXEL30_20	dp[dpL * 3] = interp::Interp2(w[5], w[8], w[4]);
+#define PIXEL30_50	dp[dpL * 3] = interp::Interp5(w[8], w[4]);
+#define PIXEL30_80	dp[dpL * 3] = interp::Interp8(w[5], w[7]);
+#define PIXEL30_81	dp[dpL * 3] = interp::Interp8(w[5], w[8]);
+#define PIXEL30_82	dp[dpL * 3] = interp::Interp8(w[5], w[4]);
+#define PIXEL31_0	dp[dpL * 3 + 1] = w[5];
+#define PIXEL31_10	dp[dpL * 3 + 1] = interp::Interp1(w[5], w[7]);
+#define PIXEL31_11	dp[dpL * 3 + 1] = interp::Interp1(w[5], w[8]);
+#define PIXEL31_13	dp[dpL * 3 + 1] = interp::Interp1(w[8], w[5]);
+#define PIXEL31_21	dp[dpL * 3 + 1] = interp::Interp2(w[8], w[5], w[4]);
+#define PIXEL31_32	dp[dpL * 3 + 1] = interp::Interp3(w[5], w[4]);
+#define PIXEL31_50	dp[dpL * 3 + 1] = interp::Interp5(w[8], w[5]);
+#define PIXEL31_60	dp[dpL * 3 + 1] = interp::Interp6(w[5], w[8], w[4]);
+#define PIXEL31_61	dp[dpL * 3 + 1] = interp::Interp6(w[5], w[8], w[7]);
+#define PIXEL31_81	dp[dpL * 3 + 1] = interp::Interp8(w[5], w[8]);
+#define PIXEL31_83	dp[dpL * 3 + 1] = interp::Interp8(w[8], w[4]);
+#define PIXEL32_0	dp[dpL * 3 + 2] = w[5];
+#define PIXEL32_10	dp[dpL * 3 + 2] = interp::Interp1(w[5], w[9]);
+#define PIXEL32_12	dp[dpL * 3 + 2] = interp::Interp1(w[5], w[8]);
+#define PIXEL32_14	dp[dpL * 3 + 2] = interp::Interp1(w[8], w[5]);
+#define PIXEL32_21	dp[dpL * 3 + 2] = interp::Interp2(w[8], w[5], w[6]);
+#define PIXEL32_31	dp[dpL * 3 + 2] = interp::Interp3(w[5], w[6]);
+#define PIXEL32_50	dp[dpL * 3 + 2] = interp::Interp5(w[8], w[5]);
+#define PIXEL32_60	dp[dpL * 3 + 2] = interp::Interp6(w[5], w[8], w[6]);
+#define PIXEL32_61	dp[dpL * 3 + 2] = interp::Interp6(w[5], w[8], w[9]);
+#define PIXEL32_82	dp[dpL * 3 + 2] = interp::Interp8(w[5], w[8]);
+#define PIXEL32_83	dp[dpL * 3 + 2] = interp::Interp8(w[8], w[6]);
+#define PIXEL33_0	dp[dpL * 3 + 3] = w[5];
+#define PIXEL33_11	dp[dpL * 3 + 3] = interp::Interp1(w[5], w[6]);
+#define PIXEL33_12	dp[dpL * 3 + 3] = interp::Interp1(w[5], w[8]);
+#define PIXEL33_20	dp[dpL * 3 + 3] = interp::Interp2(w[5], w[8], w[6]);
+#define PIXEL33_50	dp[dpL * 3 + 3] = interp::Interp5(w[8], w[6]);
+#define PIXEL33_80	dp[dpL * 3 + 3] = interp::Interp8(w[5], w[9]);
+#define PIXEL33_81	dp[dpL * 3 + 3] = interp::Interp8(w[5], w[6]);
+#define PIXEL33_82	dp[dpL * 3 + 3] = interp::Interp8(w[5], w[8]);
+
+
+/**
+ * blit(): Render one source pixel.
+ * @param dp		Destination pointer.
+ * @param dpL		Destination pitch, in pixels.
+ * @param w		Source pixels. (w[1]-w[9]; w[5] is the center pixel.)
+ * @param yuv		YUV values for w[1]-w[9].
+ * @param pattern	Neighbor pattern.
+ */
+template<typename pixel, class interp>
+inline void mdp_render_hq4x_kernel::blit(pixel *dp, const int dpL, const pixel *w,
+					 const uint32_t *yuv, const unsigned int pattern)
+{
+	switch (pattern)
+	{
+		case 0:
+		case 1:
+		case 4:
+		case 32:
+		case 128:
+		case 5:
+		case 132:
+		case 160:
+		case 33:
+		case 129:
+		case 36:
+		case 133:
+		case 164:
+		case 161:
+		case 37:
+		case 165:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_70
+			PIXEL13_60
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 2:
+		case 34:
+		case 130:
+		case 162:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 16:
+		case 17:
+		case 48:
+		case 49:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 64:
+		case 65:
+		case 68:
+		case 69:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_70
+			PIXEL13_60
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL30_80
+			PIXEL31_10
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 8:
+		case 12:
+		case 136:
+		case 140:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_70
+			PIXEL13_60
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 3:
+		case 35:
+		case 131:
+		case 163:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 6:
+		case 38:
+		case 134:
+		case 166:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 20:
+		case 21:
+		case 52:
+		case 53:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_31
+			PIXEL13_31
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 144:
+		case 145:
+		case 176:
+		case 177:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 192:
+		case 193:
+		case 196:
+		case 197:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_70
+			PIXEL13_60
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL30_80
+			PIXEL31_10
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 96:
+		case 97:
+		case 100:
+		case 101:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_70
+			PIXEL13_60
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 40:
+		case 44:
+		case 168:
+		case 172:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_70
+			PIXEL13_60
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 9:
+		case 13:
+		case 137:
+		case 141:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_70
+			PIXEL13_60
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 18:
+		case 50:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL12_0
+				PIXEL13_50
+			}
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 80:
+		case 81:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_61
+			PIXEL21_30
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL22_0
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 72:
+		case 76:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_70
+			PIXEL13_60
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL21_0
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 10:
+		case 138:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL10_10
+				PIXEL11_30
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+				PIXEL11_0
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 66:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL30_80
+			PIXEL31_10
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 24:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 7:
+		case 39:
+		case 135:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 148:
+		case 149:
+		case 180:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_31
+			PIXEL13_31
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 224:
+		case 228:
+		case 225:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_70
+			PIXEL13_60
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 41:
+		case 169:
+		case 45:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_70
+			PIXEL13_60
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 22:
+		case 54:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_0
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 208:
+		case 209:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 104:
+		case 108:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_70
+			PIXEL13_60
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 11:
+		case 139:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL11_0
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 19:
+		case 51:
+		{
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL00_81
+				PIXEL01_31
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+			}
+			else
+			{
+				PIXEL00_12
+				PIXEL01_14
+				PIXEL02_83
+				PIXEL03_50
+				PIXEL12_70
+				PIXEL13_21
+			}
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 146:
+		case 178:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+				PIXEL23_32
+				PIXEL33_82
+			}
+			else
+			{
+				PIXEL02_21
+				PIXEL03_50
+				PIXEL12_70
+				PIXEL13_83
+				PIXEL23_13
+				PIXEL33_11
+			}
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_32
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_82
+			break;
+		}
+		case 84:
+		case 85:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_81
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL03_81
+				PIXEL13_31
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL03_12
+				PIXEL13_14
+				PIXEL22_70
+				PIXEL23_83
+				PIXEL32_21
+				PIXEL33_50
+			}
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_31
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 112:
+		case 113:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_82
+			PIXEL21_32
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL30_82
+				PIXEL31_32
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL22_70
+				PIXEL23_21
+				PIXEL30_11
+				PIXEL31_13
+				PIXEL32_83
+				PIXEL33_50
+			}
+			break;
+		}
+		case 200:
+		case 204:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_70
+			PIXEL13_60
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+				PIXEL32_31
+				PIXEL33_81
+			}
+			else
+			{
+				PIXEL20_21
+				PIXEL21_70
+				PIXEL30_50
+				PIXEL31_83
+				PIXEL32_14
+				PIXEL33_12
+			}
+			PIXEL22_31
+			PIXEL23_81
+			break;
+		}
+		case 73:
+		case 77:
+		{
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL00_82
+				PIXEL10_32
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+			}
+			else
+			{
+				PIXEL00_11
+				PIXEL10_13
+				PIXEL20_83
+				PIXEL21_70
+				PIXEL30_50
+				PIXEL31_21
+			}
+			PIXEL01_82
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL11_32
+			PIXEL12_70
+			PIXEL13_60
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 42:
+		case 170:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL10_10
+				PIXEL11_30
+				PIXEL20_31
+				PIXEL30_81
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_21
+				PIXEL10_83
+				PIXEL11_70
+				PIXEL20_14
+				PIXEL30_12
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL21_31
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL31_81
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 14:
+		case 142:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL02_32
+				PIXEL03_82
+				PIXEL10_10
+				PIXEL11_30
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_83
+				PIXEL02_13
+				PIXEL03_11
+				PIXEL10_21
+				PIXEL11_70
+			}
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 67:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL30_80
+			PIXEL31_10
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 70:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL30_80
+			PIXEL31_10
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 28:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_31
+			PIXEL13_31
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 152:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 194:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL30_80
+			PIXEL31_10
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 98:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 56:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 25:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 26:
+		case 31:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL11_0
+			PIXEL12_0
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 82:
+		case 214:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_0
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 88:
+		case 248:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_30
+			PIXEL13_10
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			break;
+		}
+		case 74:
+		case 107:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL11_0
+			PIXEL12_30
+			PIXEL13_61
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 27:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL11_0
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 86:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_0
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_80
+			PIXEL31_10
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 216:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 106:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_30
+			PIXEL13_61
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 30:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_0
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 210:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 120:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_30
+			PIXEL13_10
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 75:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL11_0
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL30_80
+			PIXEL31_10
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 29:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_31
+			PIXEL13_31
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 198:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL30_80
+			PIXEL31_10
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 184:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 99:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 57:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 71:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL30_80
+			PIXEL31_10
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 156:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_31
+			PIXEL13_31
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 226:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 60:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_31
+			PIXEL13_31
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 195:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL30_80
+			PIXEL31_10
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 102:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 153:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 58:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL10_10
+				PIXEL11_30
+			}
+			else
+			{
+				PIXEL00_20
+				PIXEL01_12
+				PIXEL10_11
+				PIXEL11_0
+			}
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+			}
+			else
+			{
+				PIXEL02_11
+				PIXEL03_20
+				PIXEL12_0
+				PIXEL13_12
+			}
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 83:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+			}
+			else
+			{
+				PIXEL02_11
+				PIXEL03_20
+				PIXEL12_0
+				PIXEL13_12
+			}
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL20_61
+			PIXEL21_30
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL22_0
+				PIXEL23_11
+				PIXEL32_12
+				PIXEL33_20
+			}
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 92:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_31
+			PIXEL13_31
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+			}
+			else
+			{
+				PIXEL20_12
+				PIXEL21_0
+				PIXEL30_20
+				PIXEL31_11
+			}
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL22_0
+				PIXEL23_11
+				PIXEL32_12
+				PIXEL33_20
+			}
+			break;
+		}
+		case 202:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL10_10
+				PIXEL11_30
+			}
+			else
+			{
+				PIXEL00_20
+				PIXEL01_12
+				PIXEL10_11
+				PIXEL11_0
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL12_30
+			PIXEL13_61
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+			}
+			else
+			{
+				PIXEL20_12
+				PIXEL21_0
+				PIXEL30_20
+				PIXEL31_11
+			}
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 78:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL10_10
+				PIXEL11_30
+			}
+			else
+			{
+				PIXEL00_20
+				PIXEL01_12
+				PIXEL10_11
+				PIXEL11_0
+			}
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL12_32
+			PIXEL13_82
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+			}
+			else
+			{
+				PIXEL20_12
+				PIXEL21_0
+				PIXEL30_20
+				PIXEL31_11
+			}
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 154:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL10_10
+				PIXEL11_30
+			}
+			else
+			{
+				PIXEL00_20
+				PIXEL01_12
+				PIXEL10_11
+				PIXEL11_0
+			}
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+			}
+			else
+			{
+				PIXEL02_11
+				PIXEL03_20
+				PIXEL12_0
+				PIXEL13_12
+			}
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 114:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+			}
+			else
+			{
+				PIXEL02_11
+				PIXEL03_20
+				PIXEL12_0
+				PIXEL13_12
+			}
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL20_82
+			PIXEL21_32
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL22_0
+				PIXEL23_11
+				PIXEL32_12
+				PIXEL33_20
+			}
+			PIXEL30_82
+			PIXEL31_32
+			break;
+		}
+		case 89:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_30
+			PIXEL13_10
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+			}
+			else
+			{
+				PIXEL20_12
+				PIXEL21_0
+				PIXEL30_20
+				PIXEL31_11
+			}
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL22_0
+				PIXEL23_11
+				PIXEL32_12
+				PIXEL33_20
+			}
+			break;
+		}
+		case 90:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL10_10
+				PIXEL11_30
+			}
+			else
+			{
+				PIXEL00_20
+				PIXEL01_12
+				PIXEL10_11
+				PIXEL11_0
+			}
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+			}
+			else
+			{
+				PIXEL02_11
+				PIXEL03_20
+				PIXEL12_0
+				PIXEL13_12
+			}
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+			}
+			else
+			{
+				PIXEL20_12
+				PIXEL21_0
+				PIXEL30_20
+				PIXEL31_11
+			}
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL22_0
+				PIXEL23_11
+				PIXEL32_12
+				PIXEL33_20
+			}
+			break;
+		}
+		case 55:
+		case 23:
+		{
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL00_81
+				PIXEL01_31
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL12_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL00_12
+				PIXEL01_14
+				PIXEL02_83
+				PIXEL03_50
+				PIXEL12_70
+				PIXEL13_21
+			}
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 182:
+		case 150:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL12_0
+				PIXEL13_0
+				PIXEL23_32
+				PIXEL33_82
+			}
+			else
+			{
+				PIXEL02_21
+				PIXEL03_50
+				PIXEL12_70
+				PIXEL13_83
+				PIXEL23_13
+				PIXEL33_11
+			}
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_32
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_82
+			break;
+		}
+		case 213:
+		case 212:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_81
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL03_81
+				PIXEL13_31
+				PIXEL22_0
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL03_12
+				PIXEL13_14
+				PIXEL22_70
+				PIXEL23_83
+				PIXEL32_21
+				PIXEL33_50
+			}
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_31
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 241:
+		case 240:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_82
+			PIXEL21_32
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_0
+				PIXEL23_0
+				PIXEL30_82
+				PIXEL31_32
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL22_70
+				PIXEL23_21
+				PIXEL30_11
+				PIXEL31_13
+				PIXEL32_83
+				PIXEL33_50
+			}
+			break;
+		}
+		case 236:
+		case 232:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_70
+			PIXEL13_60
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL21_0
+				PIXEL30_0
+				PIXEL31_0
+				PIXEL32_31
+				PIXEL33_81
+			}
+			else
+			{
+				PIXEL20_21
+				PIXEL21_70
+				PIXEL30_50
+				PIXEL31_83
+				PIXEL32_14
+				PIXEL33_12
+			}
+			PIXEL22_31
+			PIXEL23_81
+			break;
+		}
+		case 109:
+		case 105:
+		{
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL00_82
+				PIXEL10_32
+				PIXEL20_0
+				PIXEL21_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL00_11
+				PIXEL10_13
+				PIXEL20_83
+				PIXEL21_70
+				PIXEL30_50
+				PIXEL31_21
+			}
+			PIXEL01_82
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL11_32
+			PIXEL12_70
+			PIXEL13_60
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 171:
+		case 43:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+				PIXEL11_0
+				PIXEL20_31
+				PIXEL30_81
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_21
+				PIXEL10_83
+				PIXEL11_70
+				PIXEL20_14
+				PIXEL30_12
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL21_31
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL31_81
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 143:
+		case 15:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL02_32
+				PIXEL03_82
+				PIXEL10_0
+				PIXEL11_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_83
+				PIXEL02_13
+				PIXEL03_11
+				PIXEL10_21
+				PIXEL11_70
+			}
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 124:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_31
+			PIXEL13_31
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 203:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL11_0
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL30_80
+			PIXEL31_10
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 62:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_0
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 211:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 118:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_0
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 217:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 110:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_32
+			PIXEL13_82
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 155:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL11_0
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 188:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_31
+			PIXEL13_31
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 185:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 61:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_31
+			PIXEL13_31
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 157:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_31
+			PIXEL13_31
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 103:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 227:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 230:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 199:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL30_80
+			PIXEL31_10
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 220:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_31
+			PIXEL13_31
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+			}
+			else
+			{
+				PIXEL20_12
+				PIXEL21_0
+				PIXEL30_20
+				PIXEL31_11
+			}
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			break;
+		}
+		case 158:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL10_10
+				PIXEL11_30
+			}
+			else
+			{
+				PIXEL00_20
+				PIXEL01_12
+				PIXEL10_11
+				PIXEL11_0
+			}
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL12_0
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 234:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL10_10
+				PIXEL11_30
+			}
+			else
+			{
+				PIXEL00_20
+				PIXEL01_12
+				PIXEL10_11
+				PIXEL11_0
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL12_30
+			PIXEL13_61
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 242:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+			}
+			else
+			{
+				PIXEL02_11
+				PIXEL03_20
+				PIXEL12_0
+				PIXEL13_12
+			}
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			PIXEL30_82
+			PIXEL31_32
+			break;
+		}
+		case 59:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+			}
+			else
+			{
+				PIXEL02_11
+				PIXEL03_20
+				PIXEL12_0
+				PIXEL13_12
+			}
+			PIXEL11_0
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 121:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_30
+			PIXEL13_10
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL22_0
+				PIXEL23_11
+				PIXEL32_12
+				PIXEL33_20
+			}
+			break;
+		}
+		case 87:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_0
+			PIXEL20_61
+			PIXEL21_30
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL22_0
+				PIXEL23_11
+				PIXEL32_12
+				PIXEL33_20
+			}
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 79:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL11_0
+			PIXEL12_32
+			PIXEL13_82
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+			}
+			else
+			{
+				PIXEL20_12
+				PIXEL21_0
+				PIXEL30_20
+				PIXEL31_11
+			}
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 122:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL10_10
+				PIXEL11_30
+			}
+			else
+			{
+				PIXEL00_20
+				PIXEL01_12
+				PIXEL10_11
+				PIXEL11_0
+			}
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+			}
+			else
+			{
+				PIXEL02_11
+				PIXEL03_20
+				PIXEL12_0
+				PIXEL13_12
+			}
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL22_0
+				PIXEL23_11
+				PIXEL32_12
+				PIXEL33_20
+			}
+			break;
+		}
+		case 94:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL10_10
+				PIXEL11_30
+			}
+			else
+			{
+				PIXEL00_20
+				PIXEL01_12
+				PIXEL10_11
+				PIXEL11_0
+			}
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL12_0
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+			}
+			else
+			{
+				PIXEL20_12
+				PIXEL21_0
+				PIXEL30_20
+				PIXEL31_11
+			}
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL22_0
+				PIXEL23_11
+				PIXEL32_12
+				PIXEL33_20
+			}
+			break;
+		}
+		case 218:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL10_10
+				PIXEL11_30
+			}
+			else
+			{
+				PIXEL00_20
+				PIXEL01_12
+				PIXEL10_11
+				PIXEL11_0
+			}
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+			}
+			else
+			{
+				PIXEL02_11
+				PIXEL03_20
+				PIXEL12_0
+				PIXEL13_12
+			}
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+			}
+			else
+			{
+				PIXEL20_12
+				PIXEL21_0
+				PIXEL30_20
+				PIXEL31_11
+			}
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			break;
+		}
+		case 91:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+			}
+			else
+			{
+				PIXEL02_11
+				PIXEL03_20
+				PIXEL12_0
+				PIXEL13_12
+			}
+			PIXEL11_0
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+			}
+			else
+			{
+				PIXEL20_12
+				PIXEL21_0
+				PIXEL30_20
+				PIXEL31_11
+			}
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL22_0
+				PIXEL23_11
+				PIXEL32_12
+				PIXEL33_20
+			}
+			break;
+		}
+		case 229:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_70
+			PIXEL13_60
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 167:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 173:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_70
+			PIXEL13_60
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 181:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_31
+			PIXEL13_31
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 186:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL10_10
+				PIXEL11_30
+			}
+			else
+			{
+				PIXEL00_20
+				PIXEL01_12
+				PIXEL10_11
+				PIXEL11_0
+			}
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+			}
+			else
+			{
+				PIXEL02_11
+				PIXEL03_20
+				PIXEL12_0
+				PIXEL13_12
+			}
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 115:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+			}
+			else
+			{
+				PIXEL02_11
+				PIXEL03_20
+				PIXEL12_0
+				PIXEL13_12
+			}
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL20_82
+			PIXEL21_32
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL22_0
+				PIXEL23_11
+				PIXEL32_12
+				PIXEL33_20
+			}
+			PIXEL30_82
+			PIXEL31_32
+			break;
+		}
+		case 93:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_31
+			PIXEL13_31
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+			}
+			else
+			{
+				PIXEL20_12
+				PIXEL21_0
+				PIXEL30_20
+				PIXEL31_11
+			}
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL22_0
+				PIXEL23_11
+				PIXEL32_12
+				PIXEL33_20
+			}
+			break;
+		}
+		case 206:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL10_10
+				PIXEL11_30
+			}
+			else
+			{
+				PIXEL00_20
+				PIXEL01_12
+				PIXEL10_11
+				PIXEL11_0
+			}
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL12_32
+			PIXEL13_82
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+			}
+			else
+			{
+				PIXEL20_12
+				PIXEL21_0
+				PIXEL30_20
+				PIXEL31_11
+			}
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 205:
+		case 201:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_70
+			PIXEL13_60
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_10
+				PIXEL21_30
+				PIXEL30_80
+				PIXEL31_10
+			}
+			else
+			{
+				PIXEL20_12
+				PIXEL21_0
+				PIXEL30_20
+				PIXEL31_11
+			}
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 174:
+		case 46:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_80
+				PIXEL01_10
+				PIXEL10_10
+				PIXEL11_30
+			}
+			else
+			{
+				PIXEL00_20
+				PIXEL01_12
+				PIXEL10_11
+				PIXEL11_0
+			}
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 179:
+		case 147:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_10
+				PIXEL03_80
+				PIXEL12_30
+				PIXEL13_10
+			}
+			else
+			{
+				PIXEL02_11
+				PIXEL03_20
+				PIXEL12_0
+				PIXEL13_12
+			}
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 117:
+		case 116:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_31
+			PIXEL13_31
+			PIXEL20_82
+			PIXEL21_32
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_30
+				PIXEL23_10
+				PIXEL32_10
+				PIXEL33_80
+			}
+			else
+			{
+				PIXEL22_0
+				PIXEL23_11
+				PIXEL32_12
+				PIXEL33_20
+			}
+			PIXEL30_82
+			PIXEL31_32
+			break;
+		}
+		case 189:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_31
+			PIXEL13_31
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 231:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 126:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_0
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 219:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL11_0
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 125:
+		{
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL00_82
+				PIXEL10_32
+				PIXEL20_0
+				PIXEL21_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL00_11
+				PIXEL10_13
+				PIXEL20_83
+				PIXEL21_70
+				PIXEL30_50
+				PIXEL31_21
+			}
+			PIXEL01_82
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL11_32
+			PIXEL12_31
+			PIXEL13_31
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 221:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_81
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL03_81
+				PIXEL13_31
+				PIXEL22_0
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL03_12
+				PIXEL13_14
+				PIXEL22_70
+				PIXEL23_83
+				PIXEL32_21
+				PIXEL33_50
+			}
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_31
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 207:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL02_32
+				PIXEL03_82
+				PIXEL10_0
+				PIXEL11_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_83
+				PIXEL02_13
+				PIXEL03_11
+				PIXEL10_21
+				PIXEL11_70
+			}
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_31
+			PIXEL23_81
+			PIXEL30_80
+			PIXEL31_10
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 238:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_32
+			PIXEL13_82
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL21_0
+				PIXEL30_0
+				PIXEL31_0
+				PIXEL32_31
+				PIXEL33_81
+			}
+			else
+			{
+				PIXEL20_21
+				PIXEL21_70
+				PIXEL30_50
+				PIXEL31_83
+				PIXEL32_14
+				PIXEL33_12
+			}
+			PIXEL22_31
+			PIXEL23_81
+			break;
+		}
+		case 190:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL12_0
+				PIXEL13_0
+				PIXEL23_32
+				PIXEL33_82
+			}
+			else
+			{
+				PIXEL02_21
+				PIXEL03_50
+				PIXEL12_70
+				PIXEL13_83
+				PIXEL23_13
+				PIXEL33_11
+			}
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_32
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_82
+			break;
+		}
+		case 187:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+				PIXEL11_0
+				PIXEL20_31
+				PIXEL30_81
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_21
+				PIXEL10_83
+				PIXEL11_70
+				PIXEL20_14
+				PIXEL30_12
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL21_31
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL31_81
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 243:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_82
+			PIXEL21_32
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL22_0
+				PIXEL23_0
+				PIXEL30_82
+				PIXEL31_32
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL22_70
+				PIXEL23_21
+				PIXEL30_11
+				PIXEL31_13
+				PIXEL32_83
+				PIXEL33_50
+			}
+			break;
+		}
+		case 119:
+		{
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL00_81
+				PIXEL01_31
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL12_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL00_12
+				PIXEL01_14
+				PIXEL02_83
+				PIXEL03_50
+				PIXEL12_70
+				PIXEL13_21
+			}
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 237:
+		case 233:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_60
+			PIXEL03_20
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_70
+			PIXEL13_60
+			PIXEL20_0
+			PIXEL21_0
+			PIXEL22_31
+			PIXEL23_81
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL30_0
+			}
+			else
+			{
+				PIXEL30_20
+			}
+			PIXEL31_0
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 175:
+		case 47:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+			}
+			else
+			{
+				PIXEL00_20
+			}
+			PIXEL01_0
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_0
+			PIXEL11_0
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_70
+			PIXEL23_60
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_60
+			PIXEL33_20
+			break;
+		}
+		case 183:
+		case 151:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_0
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL03_0
+			}
+			else
+			{
+				PIXEL03_20
+			}
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_0
+			PIXEL13_0
+			PIXEL20_60
+			PIXEL21_70
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_20
+			PIXEL31_60
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 245:
+		case 244:
+		{
+			PIXEL00_20
+			PIXEL01_60
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_60
+			PIXEL11_70
+			PIXEL12_31
+			PIXEL13_31
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_0
+			PIXEL23_0
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL33_20
+			}
+			break;
+		}
+		case 250:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_30
+			PIXEL13_10
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			break;
+		}
+		case 123:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL11_0
+			PIXEL12_30
+			PIXEL13_10
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 95:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL11_0
+			PIXEL12_0
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_80
+			PIXEL31_10
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 222:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_0
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 252:
+		{
+			PIXEL00_80
+			PIXEL01_61
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_31
+			PIXEL13_31
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			PIXEL22_0
+			PIXEL23_0
+			PIXEL32_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL33_20
+			}
+			break;
+		}
+		case 249:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_61
+			PIXEL03_80
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_0
+			PIXEL21_0
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL30_0
+			}
+			else
+			{
+				PIXEL30_20
+			}
+			PIXEL31_0
+			break;
+		}
+		case 235:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL11_0
+			PIXEL12_30
+			PIXEL13_61
+			PIXEL20_0
+			PIXEL21_0
+			PIXEL22_31
+			PIXEL23_81
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL30_0
+			}
+			else
+			{
+				PIXEL30_20
+			}
+			PIXEL31_0
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 111:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+			}
+			else
+			{
+				PIXEL00_20
+			}
+			PIXEL01_0
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_0
+			PIXEL11_0
+			PIXEL12_32
+			PIXEL13_82
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			PIXEL22_30
+			PIXEL23_61
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 63:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+			}
+			else
+			{
+				PIXEL00_20
+			}
+			PIXEL01_0
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL10_0
+			PIXEL11_0
+			PIXEL12_0
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_61
+			PIXEL33_80
+			break;
+		}
+		case 159:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			PIXEL02_0
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL03_0
+			}
+			else
+			{
+				PIXEL03_20
+			}
+			PIXEL11_0
+			PIXEL12_0
+			PIXEL13_0
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_80
+			PIXEL31_61
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 215:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_0
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL03_0
+			}
+			else
+			{
+				PIXEL03_20
+			}
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_0
+			PIXEL13_0
+			PIXEL20_61
+			PIXEL21_30
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 246:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL10_61
+			PIXEL11_30
+			PIXEL12_0
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_0
+			PIXEL23_0
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL33_20
+			}
+			break;
+		}
+		case 254:
+		{
+			PIXEL00_80
+			PIXEL01_10
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL10_10
+			PIXEL11_30
+			PIXEL12_0
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			PIXEL22_0
+			PIXEL23_0
+			PIXEL32_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL33_20
+			}
+			break;
+		}
+		case 253:
+		{
+			PIXEL00_82
+			PIXEL01_82
+			PIXEL02_81
+			PIXEL03_81
+			PIXEL10_32
+			PIXEL11_32
+			PIXEL12_31
+			PIXEL13_31
+			PIXEL20_0
+			PIXEL21_0
+			PIXEL22_0
+			PIXEL23_0
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL30_0
+			}
+			else
+			{
+				PIXEL30_20
+			}
+			PIXEL31_0
+			PIXEL32_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL33_20
+			}
+			break;
+		}
+		case 251:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			PIXEL02_10
+			PIXEL03_80
+			PIXEL11_0
+			PIXEL12_30
+			PIXEL13_10
+			PIXEL20_0
+			PIXEL21_0
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL30_0
+			}
+			else
+			{
+				PIXEL30_20
+			}
+			PIXEL31_0
+			break;
+		}
+		case 239:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+			}
+			else
+			{
+				PIXEL00_20
+			}
+			PIXEL01_0
+			PIXEL02_32
+			PIXEL03_82
+			PIXEL10_0
+			PIXEL11_0
+			PIXEL12_32
+			PIXEL13_82
+			PIXEL20_0
+			PIXEL21_0
+			PIXEL22_31
+			PIXEL23_81
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL30_0
+			}
+			else
+			{
+				PIXEL30_20
+			}
+			PIXEL31_0
+			PIXEL32_31
+			PIXEL33_81
+			break;
+		}
+		case 127:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+			}
+			else
+			{
+				PIXEL00_20
+			}
+			PIXEL01_0
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL02_0
+				PIXEL03_0
+				PIXEL13_0
+			}
+			else
+			{
+				PIXEL02_50
+				PIXEL03_50
+				PIXEL13_50
+			}
+			PIXEL10_0
+			PIXEL11_0
+			PIXEL12_0
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL20_0
+				PIXEL30_0
+				PIXEL31_0
+			}
+			else
+			{
+				PIXEL20_50
+				PIXEL30_50
+				PIXEL31_50
+			}
+			PIXEL21_0
+			PIXEL22_30
+			PIXEL23_10
+			PIXEL32_10
+			PIXEL33_80
+			break;
+		}
+		case 191:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+			}
+			else
+			{
+				PIXEL00_20
+			}
+			PIXEL01_0
+			PIXEL02_0
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL03_0
+			}
+			else
+			{
+				PIXEL03_20
+			}
+			PIXEL10_0
+			PIXEL11_0
+			PIXEL12_0
+			PIXEL13_0
+			PIXEL20_31
+			PIXEL21_31
+			PIXEL22_32
+			PIXEL23_32
+			PIXEL30_81
+			PIXEL31_81
+			PIXEL32_82
+			PIXEL33_82
+			break;
+		}
+		case 223:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+				PIXEL01_0
+				PIXEL10_0
+			}
+			else
+			{
+				PIXEL00_50
+				PIXEL01_50
+				PIXEL10_50
+			}
+			PIXEL02_0
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL03_0
+			}
+			else
+			{
+				PIXEL03_20
+			}
+			PIXEL11_0
+			PIXEL12_0
+			PIXEL13_0
+			PIXEL20_10
+			PIXEL21_30
+			PIXEL22_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL23_0
+				PIXEL32_0
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL23_50
+				PIXEL32_50
+				PIXEL33_50
+			}
+			PIXEL30_80
+			PIXEL31_10
+			break;
+		}
+		case 247:
+		{
+			PIXEL00_81
+			PIXEL01_31
+			PIXEL02_0
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL03_0
+			}
+			else
+			{
+				PIXEL03_20
+			}
+			PIXEL10_81
+			PIXEL11_31
+			PIXEL12_0
+			PIXEL13_0
+			PIXEL20_82
+			PIXEL21_32
+			PIXEL22_0
+			PIXEL23_0
+			PIXEL30_82
+			PIXEL31_32
+			PIXEL32_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL33_20
+			}
+			break;
+		}
+		case 255:
+		{
+			if (hqx_diff(yuv[4], yuv[2]))
+			{
+				PIXEL00_0
+			}
+			else
+			{
+				PIXEL00_20
+			}
+			PIXEL01_0
+			PIXEL02_0
+			if (hqx_diff(yuv[2], yuv[6]))
+			{
+				PIXEL03_0
+			}
+			else
+			{
+				PIXEL03_20
+			}
+			PIXEL10_0
+			PIXEL11_0
+			PIXEL12_0
+			PIXEL13_0
+			PIXEL20_0
+			PIXEL21_0
+			PIXEL22_0
+			PIXEL23_0
+			if (hqx_diff(yuv[8], yuv[4]))
+			{
+				PIXEL30_0
+			}
+			else
+			{
+				PIXEL30_20
+			}
+			PIXEL31_0
+			PIXEL32_0
+			if (hqx_diff(yuv[6], yuv[8]))
+			{
+				PIXEL33_0
+			}
+			else
+			{
+				PIXEL33_20
+			}
+			break;
+		}
+	}
+}
+
+#undef PIXEL00_0
+#undef PIXEL00_11
+#undef PIXEL00_12
+#undef PIXEL00_20
+#undef PIXEL00_50
+#undef PIXEL00_80
+#undef PIXEL00_81
+#undef PIXEL00_82
+#undef PIXEL01_0
+#undef PIXEL01_10
+#undef PIXEL01_12
+#undef PIXEL01_14
+#undef PIXEL01_21
+#undef PIXEL01_31
+#undef PIXEL01_50
+#undef PIXEL01_60
+#undef PIXEL01_61
+#undef PIXEL01_82
+#undef PIXEL01_83
+#undef PIXEL02_0
+#undef PIXEL02_10
+#undef PIXEL02_11
+#undef PIXEL02_13
+#undef PIXEL02_21
+#undef PIXEL02_32
+#undef PIXEL02_50
+#undef PIXEL02_60
+#undef PIXEL02_61
+#undef PIXEL02_81
+#undef PIXEL02_83
+#undef PIXEL03_0
+#undef PIXEL03_11
+#undef PIXEL03_12
+#undef PIXEL03_20
+#undef PIXEL03_50
+#undef PIXEL03_80
+#undef PIXEL03_81
+#undef PIXEL03_82
+#undef PIXEL10_0
+#undef PIXEL10_10
+#undef PIXEL10_11
+#undef PIXEL10_13
+#undef PIXEL10_21
+#undef PIXEL10_32
+#undef PIXEL10_50
+#undef PIXEL10_60
+#undef PIXEL10_61
+#undef PIXEL10_81
+#undef PIXEL10_83
+#undef PIXEL11_0
+#undef PIXEL11_30
+#undef PIXEL11_31
+#undef PIXEL11_32
+#undef PIXEL11_70
+#undef PIXEL12_0
+#undef PIXEL12_30
+#undef PIXEL12_31
+#undef PIXEL12_32
+#undef PIXEL12_70
+#undef PIXEL13_0
+#undef PIXEL13_10
+#undef PIXEL13_12
+#undef PIXEL13_14
+#undef PIXEL13_21
+#undef PIXEL13_31
+#undef PIXEL13_50
+#undef PIXEL13_60
+#undef PIXEL13_61
+#undef PIXEL13_82
+#undef PIXEL13_83
+#undef PIXEL20_0
+#undef PIXEL20_10
+#undef PIXEL20_12
+#undef PIXEL20_14
+#undef PIXEL20_21
+#undef PIXEL20_31
+#undef PIXEL20_50
+#undef PIXEL20_60
+#undef PIXEL20_61
+#undef PIXEL20_82
+#undef PIXEL20_83
+#undef PIXEL21_0
+#undef PIXEL21_30
+#undef PIXEL21_31
+#undef PIXEL21_32
+#undef PIXEL21_70
+#undef PIXEL22_0
+#undef PIXEL22_30
+#undef PIXEL22_31
+#undef PIXEL22_32
+#undef PIXEL22_70
+#undef PIXEL23_0
+#undef PIXEL23_10
+#undef PIXEL23_11
+#undef PIXEL23_13
+#undef PIXEL23_21
+#undef PIXEL23_32
+#undef PIXEL23_50
+#undef PIXEL23_60
+#undef PIXEL23_61
+#undef PIXEL23_81
+#undef PIXEL23_83
+#undef PIXEL30_0
+#undef PIXEL30_11
+#undef PIXEL30_12
+#undef PIXEL30_20
+#undef PIXEL30_50
+#undef PIXEL30_80
+#undef PIXEL30_81
+#undef PIXEL30_82
+#undef PIXEL31_0
+#undef PIXEL31_10
+#undef PIXEL31_11
+#undef PIXEL31_13
+#undef PIXEL31_21
+#undef PIXEL31_32
+#undef PIXEL31_50
+#undef PIXEL31_60
+#undef PIXEL31_61
+#undef PIXEL31_81
+#undef PIXEL31_83
+#undef PIXEL32_0
+#undef PIXEL32_10
+#undef PIXEL32_12
+#undef PIXEL32_14
+#undef PIXEL32_21
+#undef PIXEL32_31
+#undef PIXEL32_50
+#undef PIXEL32_60
+#undef PIXEL32_61
+#undef PIXEL32_82
+#undef PIXEL32_83
+#undef PIXEL33_0
+#undef PIXEL33_11
+#undef PIXEL33_12
+#undef PIXEL33_20
+#undef PIXEL33_50
+#undef PIXEL33_80
+#undef PIXEL33_81
+#undef PIXEL33_82
+
+#endif /* MDP_RENDER_HQ4X_KERNEL_HPP */
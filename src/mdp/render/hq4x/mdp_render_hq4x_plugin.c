@@ -43,7 +43,8 @@ mdp_render_t mdp_render =
 	
 	.scale = 4,
 	.flags = MDP_RENDER_FLAG_RGB_555to555 |
-		 MDP_RENDER_FLAG_RGB_565to565
+		 MDP_RENDER_FLAG_RGB_565to565 |
+		 MDP_RENDER_FLAG_RGB_888to888
 };
 
 static mdp_func_t mdp_func =
@@ -56,11 +57,11 @@ mdp_t mdp =
 {
 	// Plugin version information.
 	.interfaceVersion = MDP_VERSION(1, 0, 0),
-	.pluginVersion = MDP_VERSION(1, 0, 0),
+	.pluginVersion = MDP_VERSION(1, 1, 0),
 	
 	// CPU flags.
-	.cpuFlagsSupported = MDP_CPUFLAG_X86_MMX,
-	.cpuFlagsRequired = MDP_CPUFLAG_X86_MMX,
+	.cpuFlagsSupported = MDP_CPUFLAG_X86_SSE2 | MDP_CPUFLAG_X86_AVX2,
+	.cpuFlagsRequired = 0,
 	
 	// UUID: 5708aebf-d8ab-4e34-80cd-c66fd2b7f2c5
 	.uuid = {0x57, 0x08, 0xAE, 0xBF,
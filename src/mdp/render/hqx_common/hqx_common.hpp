@@ -0,0 +1,537 @@
+/***************************************************************************
+ * MDP: hqNx renderers. (Common functions)                                 *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ * hqNx Copyright (c) 2003 by Maxim Stepin                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU Lesser General Public License as published   *
+ * by the Free Software Foundation; either version 2.1 of the License, or  *
+ * (at your option) any later version.                                     *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef MDP_RENDER_HQX_COMMON_HPP
+#define MDP_RENDER_HQX_COMMON_HPP
+
+// C includes.
+#include <stdlib.h>
+
+// MDP includes.
+#include "mdp/mdp_stdint.h"
+#include "mdp/mdp_cpuflags.h"
+#include "mdp/mdp_error.h"
+#include "mdp/mdp_render.h"
+
+// SIMD intrinsics.
+#include "libgsft/gsft_simd.h"
+
+/**
+ * YUV difference threshold.
+ * Two pixels are different if |Y1-Y2| > 0x30, |U1-U2| > 0x07, or |V1-V2| > 0x06.
+ * YUV values are stored as 0x00YYUUVV.
+ */
+#define HQX_YUV_THRESHOLD	((uint32_t)(0x00300706))
+
+
+/** Pixel formats. **/
+
+/**
+ * hqx_rgb555: 15-bit color.
+ * Interpolation is done on 0x0000GGGGG00RRRRR000GGGGG0BBBBB (G, R, B split apart).
+ */
+struct hqx_rgb555
+{
+	typedef uint16_t pixel;
+
+	static inline uint32_t toYUV(pixel p, const uint32_t *RGB16toYUV)
+	{
+		// Convert to 16-bit color for the lookup table.
+		return RGB16toYUV[((p & 0x7FE0) << 1) | ((p >> 4) & 0x0020) | (p & 0x001F)];
+	}
+
+	static inline pixel mix(pixel c1, unsigned int w1, pixel c2, unsigned int w2,
+				pixel c3, unsigned int w3, int shift)
+	{
+		const uint32_t mask = 0x03E07C1F;
+		const uint32_t e1 = (c1 | ((uint32_t)c1 << 16)) & mask;
+		const uint32_t e2 = (c2 | ((uint32_t)c2 << 16)) & mask;
+		const uint32_t e3 = (c3 | ((uint32_t)c3 << 16)) & mask;
+		const uint32_t ret = ((e1 * w1 + e2 * w2 + e3 * w3) >> shift) & mask;
+		return (pixel)(ret | (ret >> 16));
+	}
+};
+
+/**
+ * hqx_rgb565: 16-bit color.
+ * Interpolation is done on 0x00000GGGGGG0RRRRR00000GGGGGG0BBBBB (G, R, B split apart).
+ */
+struct hqx_rgb565
+{
+	typedef uint16_t pixel;
+
+	static inline uint32_t toYUV(pixel p, const uint32_t *RGB16toYUV)
+	{
+		return RGB16toYUV[p];
+	}
+
+	static inline pixel mix(pixel c1, unsigned int w1, pixel c2, unsigned int w2,
+				pixel c3, unsigned int w3, int shift)
+	{
+		const uint32_t mask = 0x07E0F81F;
+		const uint32_t e1 = (c1 | ((uint32_t)c1 << 16)) & mask;
+		const uint32_t e2 = (c2 | ((uint32_t)c2 << 16)) & mask;
+		const uint32_t e3 = (c3 | ((uint32_t)c3 << 16)) & mask;
+		const uint32_t ret = ((e1 * w1 + e2 * w2 + e3 * w3) >> shift) & mask;
+		return (pixel)(ret | (ret >> 16));
+	}
+};
+
+/**
+ * hqx_rgb888: 32-bit color. (0x00RRGGBB)
+ * Interpolation is done on R/B and G separately.
+ */
+struct hqx_rgb888
+{
+	typedef uint32_t pixel;
+
+	static inline uint32_t toYUV(pixel p, const uint32_t *RGB16toYUV)
+	{
+		((void)RGB16toYUV);
+
+		const int r = (p >> 16) & 0xFF;
+		const int g = (p >> 8) & 0xFF;
+		const int b = p & 0xFF;
+		const int Y = (r + g + b) >> 2;
+		const int u = 128 + ((r - b) >> 2);
+		const int v = 128 + ((-r + 2*g - b) >> 3);
+		return (Y << 16) + (u << 8) + v;
+	}
+
+	static inline pixel mix(pixel c1, unsigned int w1, pixel c2, unsigned int w2,
+				pixel c3, unsigned int w3, int shift)
+	{
+		const uint32_t rb = ((c1 & 0xFF00FF) * w1 + (c2 & 0xFF00FF) * w2 + (c3 & 0xFF00FF) * w3) >> shift;
+		const uint32_t g  = ((c1 & 0x00FF00) * w1 + (c2 & 0x00FF00) * w2 + (c3 & 0x00FF00) * w3) >> shift;
+		return ((rb & 0xFF00FF) | (g & 0x00FF00));
+	}
+};
+
+
+/**
+ * hqx_interp: hqNx interpolation functions.
+ * The weights match Maxim Stepin's original implementation.
+ * @param fmt Pixel format.
+ */
+template<class fmt>
+struct hqx_interp
+{
+	typedef typename fmt::pixel pixel;
+
+	// (c1*3 + c2) / 4
+	static inline pixel Interp1(pixel c1, pixel c2)
+	{
+		if (c1 == c2)
+			return c1;
+		return fmt::mix(c1, 3, c2, 1, 0, 0, 2);
+	}
+
+	// (c1*2 + c2 + c3) / 4
+	static inline pixel Interp2(pixel c1, pixel c2, pixel c3)
+		{ return fmt::mix(c1, 2, c2, 1, c3, 1, 2); }
+
+	// (c1*7 + c2) / 8
+	static inline pixel Interp3(pixel c1, pixel c2)
+		{ return fmt::mix(c1, 7, c2, 1, 0, 0, 3); }
+
+	// (c1*2 + (c2 + c3)*7) / 16
+	static inline pixel Interp4(pixel c1, pixel c2, pixel c3)
+		{ return fmt::mix(c1, 2, c2, 7, c3, 7, 4); }
+
+	// (c1 + c2) / 2
+	static inline pixel Interp5(pixel c1, pixel c2)
+	{
+		if (c1 == c2)
+			return c1;
+		return fmt::mix(c1, 1, c2, 1, 0, 0, 1);
+	}
+
+	// (c1*5 + c2*2 + c3) / 8
+	static inline pixel Interp6(pixel c1, pixel c2, pixel c3)
+		{ return fmt::mix(c1, 5, c2, 2, c3, 1, 3); }
+
+	// (c1*6 + c2 + c3) / 8
+	static inline pixel Interp7(pixel c1, pixel c2, pixel c3)
+		{ return fmt::mix(c1, 6, c2, 1, c3, 1, 3); }
+
+	// (c1*5 + c2*3) / 8
+	static inline pixel Interp8(pixel c1, pixel c2)
+		{ return fmt::mix(c1, 5, c2, 3, 0, 0, 3); }
+
+	// (c1*2 + (c2 + c3)*3) / 8
+	static inline pixel Interp9(pixel c1, pixel c2, pixel c3)
+		{ return fmt::mix(c1, 2, c2, 3, c3, 3, 3); }
+
+	// (c1*14 + c2 + c3) / 16
+	static inline pixel Interp10(pixel c1, pixel c2, pixel c3)
+		{ return fmt::mix(c1, 14, c2, 1, c3, 1, 4); }
+};
+
+
+/**
+ * hqx_diff(): Check if two YUV values are different.
+ * @param yuv1 YUV value 1.
+ * @param yuv2 YUV value 2.
+ * @return Non-zero if the values are different; 0 if they're similar.
+ */
+static inline int hqx_diff(uint32_t yuv1, uint32_t yuv2)
+{
+	if (yuv1 == yuv2)
+		return 0;
+
+	const int dY = abs((int)((yuv1 >> 16) & 0xFF) - (int)((yuv2 >> 16) & 0xFF));
+	const int dU = abs((int)((yuv1 >> 8) & 0xFF) - (int)((yuv2 >> 8) & 0xFF));
+	const int dV = abs((int)(yuv1 & 0xFF) - (int)(yuv2 & 0xFF));
+	return (dY > 0x30 || dU > 0x07 || dV > 0x06);
+}
+
+
+/**
+ * hqx_pattern_cpp(): Calculate the hqNx neighbor patterns for one line. (C++ version)
+ * Each YUV line has one extra pixel on each side, so yuvX[x+1] corresponds to pixel x.
+ * @param pattern	[out] Pattern line. (one byte per pixel)
+ * @param yuvP		YUV values for the previous line.
+ * @param yuvC		YUV values for the current line.
+ * @param yuvN		YUV values for the next line.
+ * @param start		First pixel to process.
+ * @param width		Line width.
+ */
+static inline void hqx_pattern_cpp(uint8_t *pattern,
+				   const uint32_t *yuvP, const uint32_t *yuvC, const uint32_t *yuvN,
+				   int start, int width)
+{
+	for (int x = start; x < width; x++)
+	{
+		const uint32_t c = yuvC[x + 1];
+		unsigned int pat = 0;
+
+		if (hqx_diff(c, yuvP[x]))	pat |= 0x01;
+		if (hqx_diff(c, yuvP[x + 1]))	pat |= 0x02;
+		if (hqx_diff(c, yuvP[x + 2]))	pat |= 0x04;
+		if (hqx_diff(c, yuvC[x]))	pat |= 0x08;
+		if (hqx_diff(c, yuvC[x + 2]))	pat |= 0x10;
+		if (hqx_diff(c, yuvN[x]))	pat |= 0x20;
+		if (hqx_diff(c, yuvN[x + 1]))	pat |= 0x40;
+		if (hqx_diff(c, yuvN[x + 2]))	pat |= 0x80;
+
+		pattern[x] = (uint8_t)pat;
+	}
+}
+
+
+#ifdef GSFT_SIMD_SSE2
+/**
+ * HQX_SSE2_DIFF(): Compare 4 YUV values with 4 neighbors.
+ * Lanes where the neighbor is different get the pattern bit.
+ */
+#define HQX_SSE2_DIFF(pat, c, neighbor, bit) \
+do { \
+	const __m128i n__ = _mm_loadu_si128((const __m128i*)(neighbor)); \
+	const __m128i d__ = _mm_or_si128(_mm_subs_epu8(c, n__), _mm_subs_epu8(n__, c)); \
+	const __m128i same__ = _mm_cmpeq_epi32(_mm_subs_epu8(d__, thresh), zero); \
+	pat = _mm_or_si128(pat, _mm_andnot_si128(same__, _mm_set1_epi32(bit))); \
+} while (0)
+
+/**
+ * hqx_pattern_sse2(): Calculate the hqNx neighbor patterns for one line. (SSE2 version)
+ * Processes 4 pixels at a time.
+ * Parameters are the same as hqx_pattern_cpp().
+ * @return Number of pixels processed.
+ */
+GSFT_TARGET_SSE2
+static int hqx_pattern_sse2(uint8_t *pattern,
+			    const uint32_t *yuvP, const uint32_t *yuvC, const uint32_t *yuvN,
+			    int width)
+{
+	const __m128i thresh = _mm_set1_epi32(HQX_YUV_THRESHOLD);
+	const __m128i zero = _mm_setzero_si128();
+
+	int x;
+	for (x = 0; x <= (width - 4); x += 4)
+	{
+		const __m128i c = _mm_loadu_si128((const __m128i*)&yuvC[x + 1]);
+		__m128i pat = _mm_setzero_si128();
+
+		HQX_SSE2_DIFF(pat, c, &yuvP[x],     0x01);
+		HQX_SSE2_DIFF(pat, c, &yuvP[x + 1], 0x02);
+		HQX_SSE2_DIFF(pat, c, &yuvP[x + 2], 0x04);
+		HQX_SSE2_DIFF(pat, c, &yuvC[x],     0x08);
+		HQX_SSE2_DIFF(pat, c, &yuvC[x + 2], 0x10);
+		HQX_SSE2_DIFF(pat, c, &yuvN[x],     0x20);
+		HQX_SSE2_DIFF(pat, c, &yuvN[x + 1], 0x40);
+		HQX_SSE2_DIFF(pat, c, &yuvN[x + 2], 0x80);
+
+		// Pack the four 32-bit patterns into four bytes.
+		pat = _mm_packs_epi32(pat, pat);
+		pat = _mm_packus_epi16(pat, pat);
+		*(uint32_t*)&pattern[x] = (uint32_t)_mm_cvtsi128_si32(pat);
+	}
+
+	return x;
+}
+#endif /* GSFT_SIMD_SSE2 */
+
+
+#ifdef GSFT_SIMD_AVX2
+/**
+ * HQX_AVX2_DIFF(): Compare 8 YUV values with 8 neighbors.
+ * Lanes where the neighbor is different get the pattern bit.
+ */
+#define HQX_AVX2_DIFF(pat, c, neighbor, bit) \
+do { \
+	const __m256i n__ = _mm256_loadu_si256((const __m256i*)(neighbor)); \
+	const __m256i d__ = _mm256_or_si256(_mm256_subs_epu8(c, n__), _mm256_subs_epu8(n__, c)); \
+	const __m256i same__ = _mm256_cmpeq_epi32(_mm256_subs_epu8(d__, thresh), zero); \
+	pat = _mm256_or_si256(pat, _mm256_andnot_si256(same__, _mm256_set1_epi32(bit))); \
+} while (0)
+
+/**
+ * hqx_pattern_avx2(): Calculate the hqNx neighbor patterns for one line. (AVX2 version)
+ * Processes 8 pixels at a time.
+ * Parameters are the same as hqx_pattern_cpp().
+ * @return Number of pixels processed.
+ */
+GSFT_TARGET_AVX2
+static int hqx_pattern_avx2(uint8_t *pattern,
+			    const uint32_t *yuvP, const uint32_t *yuvC, const uint32_t *yuvN,
+			    int width)
+{
+	const __m256i thresh = _mm256_set1_epi32(HQX_YUV_THRESHOLD);
+	const __m256i zero = _mm256_setzero_si256();
+
+	int x;
+	for (x = 0; x <= (width - 8); x += 8)
+	{
+		const __m256i c = _mm256_loadu_si256((const __m256i*)&yuvC[x + 1]);
+		__m256i pat = _mm256_setzero_si256();
+
+		HQX_AVX2_DIFF(pat, c, &yuvP[x],     0x01);
+		HQX_AVX2_DIFF(pat, c, &yuvP[x + 1], 0x02);
+		HQX_AVX2_DIFF(pat, c, &yuvP[x + 2], 0x04);
+		HQX_AVX2_DIFF(pat, c, &yuvC[x],     0x08);
+		HQX_AVX2_DIFF(pat, c, &yuvC[x + 2], 0x10);
+		HQX_AVX2_DIFF(pat, c, &yuvN[x],     0x20);
+		HQX_AVX2_DIFF(pat, c, &yuvN[x + 1], 0x40);
+		HQX_AVX2_DIFF(pat, c, &yuvN[x + 2], 0x80);
+
+		// Pack the eight 32-bit patterns into eight bytes.
+		// (packs/packus work within each 128-bit lane.)
+		pat = _mm256_packs_epi32(pat, pat);
+		pat = _mm256_packus_epi16(pat, pat);
+		*(uint32_t*)&pattern[x] = (uint32_t)_mm_cvtsi128_si32(_mm256_castsi256_si128(pat));
+		*(uint32_t*)&pattern[x + 4] = (uint32_t)_mm_cvtsi128_si32(_mm256_extracti128_si256(pat, 1));
+	}
+
+	return x;
+}
+#endif /* GSFT_SIMD_AVX2 */
+
+
+/**
+ * hqx_pattern(): Calculate the hqNx neighbor patterns for one line.
+ * Uses the fastest available SIMD version.
+ * Parameters are the same as hqx_pattern_cpp().
+ * @param cpuFlags CPU flags.
+ */
+static inline void hqx_pattern(uint8_t *pattern,
+			       const uint32_t *yuvP, const uint32_t *yuvC, const uint32_t *yuvN,
+			       int width, uint32_t cpuFlags)
+{
+	int x = 0;
+
+#if defined(GSFT_SIMD_AVX2)
+	if (cpuFlags & MDP_CPUFLAG_X86_AVX2)
+		x = hqx_pattern_avx2(pattern, yuvP, yuvC, yuvN, width);
+	else
+#endif
+#if defined(GSFT_SIMD_SSE2_ALWAYS)
+		x = hqx_pattern_sse2(pattern, yuvP, yuvC, yuvN, width);
+#elif defined(GSFT_SIMD_SSE2)
+	if (cpuFlags & MDP_CPUFLAG_X86_SSE2)
+		x = hqx_pattern_sse2(pattern, yuvP, yuvC, yuvN, width);
+#endif
+
+	((void)cpuFlags);
+
+	// Process the remaining pixels.
+	hqx_pattern_cpp(pattern, yuvP, yuvC, yuvN, x, width);
+}
+
+
+/**
+ * T_hqx_yuv_line(): Convert a line to YUV.
+ * The output line has one extra pixel on each side, copied from the edge pixels.
+ * @param yuv		[out] YUV line. (width + 2)
+ * @param src		Source line.
+ * @param width		Line width.
+ * @param RGB16toYUV	RGB16toYUV lookup table. (15/16-bit only)
+ */
+template<class fmt>
+static inline void T_hqx_yuv_line(uint32_t *yuv, const typename fmt::pixel *src,
+				  int width, const uint32_t *RGB16toYUV)
+{
+	for (int x = 0; x < width; x++)
+		yuv[x + 1] = fmt::toYUV(src[x], RGB16toYUV);
+
+	yuv[0] = yuv[1];
+	yuv[width + 1] = yuv[width];
+}
+
+
+/**
+ * T_hqx_render(): hqNx rendering function.
+ * @param fmt		Pixel format.
+ * @param kernel	hqNx kernel. Must have a "scale" constant and a
+ *			"blit<pixel, interp>(dp, dpL, w, yuv, pattern)" function.
+ * @param render_info	Render information.
+ * @param RGB16toYUV	RGB16toYUV lookup table. (15/16-bit only)
+ * @return MDP error code.
+ */
+template<class fmt, class kernel>
+static int T_hqx_render(const mdp_render_info_t *render_info, const uint32_t *RGB16toYUV)
+{
+	typedef typename fmt::pixel pixel;
+
+	const int width = render_info->width;
+	const int height = render_info->height;
+	const int srcPitch = (render_info->srcPitch / sizeof(pixel));
+	const int destPitch = (render_info->destPitch / sizeof(pixel));
+	const pixel *mdScreen = (const pixel*)render_info->mdScreen;
+	pixel *destScreen = (pixel*)render_info->destScreen;
+
+	if (width <= 0 || height <= 0)
+		return MDP_ERR_OK;
+
+	// Allocate the YUV and pattern line buffers.
+	// Three YUV lines are kept: previous, current, and next.
+	const int yuvLineLen = (width + 2);
+	uint32_t *yuvBuf = (uint32_t*)malloc((yuvLineLen * 3 * sizeof(uint32_t)) + width);
+	if (!yuvBuf)
+		return -MDP_ERR_OUT_OF_MEMORY;
+	uint32_t *yuvP = &yuvBuf[0];
+	uint32_t *yuvC = &yuvBuf[yuvLineLen];
+	uint32_t *yuvN = &yuvBuf[yuvLineLen * 2];
+	uint8_t *pattern = (uint8_t*)&yuvBuf[yuvLineLen * 3];
+
+	// First line. The previous line is the same as the current line.
+	T_hqx_yuv_line<fmt>(yuvC, mdScreen, width, RGB16toYUV);
+	for (int x = 0; x < yuvLineLen; x++)
+		yuvP[x] = yuvC[x];
+
+	for (int y = 0; y < height; y++)
+	{
+		const pixel *srcC = &mdScreen[y * srcPitch];
+		const pixel *srcP = (y > 0 ? srcC - srcPitch : srcC);
+		const pixel *srcN = (y < (height - 1) ? srcC + srcPitch : srcC);
+		pixel *dp = &destScreen[y * kernel::scale * destPitch];
+
+		// Convert the next line to YUV.
+		if (y < (height - 1))
+			T_hqx_yuv_line<fmt>(yuvN, srcN, width, RGB16toYUV);
+		else
+		{
+			for (int x = 0; x < yuvLineLen; x++)
+				yuvN[x] = yuvC[x];
+		}
+
+		// Calculate the patterns for this line.
+		hqx_pattern(pattern, yuvP, yuvC, yuvN, width, render_info->cpuFlags);
+
+		for (int x = 0; x < width; x++)
+		{
+			const int xL = (x > 0 ? x - 1 : x);
+			const int xR = (x < (width - 1) ? x + 1 : x);
+
+			pixel w[10];
+			w[1] = srcP[xL]; w[2] = srcP[x]; w[3] = srcP[xR];
+			w[4] = srcC[xL]; w[5] = srcC[x]; w[6] = srcC[xR];
+			w[7] = srcN[xL]; w[8] = srcN[x]; w[9] = srcN[xR];
+
+			uint32_t yuv[10];
+			yuv[1] = yuvP[x]; yuv[2] = yuvP[x + 1]; yuv[3] = yuvP[x + 2];
+			yuv[4] = yuvC[x]; yuv[5] = yuvC[x + 1]; yuv[6] = yuvC[x + 2];
+			yuv[7] = yuvN[x]; yuv[8] = yuvN[x + 1]; yuv[9] = yuvN[x + 2];
+
+			kernel::template blit<pixel, hqx_interp<fmt> >(dp, destPitch, w, yuv, pattern[x]);
+			dp += kernel::scale;
+		}
+
+		// Rotate the YUV lines.
+		uint32_t *tmp = yuvP;
+		yuvP = yuvC;
+		yuvC = yuvN;
+		yuvN = tmp;
+	}
+
+	free(yuvBuf);
+	return MDP_ERR_OK;
+}
+
+
+/**
+ * T_hqx_blit(): hqNx blit function.
+ * Checks the video mode and calls T_hqx_render() with the correct pixel format.
+ * @param kernel	hqNx kernel.
+ * @param render_info	Render information.
+ * @param RGB16toYUV	Pointer to the RGB16toYUV lookup table pointer. (Built if NULL.)
+ * @param build_RGB16toYUV Function to build the RGB16toYUV lookup table.
+ * @return MDP error code.
+ */
+template<class kernel>
+static inline int T_hqx_blit(const mdp_render_info_t *render_info,
+			     uint32_t **RGB16toYUV, uint32_t* (MDP_FNCALL *build_RGB16toYUV)(void))
+{
+	if (!render_info)
+		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
+
+	if (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) !=
+	    MDP_RENDER_VMODE_GET_DST(render_info->vmodeFlags))
+	{
+		// Renderer only supports identical src/dst modes.
+		return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
+	}
+
+	switch (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags))
+	{
+		case MDP_RENDER_VMODE_RGB_555:
+			if (!*RGB16toYUV)
+				*RGB16toYUV = build_RGB16toYUV();
+			if (!*RGB16toYUV)
+				return -MDP_ERR_OUT_OF_MEMORY;
+			return T_hqx_render<hqx_rgb555, kernel>(render_info, *RGB16toYUV);
+
+		case MDP_RENDER_VMODE_RGB_565:
+			if (!*RGB16toYUV)
+				*RGB16toYUV = build_RGB16toYUV();
+			if (!*RGB16toYUV)
+				return -MDP_ERR_OUT_OF_MEMORY;
+			return T_hqx_render<hqx_rgb565, kernel>(render_info, *RGB16toYUV);
+
+		case MDP_RENDER_VMODE_RGB_888:
+			return T_hqx_render<hqx_rgb888, kernel>(render_info, NULL);
+
+		default:
+			// Unsupported video mode.
+			return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
+	}
+}
+
+#endif /* MDP_RENDER_HQX_COMMON_HPP */
@@ -31,18 +31,19 @@
 #include "mdp/mdp_stdint.h"
 #include "mdp/mdp_cpuflags.h"
 #include "mdp/mdp_error.h"
+#include "mdp/mdp_render_dirty.h"
+
+// C++ and SIMD versions.
+#include "../scanline_common/scanline.hpp"
 
 // x86 asm versions.
-#if defined(GENS_X86_ASM)
+#ifdef GENS_X86_ASM
 #include "mdp_render_interpolated_scanline_x86.h"
-#endif /* defined(GENS_X86_ASM) */
+#endif /* GENS_X86_ASM */
 
-// Mask constants.
-#define MASK_DIV2_15 		((uint16_t)(0x3DEF))
-#define MASK_DIV2_16		((uint16_t)(0x7BEF))
+// Mask constants for the x86 asm versions.
 #define MASK_DIV2_15_ASM	((uint32_t)(0x3DEF3DEF))
 #define MASK_DIV2_16_ASM	((uint32_t)(0x7BEF7BEF))
-#define MASK_DIV2_32		((uint32_t)(0x7F7F7F7F))
 
 // MDP Host Services.
 static const mdp_host_t *mdp_render_interpolated_scanline_host_srv = NULL;
@@ -82,68 +83,25 @@ int MDP_FNCALL mdp_render_interpolated_scanline_end(void)
 }
 
 
-//#if !defined(GENS_X86_ASM)
+#ifdef GENS_X86_ASM
 /**
- * T_mdp_render_interpolated_scanline_cpp: Blits the image to the screen, 2x size, interpolation with scanlines.
- * @param destScreen Pointer to the destination screen buffer.
- * @param mdScreen Pointer to the MD screen buffer.
- * @param destPitch Pitch of destScreen.
- * @param srcPitch Pitch of mdScreen.
- * @param width Width of the image.
- * @param height Height of the image.
- * @param mask Mask for the interpolation data.
+ * mdp_render_interpolated_scanline_x86(): Render the image using the x86 asm versions.
+ * @param render_info Render information.
+ * @return True if the image was rendered; false if the video mode isn't supported.
  */
-template<typename pixel>
-static inline void T_mdp_render_interpolated_scanline_cpp(pixel *destScreen, pixel *mdScreen,
-						 int destPitch, int srcPitch,
-						 int width, int height, pixel mask)
+static bool mdp_render_interpolated_scanline_x86(const mdp_render_info_t *render_info)
 {
-	destPitch /= sizeof(pixel);
-	srcPitch /= sizeof(pixel);
+	const uint32_t vmode = MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags);
+	if (vmode != MDP_RENDER_VMODE_GET_DST(render_info->vmodeFlags))
+		return false;
 	
-	for (int y = 0; y < height; y++)
-	{
-		pixel *SrcLine = &mdScreen[y * srcPitch];
-		pixel *DstLine1 = &destScreen[(y * 2) * destPitch];
-		pixel *DstLine2 = &destScreen[((y * 2) + 1) * destPitch];
-		
-		for (int x = 0; x < width; x++)
-		{
-			pixel C = *(SrcLine);
-			pixel R = *(SrcLine + 1);
-			
-			*DstLine1++ = C;
-			*DstLine1++ = ((C >> 1) & mask) + ((R >> 1) & mask);
-			*DstLine2++ = 0;
-			*DstLine2++ = 0;
-			
-			SrcLine++;
-		}
-	}
-}
-//#endif /* !defined(GENS_X86_ASM) */
-
-
-int MDP_FNCALL mdp_render_interpolated_scanline_cpp(const mdp_render_info_t *render_info)
-{
-	if (!render_info)
-		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
-	
-	if (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) !=
-	    MDP_RENDER_VMODE_GET_DST(render_info->vmodeFlags))
-	{
-		// Renderer only supports identical src/dst modes.
-		return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
-	}
-	
-	switch (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags))
+	switch (vmode)
 	{
 		case MDP_RENDER_VMODE_RGB_555:
 		case MDP_RENDER_VMODE_RGB_565:
 		{
-			const int mode565 = ((MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) == MDP_RENDER_VMODE_RGB_565) ? 1 : 0);
+			const int mode565 = (vmode == MDP_RENDER_VMODE_RGB_565 ? 1 : 0);
 			
-#ifdef GENS_X86_ASM
 			if (render_info->cpuFlags & MDP_CPUFLAG_X86_MMX)
 			{
 				mdp_render_interpolated_scanline_16_x86_mmx(
@@ -162,29 +120,44 @@ int MDP_FNCALL mdp_render_interpolated_scanline_cpp(const mdp_render_info_t *ren
 					    render_info->width, render_info->height,
 					    (mode565 ? MASK_DIV2_16_ASM : MASK_DIV2_15_ASM));
 			}
-#else /* !GENS_X86_ASM */
-			T_mdp_render_interpolated_scanline_cpp(
-				    (uint16_t*)render_info->destScreen,
-				    (uint16_t*)render_info->mdScreen,
-				    render_info->destPitch, render_info->srcPitch,
-				    render_info->width, render_info->height,
-				    (mode565 ? MASK_DIV2_16 : MASK_DIV2_15));
-#endif
-			break;
+			return true;
 		}
-		case MDP_RENDER_VMODE_RGB_888:
-			T_mdp_render_interpolated_scanline_cpp(
-				    (uint32_t*)render_info->destScreen,
-				    (uint32_t*)render_info->mdScreen,
-				    render_info->destPitch, render_info->srcPitch,
-				    render_info->width, render_info->height,
-				    MASK_DIV2_32);
-			break;
 		
 		default:
-			// Unsupported video mode.
-			return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
+			return false;
 	}
+}
+#endif /* GENS_X86_ASM */
+
+
+/**
+ * mdp_render_interpolated_scanline_band(): Render a band of the image.
+ * @param render_info Render information.
+ * @return MDP error code.
+ */
+static int MDP_FNCALL mdp_render_interpolated_scanline_band(const mdp_render_info_t *render_info)
+{
+	if (!render_info)
+		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
 	
-	return MDP_ERR_OK;
+#ifdef GENS_X86_ASM
+	// Use the x86 asm versions if SSE2 isn't available.
+	if (!scanline_simd_available(render_info->cpuFlags) &&
+	    mdp_render_interpolated_scanline_x86(render_info))
+	{
+		return MDP_ERR_OK;
+	}
+#endif /* GENS_X86_ASM */
+	
+	return scanline_blit<SCANLINE_BLACK, true>(render_info);
+}
+
+
+int MDP_FNCALL mdp_render_interpolated_scanline_cpp(const mdp_render_info_t *render_info)
+{
+	if (!render_info)
+		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
+	
+	// Only render the lines that changed, or whose next line changed.
+	return mdp_render_dirty_blit(render_info, 2, 1, mdp_render_interpolated_scanline_band);
 }
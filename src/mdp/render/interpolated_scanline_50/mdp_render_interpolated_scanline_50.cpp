@@ -31,13 +31,10 @@
 #include "mdp/mdp_stdint.h"
 #include "mdp/mdp_cpuflags.h"
 #include "mdp/mdp_error.h"
+#include "mdp/mdp_render_dirty.h"
 
-// Mask constants.
-#define MASK_DIV2_15		((uint16_t)(0x3DEF))
-#define MASK_DIV2_16		((uint16_t)(0x7BEF))
-#define MASK_DIV2_32		((uint32_t)(0x7F7F7F7F))
-
-#define BLEND(a, b, mask) ((((a) >> 1) & mask) + (((b) >> 1) & mask))
+// C++ and SIMD versions.
+#include "../scanline_common/scanline.hpp"
 
 // MDP Host Services.
 static const mdp_host_t *mdp_render_interpolated_scanline_50_host_srv = NULL;
@@ -78,46 +75,16 @@ int MDP_FNCALL mdp_render_interpolated_scanline_50_end(void)
 
 
 /**
- * T_mdp_render_interpolated_scanline_50_cpp: Blits the image to the screen, 2x size, interpolation with 50% scanlines.
- * @param destScreen Pointer to the destination screen buffer.
- * @param mdScreen Pointer to the MD screen buffer.
- * @param destPitch Pitch of destScreen.
- * @param srcPitch Pitch of mdScreen.
- * @param width Width of the image.
- * @param height Height of the image.
- * @param mask Mask for the interpolation data.
+ * mdp_render_interpolated_scanline_50_band(): Render a band of the image.
+ * @param render_info Render information.
+ * @return MDP error code.
  */
-template<typename pixel>
-static inline void T_mdp_render_interpolated_scanline_50_cpp(pixel *destScreen, pixel *mdScreen,
-							     int destPitch, int srcPitch,
-							     int width, int height, pixel mask)
+static int MDP_FNCALL mdp_render_interpolated_scanline_50_band(const mdp_render_info_t *render_info)
 {
-	destPitch /= sizeof(pixel);
-	srcPitch /= sizeof(pixel);
+	if (!render_info)
+		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
 	
-	// TODO: Figure out why the interpolation function is using the line
-	// below the source line instead of using the current source line.
-	for (int y = 0; y < height; y++)
-	{
-		pixel *SrcLine = &mdScreen[y * srcPitch];
-		pixel *DstLine1 = &destScreen[(y * 2) * destPitch];
-		pixel *DstLine2 = &destScreen[((y * 2) + 1) * destPitch];
-		
-		for (int x = 0; x < width; x++)
-		{
-			pixel C = *(SrcLine);
-			pixel R = *(SrcLine + 1);
-			pixel D = *(SrcLine + srcPitch);
-			pixel DR = *(SrcLine + srcPitch + 1);
-			
-			*DstLine1++ = C;
-			*DstLine1++ = BLEND(C, R, mask);
-			*DstLine2++ = (BLEND(C, D, mask) >> 1) & mask;
-			*DstLine2++ = ((BLEND(BLEND(C, R, mask), BLEND(D, DR, mask), mask)) >> 1) & mask;
-			
-			SrcLine++;
-		}
-	}
+	return scanline_blit<SCANLINE_50, true>(render_info);
 }
 
 
@@ -126,41 +93,6 @@ int MDP_FNCALL mdp_render_interpolated_scanline_50_cpp(const mdp_render_info_t *
 	if (!render_info)
 		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
 	
-	if (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) !=
-	    MDP_RENDER_VMODE_GET_DST(render_info->vmodeFlags))
-	{
-		// Renderer only supports identical src/dst modes.
-		return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
-	}
-	
-	switch (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags))
-	{
-		case MDP_RENDER_VMODE_RGB_555:
-		case MDP_RENDER_VMODE_RGB_565:
-		{
-			const int mode565 = ((MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) == MDP_RENDER_VMODE_RGB_565) ? 1 : 0);
-			
-			T_mdp_render_interpolated_scanline_50_cpp(
-				    (uint16_t*)render_info->destScreen,
-				    (uint16_t*)render_info->mdScreen,
-				    render_info->destPitch, render_info->srcPitch,
-				    render_info->width, render_info->height,
-				    (mode565 ? MASK_DIV2_16 : MASK_DIV2_15));
-			break;
-		}
-		case MDP_RENDER_VMODE_RGB_888:
-			T_mdp_render_interpolated_scanline_50_cpp(
-				    (uint32_t*)render_info->destScreen,
-				    (uint32_t*)render_info->mdScreen,
-				    render_info->destPitch, render_info->srcPitch,
-				    render_info->width, render_info->height,
-				    MASK_DIV2_32);
-			break;
-		
-		default:
-			// Unsupported video mode.
-			return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
-	}
-	
-	return MDP_ERR_OK;
+	// Only render the lines that changed, or whose next line changed.
+	return mdp_render_dirty_blit(render_info, 2, 1, mdp_render_interpolated_scanline_50_band);
 }
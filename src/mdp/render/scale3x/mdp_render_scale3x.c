@@ -26,6 +26,7 @@
 
 // Scale3x frontend.
 #include "scalebit_3x.h"
+#include "scalebit_3x_simd.h"
 
 // MDP includes.
 #include "mdp/mdp_cpuflags.h"
@@ -83,6 +84,15 @@ int MDP_FNCALL mdp_render_scale3x_cpp(const mdp_render_info_t *render_info)
 	
 	const unsigned int bytespp = ((MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) == MDP_RENDER_VMODE_RGB_888) ? 4 : 2);
 	
+	// Use the SSE2/AVX2 version if it's available.
+	if (!scale3x_simd(render_info->destScreen, render_info->destPitch,
+			  render_info->mdScreen, render_info->srcPitch,
+			  bytespp, render_info->width, render_info->height,
+			  render_info->cpuFlags))
+	{
+		return MDP_ERR_OK;
+	}
+	
 	scale3x(render_info->destScreen, render_info->destPitch,
 		render_info->mdScreen, render_info->srcPitch,
 		bytespp, render_info->width, render_info->height);
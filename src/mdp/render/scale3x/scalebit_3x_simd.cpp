@@ -0,0 +1,35 @@
+/***************************************************************************
+ * MDP: Scale3x renderer. (SIMD version)                                   *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ * Scale2x Copyright (c) 2001 by Andrea Mazzoleni                          *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "scalebit_3x_simd.h"
+
+// Scale2x/Scale3x/Scale4x SIMD kernels.
+#include "../scalex_common/scalex_simd.hpp"
+
+int MDP_FNCALL scale3x_simd(void* void_dst, unsigned int dst_slice,
+			     const void* void_src, unsigned int src_slice,
+			     unsigned int pixel, unsigned int width, unsigned int height,
+			     uint32_t cpuFlags)
+{
+	if (pixel == 4)
+		return scalex_simd<3, uint32_t>(void_dst, dst_slice, void_src, src_slice, width, height, cpuFlags);
+	return scalex_simd<3, uint16_t>(void_dst, dst_slice, void_src, src_slice, width, height, cpuFlags);
+}
@@ -1,15 +1,13 @@
 /***************************************************************************
- * MDP: hq2x renderer. (x86 asm function prototypes)                       *
+ * MDP: Scale3x renderer. (SIMD version)                                   *
  *                                                                         *
- * Copyright (c) 1999-2002 by Stéphane Dallongeville                       *
- * Copyright (c) 2003-2004 by Stéphane Akhoun                              *
- * Copyright (c) 2008-2009 by David Korth                                  *
- * hq2x Copyright (c) 2003 by Maxim Stepin                                 *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ * Scale2x Copyright (c) 2001 by Andrea Mazzoleni                          *
  *                                                                         *
  * This program is free software; you can redistribute it and/or modify it *
- * under the terms of the GNU Lesser General Public License as published   *
- * by the Free Software Foundation; either version 2.1 of the License, or  *
- * (at your option) any later version.                                     *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
  *                                                                         *
  * This program is distributed in the hope that it will be useful, but     *
  * WITHOUT ANY WARRANTY; without even the implied warranty of              *
@@ -21,8 +19,8 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
  ***************************************************************************/
 
-#ifndef MDP_RENDER_HQ2X_X86_H
-#define MDP_RENDER_HQ2X_X86_H
+#ifndef MDP_RENDER_SCALE3X_SCALEBIT_3X_SIMD_H
+#define MDP_RENDER_SCALE3X_SCALEBIT_3X_SIMD_H
 
 #include "mdp/mdp_stdint.h"
 #include "mdp/mdp_fncall.h"
@@ -31,13 +29,20 @@
 extern "C" {
 #endif
 
-DLL_LOCAL void MDP_FNCALL mdp_render_hq2x_16_x86_mmx(
-				uint16_t *destScreen, uint16_t *mdScreen,
-				int destPitch, int srcPitch,
-				int width, int height, uint32_t vmodeFlags);
+/**
+ * scale3x_simd(): Scale3x an image using SSE2 or AVX2.
+ * Parameters are the same as scale3x().
+ * @param cpuFlags CPU flags.
+ * @return 0 on success; non-zero if no SIMD version is available for this CPU.
+ */
+DLL_LOCAL int MDP_FNCALL scale3x_simd(
+				void* void_dst, unsigned int dst_slice,
+				const void* void_src, unsigned int src_slice,
+				unsigned int pixel, unsigned int width, unsigned int height,
+				uint32_t cpuFlags);
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif /* MDP_RENDER_HQ2X_X86_H */
+#endif /* MDP_RENDER_SCALE3X_SCALEBIT_3X_SIMD_H */
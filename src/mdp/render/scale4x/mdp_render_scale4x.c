@@ -30,6 +30,7 @@
 
 // Scale4x frontend.
 #include "scalebit_4x.h"
+#include "scalebit_4x_simd.h"
 
 // Scale4x MMX frontend.
 #if defined(GENS_X86_ASM) && defined(__GNUC__) && defined(__i386__)
@@ -91,6 +92,15 @@ int MDP_FNCALL mdp_render_scale4x_cpp(const mdp_render_info_t *render_info)
 	
 	const unsigned int bytespp = ((MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) == MDP_RENDER_VMODE_RGB_888) ? 4 : 2);
 	
+	// Use the SSE2/AVX2 version if it's available.
+	if (!scale4x_simd(render_info->destScreen, render_info->destPitch,
+			  render_info->mdScreen, render_info->srcPitch,
+			  bytespp, render_info->width, render_info->height,
+			  render_info->cpuFlags))
+	{
+		return MDP_ERR_OK;
+	}
+	
 #if defined(GENS_X86_ASM) && defined(__GNUC__) && defined(__i386__)
 	if (render_info->cpuFlags & MDP_CPUFLAG_X86_MMX)
 	{
@@ -0,0 +1,48 @@
+/***************************************************************************
+ * MDP: Scale4x renderer. (SIMD version)                                   *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ * Scale2x Copyright (c) 2001 by Andrea Mazzoleni                          *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef MDP_RENDER_SCALE4X_SCALEBIT_4X_SIMD_H
+#define MDP_RENDER_SCALE4X_SCALEBIT_4X_SIMD_H
+
+#include "mdp/mdp_stdint.h"
+#include "mdp/mdp_fncall.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * scale4x_simd(): Scale4x an image using SSE2 or AVX2.
+ * Parameters are the same as scale4x().
+ * @param cpuFlags CPU flags.
+ * @return 0 on success; non-zero if no SIMD version is available for this CPU.
+ */
+DLL_LOCAL int MDP_FNCALL scale4x_simd(
+				void* void_dst, unsigned int dst_slice,
+				const void* void_src, unsigned int src_slice,
+				unsigned int pixel, unsigned int width, unsigned int height,
+				uint32_t cpuFlags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MDP_RENDER_SCALE4X_SCALEBIT_4X_SIMD_H */
@@ -0,0 +1,650 @@
+/***************************************************************************
+ * MDP: Scale2x/Scale3x/Scale4x/EPX/EPX+ renderers. (SIMD versions)        *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ * Scale2x Copyright (c) 2001 by Andrea Mazzoleni                          *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef MDP_RENDER_SCALEX_SIMD_HPP
+#define MDP_RENDER_SCALEX_SIMD_HPP
+
+// C includes.
+#include <string.h>
+
+// MDP includes.
+#include "mdp/mdp_stdint.h"
+#include "mdp/mdp_cpuflags.h"
+
+// SIMD intrinsics.
+#include "libgsft/gsft_simd.h"
+
+/**
+ * Output is identical to scale2x.c and scale3x.c.
+ * Scale4x is Scale2x applied twice, but it's done in a single pass
+ * without an intermediate buffer.
+ *
+ * Pixel map used by the Scale2x/Scale3x rules:
+ *
+ *	A B C
+ *	D E F
+ *	G H I
+ *
+ * Pixels outside of the image are clamped to the nearest edge pixel.
+ *
+ * EPX and EPX+ use the same neighbor tests as Scale2x,
+ * so they share the vector operations.
+ */
+
+
+/** Scalar versions. Used for the image edges. **/
+
+/**
+ * scalex_2x_rule(): Scale2x rule for one pixel.
+ * @param e0 [out] Top-left pixel.
+ * @param e1 [out] Top-right pixel.
+ * @param e2 [out] Bottom-left pixel.
+ * @param e3 [out] Bottom-right pixel.
+ */
+template<typename pixel>
+static inline void scalex_2x_rule(pixel B, pixel D, pixel E, pixel F, pixel H,
+				  pixel &e0, pixel &e1, pixel &e2, pixel &e3)
+{
+	if (B != H && D != F)
+	{
+		e0 = (D == B ? B : E);
+		e1 = (F == B ? B : E);
+		e2 = (D == H ? H : E);
+		e3 = (F == H ? H : E);
+	}
+	else
+	{
+		e0 = e1 = e2 = e3 = E;
+	}
+}
+
+/**
+ * scalex_2x_px(): Scale2x one source pixel.
+ * @param dst0 First destination row.
+ * @param dst1 Second destination row.
+ * @param src0 Previous source row.
+ * @param src1 Current source row.
+ * @param src2 Next source row.
+ * @param x Source pixel.
+ * @param width Width of the source rows.
+ */
+template<typename pixel>
+static inline void scalex_2x_px(pixel *dst0, pixel *dst1,
+				const pixel *src0, const pixel *src1, const pixel *src2,
+				int x, int width)
+{
+	const int xl = (x > 0 ? x - 1 : x);
+	const int xr = (x < (width - 1) ? x + 1 : x);
+	scalex_2x_rule(src0[x], src1[xl], src1[x], src1[xr], src2[x],
+		       dst0[x*2], dst0[x*2 + 1], dst1[x*2], dst1[x*2 + 1]);
+}
+
+/**
+ * scalex_3x_px(): Scale3x one source pixel.
+ * @param dst0 First destination row.
+ * @param dst1 Second destination row.
+ * @param dst2 Third destination row.
+ * @param src0 Previous source row.
+ * @param src1 Current source row.
+ * @param src2 Next source row.
+ * @param x Source pixel.
+ * @param width Width of the source rows.
+ */
+template<typename pixel>
+static inline void scalex_3x_px(pixel *dst0, pixel *dst1, pixel *dst2,
+				const pixel *src0, const pixel *src1, const pixel *src2,
+				int x, int width)
+{
+	const int xl = (x > 0 ? x - 1 : x);
+	const int xr = (x < (width - 1) ? x + 1 : x);
+	const pixel A = src0[xl], B = src0[x], C = src0[xr];
+	const pixel D = src1[xl], E = src1[x], F = src1[xr];
+	const pixel G = src2[xl], H = src2[x], I = src2[xr];
+
+	dst0 += x*3; dst1 += x*3; dst2 += x*3;
+	if (B != H && D != F)
+	{
+		dst0[0] = (D == B ? D : E);
+		dst0[1] = ((D == B && E != C) || (F == B && E != A) ? B : E);
+		dst0[2] = (F == B ? F : E);
+		dst1[0] = ((D == B && E != G) || (D == H && E != A) ? D : E);
+		dst1[1] = E;
+		dst1[2] = ((F == B && E != I) || (F == H && E != C) ? F : E);
+		dst2[0] = (D == H ? D : E);
+		dst2[1] = ((D == H && E != I) || (F == H && E != G) ? H : E);
+		dst2[2] = (F == H ? F : E);
+	}
+	else
+	{
+		dst0[0] = dst0[1] = dst0[2] = E;
+		dst1[0] = dst1[1] = dst1[2] = E;
+		dst2[0] = dst2[1] = dst2[2] = E;
+	}
+}
+
+/**
+ * scalex_mid_px(): Get a pixel from the first Scale2x pass of Scale4x.
+ * @param mid Source rows for the Scale2x row. (previous, current, next)
+ * The rows are swapped for the bottom half of a Scale2x pixel.
+ * @param mx Pixel in the Scale2x row. (clamped)
+ * @param width Width of the source rows.
+ * @return Scale2x pixel.
+ */
+template<typename pixel>
+static inline pixel scalex_mid_px(const pixel *const *mid, int mx, int width)
+{
+	if (mx < 0)
+		mx = 0;
+	else if (mx >= width*2)
+		mx = width*2 - 1;
+
+	const int x = (mx >> 1);
+	const int xl = (x > 0 ? x - 1 : x);
+	const int xr = (x < (width - 1) ? x + 1 : x);
+	const pixel B = mid[0][x], D = mid[1][xl], E = mid[1][x], F = mid[1][xr], H = mid[2][x];
+
+	if (B == H || D == F)
+		return E;
+	if (mx & 1)
+		return (F == B ? B : E);
+	return (D == B ? B : E);
+}
+
+/**
+ * scalex_4x_px(): Scale4x one source pixel.
+ * @param dst Destination rows. (4)
+ * @param mid Source rows for the four Scale2x rows. (4x3)
+ * @param x Source pixel.
+ * @param width Width of the source rows.
+ */
+template<typename pixel>
+static inline void scalex_4x_px(pixel *const *dst, const pixel *const mid[4][3], int x, int width)
+{
+	for (int row = 0; row < 2; row++)
+	{
+		for (int mx = x*2; mx < (x*2 + 2); mx++)
+		{
+			const pixel B = scalex_mid_px(mid[row], mx, width);
+			const pixel D = scalex_mid_px(mid[row + 1], mx - 1, width);
+			const pixel E = scalex_mid_px(mid[row + 1], mx, width);
+			const pixel F = scalex_mid_px(mid[row + 1], mx + 1, width);
+			const pixel H = scalex_mid_px(mid[row + 2], mx, width);
+
+			scalex_2x_rule(B, D, E, F, H,
+				       dst[row*2][mx*2], dst[row*2][mx*2 + 1],
+				       dst[row*2 + 1][mx*2], dst[row*2 + 1][mx*2 + 1]);
+		}
+	}
+}
+
+
+/**
+ * EPX is Scale2x without clamping: the pixels around the image are read
+ * from memory. EPX+ also reads the pixels two rows above and below,
+ * and two pixels to the left and right.
+ */
+
+/**
+ * scalex_epx_px(): EPX one source pixel.
+ * @param dst0 First destination row.
+ * @param dst1 Second destination row.
+ * @param src Source row.
+ * @param pitch Source pitch, in pixels.
+ * @param x Source pixel.
+ */
+template<typename pixel>
+static inline void scalex_epx_px(pixel *dst0, pixel *dst1,
+				 const pixel *src, int pitch, int x)
+{
+	const pixel *s = &src[x];
+	scalex_2x_rule(s[-pitch], s[-1], s[0], s[1], s[pitch],
+		       dst0[x*2], dst0[x*2 + 1], dst1[x*2], dst1[x*2 + 1]);
+}
+
+/**
+ * scalex_blend(): Average two pixels.
+ * @param mask Pixel bits, after shifting right by 1.
+ */
+template<typename pixel>
+static inline pixel scalex_blend(pixel a, pixel b, pixel mask)
+{
+	return (((a >> 1) & mask) + ((b >> 1) & mask));
+}
+
+/**
+ * scalex_epx_plus_rule(): EPX+ rule for one output pixel.
+ * The parameters are named for the top-left output pixel.
+ * The other output pixels use the same rule, mirrored:
+ * - Top-right: swap L/R, LL/RR, and use UL and DR.
+ * - Bottom-left: swap U/D, UU/DD, and use DR and UL.
+ * - Bottom-right: swap both, and use DL and UR.
+ */
+template<typename pixel>
+static inline pixel scalex_epx_plus_rule(pixel C, pixel U, pixel UU, pixel D, pixel DD,
+					 pixel L, pixel LL, pixel R, pixel RR,
+					 pixel UR, pixel DL, pixel mask)
+{
+	if (L != R && U != D && U == L && (UR == R || DL == D || R != RR || D != DD))
+		return ((UR == DL && (L == LL || U == UU)) ? scalex_blend(C, U, mask) : U);
+	return ((L == U && C == UR && L != C && L == D) ? scalex_blend(C, L, mask) : C);
+}
+
+/**
+ * scalex_epx_plus_px(): EPX+ one source pixel.
+ * @param dst0 First destination row.
+ * @param dst1 Second destination row.
+ * @param src Source row.
+ * @param pitch Source pitch, in pixels.
+ * @param x Source pixel.
+ * @param mask Pixel bits, after shifting right by 1.
+ */
+template<typename pixel>
+static inline void scalex_epx_plus_px(pixel *dst0, pixel *dst1,
+				      const pixel *src, int pitch, int x, pixel mask)
+{
+	const pixel *s = &src[x];
+	const pixel UL = s[-pitch - 1], U = s[-pitch], UR = s[-pitch + 1];
+	const pixel LL = s[-2], L = s[-1], C = s[0], R = s[1], RR = s[2];
+	const pixel DL = s[pitch - 1], D = s[pitch], DR = s[pitch + 1];
+
+	// UU and DD are only used if L != R and U != D.
+	pixel UU = U, DD = D;
+	if (L != R && U != D)
+	{
+		UU = s[-(pitch * 2)];
+		DD = s[pitch * 2];
+	}
+
+	dst0[x*2]     = scalex_epx_plus_rule(C, U, UU, D, DD, L, LL, R, RR, UR, DL, mask);
+	dst0[x*2 + 1] = scalex_epx_plus_rule(C, U, UU, D, DD, R, RR, L, LL, UL, DR, mask);
+	dst1[x*2]     = scalex_epx_plus_rule(C, D, DD, U, UU, L, LL, R, RR, DR, UL, mask);
+	dst1[x*2 + 1] = scalex_epx_plus_rule(C, D, DD, U, UU, R, RR, L, LL, DL, UR, mask);
+}
+
+
+/** SIMD versions. **/
+
+#if defined(GSFT_SIMD_SSE2)
+GSFT_SIMD_BEGIN_SSE2
+namespace scalex_sse2
+{
+	typedef __m128i vec;
+
+	static inline vec vload(const void *p)		{ return _mm_loadu_si128((const __m128i*)p); }
+	static inline void vstore(void *p, vec v)	{ _mm_storeu_si128((__m128i*)p, v); }
+	static inline vec vand(vec a, vec b)		{ return _mm_and_si128(a, b); }
+	static inline vec vor(vec a, vec b)		{ return _mm_or_si128(a, b); }
+	static inline vec vandnot(vec a, vec b)		{ return _mm_andnot_si128(a, b); }
+	static inline vec vsel(vec mask, vec a, vec b)
+		{ return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b)); }
+
+	/**
+	 * ops: Pixel size-specific operations.
+	 * blend() averages two pixels, using a mask of the pixel bits after shifting right by 1.
+	 * zip() interleaves pixels; zip2() interleaves pairs of pixels.
+	 * store3() interleaves three vectors and stores them.
+	 */
+	template<typename pixel> struct ops;
+
+	template<> struct ops<uint16_t>
+	{
+		enum { N = 8 };
+		static inline vec eq(vec a, vec b) { return _mm_cmpeq_epi16(a, b); }
+		static inline vec set1(uint16_t n) { return _mm_set1_epi16((short)n); }
+		static inline vec blend(vec a, vec b, vec mask)
+			{ return _mm_add_epi16(vand(_mm_srli_epi16(a, 1), mask), vand(_mm_srli_epi16(b, 1), mask)); }
+		static inline void zip(vec a, vec b, vec &lo, vec &hi)
+			{ lo = _mm_unpacklo_epi16(a, b); hi = _mm_unpackhi_epi16(a, b); }
+		static inline void zip2(vec a, vec b, vec &lo, vec &hi)
+			{ lo = _mm_unpacklo_epi32(a, b); hi = _mm_unpackhi_epi32(a, b); }
+
+		static inline void store3(uint16_t *dst, vec a, vec b, vec c)
+		{
+			// SSE2 doesn't have a byte shuffle, so this is done
+			// using 64-bit stores of pixel triplets.
+			uint16_t t[3][N];
+			vstore(t[0], a);
+			vstore(t[1], b);
+			vstore(t[2], c);
+
+			for (int i = 0; i < N; i += 4, dst += 12)
+			{
+				const uint64_t p0 = t[0][i], p1 = t[1][i], p2 = t[2][i], p3 = t[0][i+1];
+				const uint64_t p4 = t[1][i+1], p5 = t[2][i+1], p6 = t[0][i+2], p7 = t[1][i+2];
+				const uint64_t p8 = t[2][i+2], p9 = t[0][i+3], pA = t[1][i+3], pB = t[2][i+3];
+				// NOTE: Pixels are stored in little-endian order.
+				// dst may not be 64-bit aligned, so copy through memcpy().
+				const uint64_t q[3] =
+				{
+					p0 | (p1 << 16) | (p2 << 32) | (p3 << 48),
+					p4 | (p5 << 16) | (p6 << 32) | (p7 << 48),
+					p8 | (p9 << 16) | (pA << 32) | (pB << 48),
+				};
+				memcpy(dst, q, sizeof(q));
+			}
+		}
+	};
+
+	template<> struct ops<uint32_t>
+	{
+		enum { N = 4 };
+		static inline vec eq(vec a, vec b) { return _mm_cmpeq_epi32(a, b); }
+		static inline vec set1(uint32_t n) { return _mm_set1_epi32((int)n); }
+		static inline vec blend(vec a, vec b, vec mask)
+			{ return _mm_add_epi32(vand(_mm_srli_epi32(a, 1), mask), vand(_mm_srli_epi32(b, 1), mask)); }
+		static inline void zip(vec a, vec b, vec &lo, vec &hi)
+			{ lo = _mm_unpacklo_epi32(a, b); hi = _mm_unpackhi_epi32(a, b); }
+		static inline void zip2(vec a, vec b, vec &lo, vec &hi)
+			{ lo = _mm_unpacklo_epi64(a, b); hi = _mm_unpackhi_epi64(a, b); }
+
+		static inline void store3(uint32_t *dst, vec a, vec b, vec c)
+		{
+			const __m128 ab_lo = _mm_castsi128_ps(_mm_unpacklo_epi32(a, b));	// a0 b0 a1 b1
+			const __m128 ab_hi = _mm_castsi128_ps(_mm_unpackhi_epi32(a, b));	// a2 b2 a3 b3
+			const __m128 bc_lo = _mm_castsi128_ps(_mm_unpacklo_epi32(b, c));	// b0 c0 b1 c1
+			const __m128 bc_hi = _mm_castsi128_ps(_mm_unpackhi_epi32(b, c));	// b2 c2 b3 c3
+			const __m128 ca_lo = _mm_castsi128_ps(_mm_unpacklo_epi32(c, a));	// c0 a0 c1 a1
+			const __m128 ca_hi = _mm_castsi128_ps(_mm_unpackhi_epi32(c, a));	// c2 a2 c3 a3
+
+			vstore(dst,     _mm_castps_si128(_mm_shuffle_ps(ab_lo, ca_lo, _MM_SHUFFLE(3, 0, 1, 0))));
+			vstore(dst + 4, _mm_castps_si128(_mm_shuffle_ps(bc_lo, ab_hi, _MM_SHUFFLE(1, 0, 3, 2))));
+			vstore(dst + 8, _mm_castps_si128(_mm_shuffle_ps(ca_hi, bc_hi, _MM_SHUFFLE(3, 2, 3, 0))));
+		}
+	};
+
+#include "scalex_simd_kernel.hpp"
+}
+GSFT_SIMD_END
+#endif /* GSFT_SIMD_SSE2 */
+
+#if defined(GSFT_SIMD_AVX2)
+GSFT_SIMD_BEGIN_AVX2
+namespace scalex_avx2
+{
+	typedef __m256i vec;
+
+	static inline vec vload(const void *p)		{ return _mm256_loadu_si256((const __m256i*)p); }
+	static inline void vstore(void *p, vec v)	{ _mm256_storeu_si256((__m256i*)p, v); }
+	static inline vec vand(vec a, vec b)		{ return _mm256_and_si256(a, b); }
+	static inline vec vor(vec a, vec b)		{ return _mm256_or_si256(a, b); }
+	static inline vec vandnot(vec a, vec b)		{ return _mm256_andnot_si256(a, b); }
+	static inline vec vsel(vec mask, vec a, vec b)	{ return _mm256_blendv_epi8(b, a, mask); }
+
+	/**
+	 * AVX2 unpack instructions work within 128-bit lanes.
+	 * Swap the middle lanes to get the results in order.
+	 */
+	static inline void vfixlanes(vec &lo, vec &hi)
+	{
+		const vec t = lo;
+		lo = _mm256_permute2x128_si256(t, hi, 0x20);
+		hi = _mm256_permute2x128_si256(t, hi, 0x31);
+	}
+
+	/**
+	 * ops: Pixel size-specific operations.
+	 * blend() averages two pixels, using a mask of the pixel bits after shifting right by 1.
+	 * zip() interleaves pixels; zip2() interleaves pairs of pixels.
+	 * store3() interleaves three vectors and stores them.
+	 */
+	template<typename pixel> struct ops;
+
+	template<> struct ops<uint16_t>
+	{
+		enum { N = 16 };
+		static inline vec eq(vec a, vec b) { return _mm256_cmpeq_epi16(a, b); }
+		static inline vec set1(uint16_t n) { return _mm256_set1_epi16((short)n); }
+		static inline vec blend(vec a, vec b, vec mask)
+			{ return _mm256_add_epi16(vand(_mm256_srli_epi16(a, 1), mask), vand(_mm256_srli_epi16(b, 1), mask)); }
+		static inline void zip(vec a, vec b, vec &lo, vec &hi)
+		{
+			lo = _mm256_unpacklo_epi16(a, b); hi = _mm256_unpackhi_epi16(a, b);
+			vfixlanes(lo, hi);
+		}
+		static inline void zip2(vec a, vec b, vec &lo, vec &hi)
+		{
+			lo = _mm256_unpacklo_epi32(a, b); hi = _mm256_unpackhi_epi32(a, b);
+			vfixlanes(lo, hi);
+		}
+
+		static inline void store3(uint16_t *dst, vec a, vec b, vec c)
+		{
+			// Byte shuffles for each 128-bit output vector.
+			// Each output vector gets 8 pixels from the input vectors.
+			static const uint8_t shuf[3][3][16] __attribute__ ((aligned (16))) =
+			{
+				{{0,1,0x80,0x80,0x80,0x80,2,3,0x80,0x80,0x80,0x80,4,5,0x80,0x80},
+				 {0x80,0x80,0,1,0x80,0x80,0x80,0x80,2,3,0x80,0x80,0x80,0x80,4,5},
+				 {0x80,0x80,0x80,0x80,0,1,0x80,0x80,0x80,0x80,2,3,0x80,0x80,0x80,0x80}},
+				{{0x80,0x80,6,7,0x80,0x80,0x80,0x80,8,9,0x80,0x80,0x80,0x80,10,11},
+				 {0x80,0x80,0x80,0x80,6,7,0x80,0x80,0x80,0x80,8,9,0x80,0x80,0x80,0x80},
+				 {4,5,0x80,0x80,0x80,0x80,6,7,0x80,0x80,0x80,0x80,8,9,0x80,0x80}},
+				{{0x80,0x80,0x80,0x80,12,13,0x80,0x80,0x80,0x80,14,15,0x80,0x80,0x80,0x80},
+				 {10,11,0x80,0x80,0x80,0x80,12,13,0x80,0x80,0x80,0x80,14,15,0x80,0x80},
+				 {0x80,0x80,10,11,0x80,0x80,0x80,0x80,12,13,0x80,0x80,0x80,0x80,14,15}},
+			};
+
+			const __m128i in[2][3] =
+			{
+				{_mm256_castsi256_si128(a), _mm256_castsi256_si128(b), _mm256_castsi256_si128(c)},
+				{_mm256_extracti128_si256(a, 1), _mm256_extracti128_si256(b, 1), _mm256_extracti128_si256(c, 1)},
+			};
+
+			for (int half = 0; half < 2; half++)
+			{
+				for (int i = 0; i < 3; i++, dst += 8)
+				{
+					const __m128i out = _mm_or_si128(
+						_mm_or_si128(
+							_mm_shuffle_epi8(in[half][0], _mm_load_si128((const __m128i*)shuf[i][0])),
+							_mm_shuffle_epi8(in[half][1], _mm_load_si128((const __m128i*)shuf[i][1]))),
+						_mm_shuffle_epi8(in[half][2], _mm_load_si128((const __m128i*)shuf[i][2])));
+					_mm_storeu_si128((__m128i*)dst, out);
+				}
+			}
+		}
+	};
+
+	template<> struct ops<uint32_t>
+	{
+		enum { N = 8 };
+		static inline vec eq(vec a, vec b) { return _mm256_cmpeq_epi32(a, b); }
+		static inline vec set1(uint32_t n) { return _mm256_set1_epi32((int)n); }
+		static inline vec blend(vec a, vec b, vec mask)
+			{ return _mm256_add_epi32(vand(_mm256_srli_epi32(a, 1), mask), vand(_mm256_srli_epi32(b, 1), mask)); }
+		static inline void zip(vec a, vec b, vec &lo, vec &hi)
+		{
+			lo = _mm256_unpacklo_epi32(a, b); hi = _mm256_unpackhi_epi32(a, b);
+			vfixlanes(lo, hi);
+		}
+		static inline void zip2(vec a, vec b, vec &lo, vec &hi)
+		{
+			lo = _mm256_unpacklo_epi64(a, b); hi = _mm256_unpackhi_epi64(a, b);
+			vfixlanes(lo, hi);
+		}
+
+		static inline void store3(uint32_t *dst, vec a, vec b, vec c)
+		{
+			// Output pixels: a0 b0 c0 a1 b1 c1 a2 b2 | c2 a3 b3 c3 a4 b4 c4 a5 | b5 c5 a6 b6 c6 a7 b7 c7
+			// Unused indexes are 0; they're masked out by the blends.
+			const vec a0 = _mm256_permutevar8x32_epi32(a, _mm256_setr_epi32(0,0,0,1,0,0,2,0));
+			const vec b0 = _mm256_permutevar8x32_epi32(b, _mm256_setr_epi32(0,0,0,0,1,0,0,2));
+			const vec c0 = _mm256_permutevar8x32_epi32(c, _mm256_setr_epi32(0,0,0,0,0,1,0,0));
+			const vec a1 = _mm256_permutevar8x32_epi32(a, _mm256_setr_epi32(0,3,0,0,4,0,0,5));
+			const vec b1 = _mm256_permutevar8x32_epi32(b, _mm256_setr_epi32(0,0,3,0,0,4,0,0));
+			const vec c1 = _mm256_permutevar8x32_epi32(c, _mm256_setr_epi32(2,0,0,3,0,0,4,0));
+			const vec a2 = _mm256_permutevar8x32_epi32(a, _mm256_setr_epi32(0,0,6,0,0,7,0,0));
+			const vec b2 = _mm256_permutevar8x32_epi32(b, _mm256_setr_epi32(5,0,0,6,0,0,7,0));
+			const vec c2 = _mm256_permutevar8x32_epi32(c, _mm256_setr_epi32(0,5,0,0,6,0,0,7));
+
+			// Blend masks: bit n selects the second operand for element n.
+			vstore(dst,      _mm256_blend_epi32(_mm256_blend_epi32(a0, b0, 0x92), c0, 0x24));
+			vstore(dst + 8,  _mm256_blend_epi32(_mm256_blend_epi32(a1, b1, 0x24), c1, 0x49));
+			vstore(dst + 16, _mm256_blend_epi32(_mm256_blend_epi32(a2, b2, 0x49), c2, 0x92));
+		}
+	};
+
+#include "scalex_simd_kernel.hpp"
+}
+GSFT_SIMD_END
+#endif /* GSFT_SIMD_AVX2 */
+
+
+/**
+ * scalex_simd(): Render an image using the fastest available SIMD version.
+ * @param scale Scaling factor. (2, 3, 4)
+ * @param pixel Pixel type. (uint16_t, uint32_t)
+ * @param dst Destination image.
+ * @param dst_slice Destination pitch, in bytes.
+ * @param src Source image.
+ * @param src_slice Source pitch, in bytes.
+ * @param width Source width.
+ * @param height Source height.
+ * @param cpuFlags CPU flags.
+ * @return 0 on success; non-zero if no SIMD version is available.
+ */
+template<int scale, typename pixel>
+static inline int scalex_simd(void *dst, unsigned int dst_slice,
+			      const void *src, unsigned int src_slice,
+			      unsigned int width, unsigned int height,
+			      uint32_t cpuFlags)
+{
+#if defined(GSFT_SIMD_AVX2)
+	if (cpuFlags & MDP_CPUFLAG_X86_AVX2)
+	{
+		scalex_avx2::scalex_frame<scale, pixel>::render(
+				(uint8_t*)dst, dst_slice, (const uint8_t*)src, src_slice, width, height);
+		return 0;
+	}
+#endif
+#if defined(GSFT_SIMD_SSE2)
+#if !defined(GSFT_SIMD_SSE2_ALWAYS)
+	if (cpuFlags & MDP_CPUFLAG_X86_SSE2)
+#endif
+	{
+		scalex_sse2::scalex_frame<scale, pixel>::render(
+				(uint8_t*)dst, dst_slice, (const uint8_t*)src, src_slice, width, height);
+		return 0;
+	}
+#endif
+
+	// No SIMD version is available.
+	((void)dst); ((void)dst_slice);
+	((void)src); ((void)src_slice);
+	((void)width); ((void)height);
+	((void)cpuFlags);
+	return 1;
+}
+
+
+/**
+ * scalex_epx_simd(): Render an image with EPX using the fastest available SIMD version.
+ * @param pixel Pixel type. (uint16_t, uint32_t)
+ * @param dst Destination image.
+ * @param dst_slice Destination pitch, in bytes.
+ * @param src Source image.
+ * @param src_slice Source pitch, in bytes.
+ * @param width Source width.
+ * @param height Source height.
+ * @param cpuFlags CPU flags.
+ * @return 0 on success; non-zero if no SIMD version is available.
+ */
+template<typename pixel>
+static inline int scalex_epx_simd(void *dst, unsigned int dst_slice,
+				  const void *src, unsigned int src_slice,
+				  unsigned int width, unsigned int height,
+				  uint32_t cpuFlags)
+{
+#if defined(GSFT_SIMD_AVX2)
+	if (cpuFlags & MDP_CPUFLAG_X86_AVX2)
+	{
+		scalex_avx2::scalex_epx_frame<pixel>(
+				(uint8_t*)dst, dst_slice, (const uint8_t*)src, src_slice, width, height);
+		return 0;
+	}
+#endif
+#if defined(GSFT_SIMD_SSE2)
+#if !defined(GSFT_SIMD_SSE2_ALWAYS)
+	if (cpuFlags & MDP_CPUFLAG_X86_SSE2)
+#endif
+	{
+		scalex_sse2::scalex_epx_frame<pixel>(
+				(uint8_t*)dst, dst_slice, (const uint8_t*)src, src_slice, width, height);
+		return 0;
+	}
+#endif
+
+	// No SIMD version is available.
+	((void)dst); ((void)dst_slice);
+	((void)src); ((void)src_slice);
+	((void)width); ((void)height);
+	((void)cpuFlags);
+	return 1;
+}
+
+
+/**
+ * scalex_epx_plus_simd(): Render an image with EPX+ using the fastest available SIMD version.
+ * @param pixel Pixel type. (uint16_t, uint32_t)
+ * @param dst Destination image.
+ * @param dst_slice Destination pitch, in bytes.
+ * @param src Source image.
+ * @param src_slice Source pitch, in bytes.
+ * @param width Source width.
+ * @param height Source height.
+ * @param mask Pixel bits, after shifting right by 1.
+ * @param cpuFlags CPU flags.
+ * @return 0 on success; non-zero if no SIMD version is available.
+ */
+template<typename pixel>
+static inline int scalex_epx_plus_simd(void *dst, unsigned int dst_slice,
+				       const void *src, unsigned int src_slice,
+				       unsigned int width, unsigned int height,
+				       pixel mask, uint32_t cpuFlags)
+{
+#if defined(GSFT_SIMD_AVX2)
+	if (cpuFlags & MDP_CPUFLAG_X86_AVX2)
+	{
+		scalex_avx2::scalex_epx_plus_frame<pixel>(
+				(uint8_t*)dst, dst_slice, (const uint8_t*)src, src_slice, width, height, mask);
+		return 0;
+	}
+#endif
+#if defined(GSFT_SIMD_SSE2)
+#if !defined(GSFT_SIMD_SSE2_ALWAYS)
+	if (cpuFlags & MDP_CPUFLAG_X86_SSE2)
+#endif
+	{
+		scalex_sse2::scalex_epx_plus_frame<pixel>(
+				(uint8_t*)dst, dst_slice, (const uint8_t*)src, src_slice, width, height, mask);
+		return 0;
+	}
+#endif
+
+	// No SIMD version is available.
+	((void)dst); ((void)dst_slice);
+	((void)src); ((void)src_slice);
+	((void)width); ((void)height);
+	((void)mask); ((void)cpuFlags);
+	return 1;
+}
+
+#endif /* MDP_RENDER_SCALEX_SIMD_HPP */
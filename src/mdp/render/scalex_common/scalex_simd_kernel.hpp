@@ -0,0 +1,456 @@
+/***************************************************************************
+ * MDP: Scale2x/Scale3x/Scale4x/EPX/EPX+ renderers. (SIMD kernels)         *
+ *                                                                         *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ * Scale2x Copyright (c) 2001 by Andrea Mazzoleni                          *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * This file is included once for each instruction set by scalex_simd.hpp.
+ * There are no include guards.
+ *
+ * Required definitions:
+ * - vec: Vector type.
+ * - vload(), vstore(), vand(), vor(), vandnot(), vsel(): Vector operations.
+ * - ops<pixel>: Pixel size-specific vector operations. (eq, set1, blend, zip, zip2, store3)
+ */
+
+/**
+ * scalex_2x_rule_vec(): Scale2x rule for one vector of pixels.
+ * Same as scalex_2x_rule().
+ */
+template<typename pixel>
+static inline void scalex_2x_rule_vec(vec B, vec D, vec E, vec F, vec H,
+				      vec &e0, vec &e1, vec &e2, vec &e3)
+{
+	typedef ops<pixel> op;
+	const vec same = vor(op::eq(B, H), op::eq(D, F));
+
+	e0 = vsel(vandnot(same, op::eq(D, B)), B, E);
+	e1 = vsel(vandnot(same, op::eq(F, B)), B, E);
+	e2 = vsel(vandnot(same, op::eq(D, H)), H, E);
+	e3 = vsel(vandnot(same, op::eq(F, H)), H, E);
+}
+
+/**
+ * scalex_store2(): Interleave two vectors and store them.
+ * @param dst Destination.
+ * @param a Even pixels.
+ * @param b Odd pixels.
+ */
+template<typename pixel>
+static inline void scalex_store2(pixel *dst, vec a, vec b)
+{
+	typedef ops<pixel> op;
+	vec lo, hi;
+	op::zip(a, b, lo, hi);
+	vstore(dst, lo);
+	vstore(dst + op::N, hi);
+}
+
+/**
+ * scalex_store4(): Interleave four vectors and store them.
+ * @param dst Destination.
+ * @param a Pixels 0, 4, 8, ...
+ * @param b Pixels 1, 5, 9, ...
+ * @param c Pixels 2, 6, 10, ...
+ * @param d Pixels 3, 7, 11, ...
+ */
+template<typename pixel>
+static inline void scalex_store4(pixel *dst, vec a, vec b, vec c, vec d)
+{
+	typedef ops<pixel> op;
+	vec ab_lo, ab_hi, cd_lo, cd_hi, lo, hi;
+	op::zip(a, b, ab_lo, ab_hi);
+	op::zip(c, d, cd_lo, cd_hi);
+
+	op::zip2(ab_lo, cd_lo, lo, hi);
+	vstore(dst, lo);
+	vstore(dst + op::N, hi);
+	op::zip2(ab_hi, cd_hi, lo, hi);
+	vstore(dst + op::N*2, lo);
+	vstore(dst + op::N*3, hi);
+}
+
+
+/**
+ * scalex_2x_line(): Scale2x one source row.
+ * Parameters are the same as scalex_2x_px(), minus x.
+ */
+template<typename pixel>
+static void scalex_2x_line(pixel *dst0, pixel *dst1,
+			   const pixel *src0, const pixel *src1, const pixel *src2,
+			   int width)
+{
+	typedef ops<pixel> op;
+
+	// The first and last pixels are clamped, so they use the scalar version.
+	scalex_2x_px(dst0, dst1, src0, src1, src2, 0, width);
+
+	int x;
+	for (x = 1; (x + op::N) < width; x += op::N)
+	{
+		vec e0, e1, e2, e3;
+		scalex_2x_rule_vec<pixel>(vload(&src0[x]),
+				vload(&src1[x - 1]), vload(&src1[x]), vload(&src1[x + 1]),
+				vload(&src2[x]), e0, e1, e2, e3);
+
+		scalex_store2(&dst0[x*2], e0, e1);
+		scalex_store2(&dst1[x*2], e2, e3);
+	}
+
+	for (; x < width; x++)
+		scalex_2x_px(dst0, dst1, src0, src1, src2, x, width);
+}
+
+
+/**
+ * scalex_3x_line(): Scale3x one source row.
+ * Parameters are the same as scalex_3x_px(), minus x.
+ */
+template<typename pixel>
+static void scalex_3x_line(pixel *dst0, pixel *dst1, pixel *dst2,
+			   const pixel *src0, const pixel *src1, const pixel *src2,
+			   int width)
+{
+	typedef ops<pixel> op;
+
+	// The first and last pixels are clamped, so they use the scalar version.
+	scalex_3x_px(dst0, dst1, dst2, src0, src1, src2, 0, width);
+
+	int x;
+	for (x = 1; (x + op::N) < width; x += op::N)
+	{
+		const vec A = vload(&src0[x - 1]), B = vload(&src0[x]), C = vload(&src0[x + 1]);
+		const vec D = vload(&src1[x - 1]), E = vload(&src1[x]), F = vload(&src1[x + 1]);
+		const vec G = vload(&src2[x - 1]), H = vload(&src2[x]), I = vload(&src2[x + 1]);
+
+		const vec same = vor(op::eq(B, H), op::eq(D, F));
+		const vec DB = vandnot(same, op::eq(D, B));
+		const vec FB = vandnot(same, op::eq(F, B));
+		const vec DH = vandnot(same, op::eq(D, H));
+		const vec FH = vandnot(same, op::eq(F, H));
+		const vec EA = op::eq(E, A), EC = op::eq(E, C);
+		const vec EG = op::eq(E, G), EI = op::eq(E, I);
+
+		ops<pixel>::store3(&dst0[x*3],
+			vsel(DB, D, E),
+			vsel(vor(vandnot(EC, DB), vandnot(EA, FB)), B, E),
+			vsel(FB, F, E));
+		ops<pixel>::store3(&dst1[x*3],
+			vsel(vor(vandnot(EG, DB), vandnot(EA, DH)), D, E),
+			E,
+			vsel(vor(vandnot(EI, FB), vandnot(EC, FH)), F, E));
+		ops<pixel>::store3(&dst2[x*3],
+			vsel(DH, D, E),
+			vsel(vor(vandnot(EI, DH), vandnot(EG, FH)), H, E),
+			vsel(FH, F, E));
+	}
+
+	for (; x < width; x++)
+		scalex_3x_px(dst0, dst1, dst2, src0, src1, src2, x, width);
+}
+
+
+/**
+ * scalex_mid_vec(): Get a vector of pixel pairs from the first Scale2x pass of Scale4x.
+ * @param mid Source rows for the Scale2x row.
+ * @param x First source pixel.
+ * @param e0 [out] Even Scale2x pixels.
+ * @param e1 [out] Odd Scale2x pixels.
+ */
+template<typename pixel>
+static inline void scalex_mid_vec(const pixel *const *mid, int x, vec &e0, vec &e1)
+{
+	vec e2, e3;
+	scalex_2x_rule_vec<pixel>(vload(&mid[0][x]),
+			vload(&mid[1][x - 1]), vload(&mid[1][x]), vload(&mid[1][x + 1]),
+			vload(&mid[2][x]), e0, e1, e2, e3);
+}
+
+/**
+ * scalex_4x_line(): Scale4x one source row.
+ * The intermediate Scale2x rows are calculated in registers.
+ * Parameters are the same as scalex_4x_px(), minus x.
+ */
+template<typename pixel>
+static void scalex_4x_line(pixel *const *dst, const pixel *const mid[4][3], int width)
+{
+	typedef ops<pixel> op;
+
+	// The first two pixels and the last pixels are clamped,
+	// so they use the scalar version.
+	int x;
+	for (x = 0; x < 2 && x < width; x++)
+		scalex_4x_px(dst, mid, x, width);
+
+	for (; (x + op::N + 2) <= width; x += op::N)
+	{
+		// Scale2x pixels for this vector.
+		// Me: even pixels (2x); Mo: odd pixels (2x+1)
+		// MoL: odd pixels to the left (2x-1); MeR: even pixels to the right (2x+2)
+		vec Me[4], Mo[4], MoL[4], MeR[4], unused;
+		for (int i = 0; i < 4; i++)
+		{
+			scalex_mid_vec<pixel>(mid[i], x, Me[i], Mo[i]);
+			scalex_mid_vec<pixel>(mid[i], x - 1, unused, MoL[i]);
+			scalex_mid_vec<pixel>(mid[i], x + 1, MeR[i], unused);
+		}
+
+		for (int row = 0; row < 2; row++)
+		{
+			const int c = row + 1;
+			vec ee0, ee1, ee2, ee3;
+			vec eo0, eo1, eo2, eo3;
+			scalex_2x_rule_vec<pixel>(Me[c - 1], MoL[c], Me[c], Mo[c], Me[c + 1], ee0, ee1, ee2, ee3);
+			scalex_2x_rule_vec<pixel>(Mo[c - 1], Me[c], Mo[c], MeR[c], Mo[c + 1], eo0, eo1, eo2, eo3);
+
+			scalex_store4(&dst[row*2][x*4], ee0, ee1, eo0, eo1);
+			scalex_store4(&dst[row*2 + 1][x*4], ee2, ee3, eo2, eo3);
+		}
+	}
+
+	for (; x < width; x++)
+		scalex_4x_px(dst, mid, x, width);
+}
+
+
+/**
+ * scalex_frame: Render an image.
+ * @param scale Scaling factor. (2, 3, 4)
+ * @param pixel Pixel type.
+ */
+template<int scale, typename pixel> struct scalex_frame;
+
+template<typename pixel>
+struct scalex_frame<2, pixel>
+{
+	static void render(uint8_t *dst, unsigned int dst_slice,
+			   const uint8_t *src, unsigned int src_slice,
+			   unsigned int width, unsigned int height)
+	{
+		for (unsigned int y = 0; y < height; y++)
+		{
+			const pixel *src0 = (const pixel*)(src + ((y > 0 ? y - 1 : y) * src_slice));
+			const pixel *src1 = (const pixel*)(src + (y * src_slice));
+			const pixel *src2 = (const pixel*)(src + ((y < (height - 1) ? y + 1 : y) * src_slice));
+			pixel *dst0 = (pixel*)(dst + (y * 2 * dst_slice));
+			pixel *dst1 = (pixel*)(dst + ((y * 2 + 1) * dst_slice));
+
+			scalex_2x_line(dst0, dst1, src0, src1, src2, (int)width);
+		}
+	}
+};
+
+template<typename pixel>
+struct scalex_frame<3, pixel>
+{
+	static void render(uint8_t *dst, unsigned int dst_slice,
+			   const uint8_t *src, unsigned int src_slice,
+			   unsigned int width, unsigned int height)
+	{
+		for (unsigned int y = 0; y < height; y++)
+		{
+			const pixel *src0 = (const pixel*)(src + ((y > 0 ? y - 1 : y) * src_slice));
+			const pixel *src1 = (const pixel*)(src + (y * src_slice));
+			const pixel *src2 = (const pixel*)(src + ((y < (height - 1) ? y + 1 : y) * src_slice));
+			pixel *dst0 = (pixel*)(dst + (y * 3 * dst_slice));
+			pixel *dst1 = (pixel*)(dst + ((y * 3 + 1) * dst_slice));
+			pixel *dst2 = (pixel*)(dst + ((y * 3 + 2) * dst_slice));
+
+			scalex_3x_line(dst0, dst1, dst2, src0, src1, src2, (int)width);
+		}
+	}
+};
+
+template<typename pixel>
+struct scalex_frame<4, pixel>
+{
+	static void render(uint8_t *dst, unsigned int dst_slice,
+			   const uint8_t *src, unsigned int src_slice,
+			   unsigned int width, unsigned int height)
+	{
+		const int mid_height = (int)height * 2;
+
+		for (int y = 0; y < (int)height; y++)
+		{
+			// Source rows for Scale2x rows 2y-1 through 2y+2.
+			const pixel *mid[4][3];
+			for (int i = 0; i < 4; i++)
+			{
+				int my = (y * 2) - 1 + i;
+				if (my < 0)
+					my = 0;
+				else if (my >= mid_height)
+					my = mid_height - 1;
+
+				const int sy = (my >> 1);
+				const pixel *prev = (const pixel*)(src + ((sy > 0 ? sy - 1 : sy) * src_slice));
+				const pixel *next = (const pixel*)(src + ((sy < ((int)height - 1) ? sy + 1 : sy) * src_slice));
+
+				// Bottom half of a Scale2x pixel: swap the previous and next rows.
+				mid[i][0] = ((my & 1) ? next : prev);
+				mid[i][1] = (const pixel*)(src + (sy * src_slice));
+				mid[i][2] = ((my & 1) ? prev : next);
+			}
+
+			pixel *dstRows[4];
+			for (int i = 0; i < 4; i++)
+				dstRows[i] = (pixel*)(dst + ((y * 4 + i) * dst_slice));
+
+			scalex_4x_line(dstRows, mid, (int)width);
+		}
+	}
+};
+
+
+/**
+ * scalex_epx_line(): EPX one source row.
+ * Parameters are the same as scalex_epx_px(), minus x.
+ * @param width Width of the source row.
+ */
+template<typename pixel>
+static void scalex_epx_line(pixel *dst0, pixel *dst1, const pixel *src, int pitch, int width)
+{
+	typedef ops<pixel> op;
+
+	int x;
+	for (x = 0; (x + op::N) <= width; x += op::N)
+	{
+		vec e0, e1, e2, e3;
+		scalex_2x_rule_vec<pixel>(vload(&src[x - pitch]),
+				vload(&src[x - 1]), vload(&src[x]), vload(&src[x + 1]),
+				vload(&src[x + pitch]), e0, e1, e2, e3);
+
+		scalex_store2(&dst0[x*2], e0, e1);
+		scalex_store2(&dst1[x*2], e2, e3);
+	}
+
+	for (; x < width; x++)
+		scalex_epx_px(dst0, dst1, src, pitch, x);
+}
+
+/**
+ * scalex_epx_frame(): EPX an image.
+ * The source image must have one readable pixel around each edge.
+ */
+template<typename pixel>
+static void scalex_epx_frame(uint8_t *dst, unsigned int dst_slice,
+			     const uint8_t *src, unsigned int src_slice,
+			     unsigned int width, unsigned int height)
+{
+	const int pitch = (int)(src_slice / sizeof(pixel));
+	for (unsigned int y = 0; y < height; y++)
+	{
+		const pixel *srcLine = (const pixel*)(src + (y * src_slice));
+		pixel *dst0 = (pixel*)(dst + (y * 2 * dst_slice));
+		pixel *dst1 = (pixel*)(dst + ((y * 2 + 1) * dst_slice));
+
+		scalex_epx_line(dst0, dst1, srcLine, pitch, (int)width);
+	}
+}
+
+
+/**
+ * scalex_epx_plus_rule_vec(): EPX+ rule for one vector of pixels.
+ * Same as scalex_epx_plus_rule().
+ */
+template<typename pixel>
+static inline vec scalex_epx_plus_rule_vec(vec C, vec U, vec UU, vec D, vec DD,
+					   vec L, vec LL, vec R, vec RR,
+					   vec UR, vec DL, vec mask)
+{
+	typedef ops<pixel> op;
+	const vec eqLU = op::eq(L, U);
+
+	// L != R && U != D && U == L && (UR == R || DL == D || R != RR || D != DD)
+	const vec corner = vandnot(vor(op::eq(L, R), op::eq(U, D)),
+			vandnot(vand(op::eq(R, RR), vandnot(op::eq(UR, R), vandnot(op::eq(DL, D), op::eq(D, DD)))), eqLU));
+	// UR == DL && (L == LL || U == UU)
+	const vec blendU = vand(op::eq(UR, DL), vor(op::eq(L, LL), op::eq(U, UU)));
+	// L == U && C == UR && L != C && L == D
+	const vec blendL = vandnot(op::eq(L, C), vand(vand(eqLU, op::eq(C, UR)), op::eq(L, D)));
+
+	return vsel(corner,
+		    vsel(blendU, op::blend(C, U, mask), U),
+		    vsel(blendL, op::blend(C, L, mask), C));
+}
+
+/**
+ * scalex_epx_plus_line(): EPX+ one source row.
+ * Parameters are the same as scalex_epx_plus_px(), minus x.
+ * @param width Width of the source row.
+ */
+template<typename pixel>
+static void scalex_epx_plus_line(pixel *dst0, pixel *dst1, const pixel *src,
+				 int pitch, int width, pixel mask)
+{
+	typedef ops<pixel> op;
+	const vec vmask = op::set1(mask);
+
+	int x;
+	for (x = 0; (x + op::N) <= width; x += op::N)
+	{
+		const pixel *s = &src[x];
+		const vec UL = vload(&s[-pitch - 1]), U = vload(&s[-pitch]), UR = vload(&s[-pitch + 1]);
+		const vec LL = vload(&s[-2]), L = vload(&s[-1]), C = vload(&s[0]);
+		const vec R = vload(&s[1]), RR = vload(&s[2]);
+		const vec DL = vload(&s[pitch - 1]), D = vload(&s[pitch]), DR = vload(&s[pitch + 1]);
+		const vec UU = vload(&s[-(pitch * 2)]), DD = vload(&s[pitch * 2]);
+
+		scalex_store2(&dst0[x*2],
+			scalex_epx_plus_rule_vec<pixel>(C, U, UU, D, DD, L, LL, R, RR, UR, DL, vmask),
+			scalex_epx_plus_rule_vec<pixel>(C, U, UU, D, DD, R, RR, L, LL, UL, DR, vmask));
+		scalex_store2(&dst1[x*2],
+			scalex_epx_plus_rule_vec<pixel>(C, D, DD, U, UU, L, LL, R, RR, DR, UL, vmask),
+			scalex_epx_plus_rule_vec<pixel>(C, D, DD, U, UU, R, RR, L, LL, DL, UR, vmask));
+	}
+
+	for (; x < width; x++)
+		scalex_epx_plus_px(dst0, dst1, src, pitch, x, mask);
+}
+
+/**
+ * scalex_epx_plus_frame(): EPX+ an image.
+ * The source image must have two readable pixels around each edge.
+ * The vector version always reads two rows above and below,
+ * so the first and last two rows use the scalar version,
+ * which only reads them if needed.
+ */
+template<typename pixel>
+static void scalex_epx_plus_frame(uint8_t *dst, unsigned int dst_slice,
+				  const uint8_t *src, unsigned int src_slice,
+				  unsigned int width, unsigned int height, pixel mask)
+{
+	const int pitch = (int)(src_slice / sizeof(pixel));
+	for (unsigned int y = 0; y < height; y++)
+	{
+		const pixel *srcLine = (const pixel*)(src + (y * src_slice));
+		pixel *dst0 = (pixel*)(dst + (y * 2 * dst_slice));
+		pixel *dst1 = (pixel*)(dst + ((y * 2 + 1) * dst_slice));
+
+		if (y < 2 || (y + 2) >= height)
+		{
+			for (int x = 0; x < (int)width; x++)
+				scalex_epx_plus_px(dst0, dst1, srcLine, pitch, x, mask);
+		}
+		else
+		{
+			scalex_epx_plus_line(dst0, dst1, srcLine, pitch, (int)width, mask);
+		}
+	}
+}
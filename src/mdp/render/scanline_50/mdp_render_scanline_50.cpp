@@ -31,18 +31,19 @@
 #include "mdp/mdp_stdint.h"
 #include "mdp/mdp_cpuflags.h"
 #include "mdp/mdp_error.h"
+#include "mdp/mdp_render_dirty.h"
+
+// C++ and SIMD versions.
+#include "../scanline_common/scanline.hpp"
 
 // x86 asm versions.
 #ifdef GENS_X86_ASM
 #include "mdp_render_scanline_50_x86.h"
 #endif /* GENS_X86_ASM */
 
-// Mask constants.
-#define MASK_DIV2_15		((uint16_t)(0x3DEF))
-#define MASK_DIV2_16		((uint16_t)(0x7BEF))
+// Mask constants for the x86 asm versions.
 #define MASK_DIV2_15_ASM	((uint32_t)(0x3DEF3DEF))
 #define MASK_DIV2_16_ASM	((uint32_t)(0x7BEF7BEF))
-#define MASK_DIV2_32		((uint32_t)(0x7F7F7F7F))
 
 // MDP Host Services.
 static const mdp_host_t *mdp_render_scanline_50_host_srv = NULL;
@@ -82,75 +83,25 @@ int MDP_FNCALL mdp_render_scanline_50_end(void)
 }
 
 
-#ifndef GENS_X86_ASM
+#ifdef GENS_X86_ASM
 /**
- * T_mdp_render_scanline_50_cpp: Blits the image to the screen, 2x size, 50% scanlines.
- * @param screen Pointer to the screen buffer.
- * @param mdScreen Pointer to the MD screen buffer.
- * @param destPitch Pitch of destScreen.
- * @param srcPitch Pitch of mdScreen.
- * @param width Width of the image.
- * @param height Height of the image.
- * @param mask Mask for the scanline data.
+ * mdp_render_scanline_50_x86(): Render the image using the x86 asm versions.
+ * @param render_info Render information.
+ * @return True if the image was rendered; false if the video mode isn't supported.
  */
-template<typename pixel>
-static inline void T_mdp_render_scanline_50_cpp(pixel *destScreen, pixel *mdScreen,
-					     int destPitch, int srcPitch,
-					     int width, int height, pixel mask)
-{
-	// Pitch difference.
-	destPitch /= sizeof(pixel);
-	int nextLine = destPitch + (destPitch - (width * 2));
-	
-	srcPitch /= sizeof(pixel);
-	
-	pixel *line1 = destScreen;
-	pixel *line2 = destScreen + destPitch;
-	for (int y = 0; y < height; y++)
-	{
-		for (int x = 0; x < width; x++)
-		{
-			pixel tmp = *mdScreen++;
-			
-			// First line.
-			*line1++ = tmp;
-			*line1++ = tmp;
-			
-			// Second line. (50% Scanline effect)
-			tmp = (tmp >> 1) & mask;
-			*line2++ = tmp;
-			*line2++ = tmp;
-		}
-		
-		// Next line.
-		mdScreen += (srcPitch - width);
-		line1 += nextLine;
-		line2 += nextLine;
-	}
-}
-#endif /* GENS_X86_ASM */
-
-
-int MDP_FNCALL mdp_render_scanline_50_cpp(const mdp_render_info_t *render_info)
+static bool mdp_render_scanline_50_x86(const mdp_render_info_t *render_info)
 {
-	if (!render_info)
-		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
+	const uint32_t vmode = MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags);
+	if (vmode != MDP_RENDER_VMODE_GET_DST(render_info->vmodeFlags))
+		return false;
 	
-	if (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) !=
-	    MDP_RENDER_VMODE_GET_DST(render_info->vmodeFlags))
-	{
-		// Renderer only supports identical src/dst modes.
-		return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
-	}
-	
-	switch (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags))
+	switch (vmode)
 	{
 		case MDP_RENDER_VMODE_RGB_555:
 		case MDP_RENDER_VMODE_RGB_565:
 		{
-			const int mode565 = ((MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) == MDP_RENDER_VMODE_RGB_565) ? 1 : 0);
+			const int mode565 = (vmode == MDP_RENDER_VMODE_RGB_565 ? 1 : 0);
 			
-#ifdef GENS_X86_ASM
 			if (render_info->cpuFlags & MDP_CPUFLAG_X86_MMX)
 			{
 				mdp_render_scanline_50_16_x86_mmx(
@@ -169,18 +120,10 @@ int MDP_FNCALL mdp_render_scanline_50_cpp(const mdp_render_info_t *render_info)
 					    render_info->width, render_info->height,
 					    (mode565 ? MASK_DIV2_16_ASM : MASK_DIV2_15_ASM));
 			}
-#else /* !GENS_X86_ASM */
-			T_mdp_render_scanline_50_cpp(
-				    (uint16_t*)render_info->destScreen,
-				    (uint16_t*)render_info->mdScreen,
-				    render_info->destPitch, render_info->srcPitch,
-				    render_info->width, render_info->height,
-				    (mode565 ? MASK_DIV2_16 : MASK_DIV2_15));
-#endif /* GENS_X86_ASM */
-			break;
+			return true;
 		}
+		
 		case MDP_RENDER_VMODE_RGB_888:
-#ifdef GENS_X86_ASM
 			if (render_info->cpuFlags & MDP_CPUFLAG_X86_MMX)
 			{
 				mdp_render_scanline_50_32_x86_mmx(
@@ -197,20 +140,43 @@ int MDP_FNCALL mdp_render_scanline_50_cpp(const mdp_render_info_t *render_info)
 					    render_info->destPitch, render_info->srcPitch,
 					    render_info->width, render_info->height);
 			}
-#else /* !GENS_X86_ASM */
-			T_mdp_render_scanline_50_cpp(
-				    (uint32_t*)render_info->destScreen,
-				    (uint32_t*)render_info->mdScreen,
-				    render_info->destPitch, render_info->srcPitch,
-				    render_info->width, render_info->height,
-				    MASK_DIV2_32);
-#endif /* GENS_X86_ASM */
-			break;
+			return true;
 		
 		default:
-			// Unsupported video mode.
-			return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
+			return false;
 	}
+}
+#endif /* GENS_X86_ASM */
+
+
+/**
+ * mdp_render_scanline_50_band(): Render a band of the image.
+ * @param render_info Render information.
+ * @return MDP error code.
+ */
+static int MDP_FNCALL mdp_render_scanline_50_band(const mdp_render_info_t *render_info)
+{
+	if (!render_info)
+		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
 	
-	return MDP_ERR_OK;
+#ifdef GENS_X86_ASM
+	// Use the x86 asm versions if SSE2 isn't available.
+	if (!scanline_simd_available(render_info->cpuFlags) &&
+	    mdp_render_scanline_50_x86(render_info))
+	{
+		return MDP_ERR_OK;
+	}
+#endif /* GENS_X86_ASM */
+	
+	return scanline_blit<SCANLINE_50, false>(render_info);
+}
+
+
+int MDP_FNCALL mdp_render_scanline_50_cpp(const mdp_render_info_t *render_info)
+{
+	if (!render_info)
+		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
+	
+	// Only render the lines that changed.
+	return mdp_render_dirty_blit(render_info, 2, 0, mdp_render_scanline_50_band);
 }
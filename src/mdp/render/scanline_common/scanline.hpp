@@ -0,0 +1,344 @@
+/***************************************************************************
+ * MDP: Scanline and Interpolated renderers.                               *
+ *                                                                         *
+ * Copyright (c) 1999-2002 by Stéphane Dallongeville                       *
+ * Copyright (c) 2003-2004 by Stéphane Akhoun                              *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef MDP_RENDER_SCANLINE_COMMON_HPP
+#define MDP_RENDER_SCANLINE_COMMON_HPP
+
+// MDP includes.
+#include "mdp/mdp_stdint.h"
+#include "mdp/mdp_cpuflags.h"
+#include "mdp/mdp_error.h"
+#include "mdp/mdp_render.h"
+
+// SIMD intrinsics.
+#include "libgsft/gsft_simd.h"
+
+/**
+ * All of the Scanline and Interpolated renderers are 2x renderers.
+ * The first line of each pair is the source line, either doubled
+ * or interpolated with the pixel to the right. The second line is
+ * either doubled or interpolated with the line below, and then
+ * dimmed by the scanline brightness.
+ *
+ * The brightness is in eighths. Each bit adds the pixel shifted
+ * right by 1, 2, or 3, so any brightness from 0 to 8 is supported.
+ */
+
+enum SCANLINE_BRIGHTNESS
+{
+	SCANLINE_BLACK		= 0,	// 100% scanlines.
+	SCANLINE_50		= 4,	// 50% scanlines.
+	SCANLINE_25		= 6,	// 25% scanlines.
+	SCANLINE_NONE		= 8,	// No scanlines.
+};
+
+/**
+ * scanline_masks: Color masks for shifted pixels.
+ */
+template<typename pixel>
+struct scanline_masks
+{
+	pixel div2;	// Pixel bits, after shifting right by 1.
+	pixel div4;	// Pixel bits, after shifting right by 2.
+	pixel div8;	// Pixel bits, after shifting right by 3.
+};
+
+static const scanline_masks<uint16_t> scanline_masks_15 = {0x3DEF, 0x1CE7, 0x0C63};
+static const scanline_masks<uint16_t> scanline_masks_16 = {0x7BEF, 0x39E7, 0x18E3};
+static const scanline_masks<uint32_t> scanline_masks_32 = {0x7F7F7F7F, 0x3F3F3F3F, 0x1F1F1F1F};
+
+
+/**
+ * ops<pixel>: Vector operations used by the kernels.
+ * - vec: Vector type. (N pixels)
+ * - load(), set1(), zero(): Load a vector.
+ * - vand(), add(): Per-pixel arithmetic.
+ * - srl1(), srl2(), srl3(): Shift each pixel right.
+ * - store2(): Interleave two vectors and store them.
+ */
+
+/** Scalar version. Also used for the end of each line in the SIMD versions. **/
+namespace scanline_scalar
+{
+	template<typename pixel>
+	struct ops
+	{
+		typedef pixel vec;
+		enum { N = 1 };
+
+		static inline vec load(const pixel *p)		{ return *p; }
+		static inline vec set1(pixel n)			{ return n; }
+		static inline vec zero(void)			{ return 0; }
+		static inline vec vand(vec a, vec b)		{ return (a & b); }
+		static inline vec add(vec a, vec b)		{ return (pixel)(a + b); }
+		static inline vec srl1(vec a)			{ return (a >> 1); }
+		static inline vec srl2(vec a)			{ return (a >> 2); }
+		static inline vec srl3(vec a)			{ return (a >> 3); }
+
+		static inline void store2(pixel *dst, vec a, vec b)
+		{
+			dst[0] = a;
+			dst[1] = b;
+		}
+	};
+
+#include "scanline_kernel.hpp"
+}
+
+
+/** SIMD versions. **/
+
+#if defined(GSFT_SIMD_SSE2)
+GSFT_SIMD_BEGIN_SSE2
+namespace scanline_sse2
+{
+	struct vops
+	{
+		typedef __m128i vec;
+
+		static inline vec zero(void)			{ return _mm_setzero_si128(); }
+		static inline vec vand(vec a, vec b)		{ return _mm_and_si128(a, b); }
+	};
+
+	template<typename pixel> struct ops;
+
+	template<> struct ops<uint16_t> : vops
+	{
+		enum { N = 8 };
+
+		static inline vec load(const uint16_t *p)	{ return _mm_loadu_si128((const __m128i*)p); }
+		static inline vec set1(uint16_t n)		{ return _mm_set1_epi16((short)n); }
+		static inline vec add(vec a, vec b)		{ return _mm_add_epi16(a, b); }
+		static inline vec srl1(vec a)			{ return _mm_srli_epi16(a, 1); }
+		static inline vec srl2(vec a)			{ return _mm_srli_epi16(a, 2); }
+		static inline vec srl3(vec a)			{ return _mm_srli_epi16(a, 3); }
+
+		static inline void store2(uint16_t *dst, vec a, vec b)
+		{
+			_mm_storeu_si128((__m128i*)dst, _mm_unpacklo_epi16(a, b));
+			_mm_storeu_si128((__m128i*)(dst + N), _mm_unpackhi_epi16(a, b));
+		}
+	};
+
+	template<> struct ops<uint32_t> : vops
+	{
+		enum { N = 4 };
+
+		static inline vec load(const uint32_t *p)	{ return _mm_loadu_si128((const __m128i*)p); }
+		static inline vec set1(uint32_t n)		{ return _mm_set1_epi32((int)n); }
+		static inline vec add(vec a, vec b)		{ return _mm_add_epi32(a, b); }
+		static inline vec srl1(vec a)			{ return _mm_srli_epi32(a, 1); }
+		static inline vec srl2(vec a)			{ return _mm_srli_epi32(a, 2); }
+		static inline vec srl3(vec a)			{ return _mm_srli_epi32(a, 3); }
+
+		static inline void store2(uint32_t *dst, vec a, vec b)
+		{
+			_mm_storeu_si128((__m128i*)dst, _mm_unpacklo_epi32(a, b));
+			_mm_storeu_si128((__m128i*)(dst + N), _mm_unpackhi_epi32(a, b));
+		}
+	};
+
+#include "scanline_kernel.hpp"
+}
+GSFT_SIMD_END
+#endif /* GSFT_SIMD_SSE2 */
+
+#if defined(GSFT_SIMD_AVX2)
+GSFT_SIMD_BEGIN_AVX2
+namespace scanline_avx2
+{
+	struct vops
+	{
+		typedef __m256i vec;
+
+		static inline vec zero(void)			{ return _mm256_setzero_si256(); }
+		static inline vec vand(vec a, vec b)		{ return _mm256_and_si256(a, b); }
+
+		/**
+		 * AVX2 unpack instructions work within 128-bit lanes.
+		 * Swap the middle lanes to get the results in order.
+		 */
+		static inline void vstore_lanes(void *dst, vec lo, vec hi)
+		{
+			_mm256_storeu_si256((__m256i*)dst, _mm256_permute2x128_si256(lo, hi, 0x20));
+			_mm256_storeu_si256((__m256i*)dst + 1, _mm256_permute2x128_si256(lo, hi, 0x31));
+		}
+	};
+
+	template<typename pixel> struct ops;
+
+	template<> struct ops<uint16_t> : vops
+	{
+		enum { N = 16 };
+
+		static inline vec load(const uint16_t *p)	{ return _mm256_loadu_si256((const __m256i*)p); }
+		static inline vec set1(uint16_t n)		{ return _mm256_set1_epi16((short)n); }
+		static inline vec add(vec a, vec b)		{ return _mm256_add_epi16(a, b); }
+		static inline vec srl1(vec a)			{ return _mm256_srli_epi16(a, 1); }
+		static inline vec srl2(vec a)			{ return _mm256_srli_epi16(a, 2); }
+		static inline vec srl3(vec a)			{ return _mm256_srli_epi16(a, 3); }
+
+		static inline void store2(uint16_t *dst, vec a, vec b)
+			{ vstore_lanes(dst, _mm256_unpacklo_epi16(a, b), _mm256_unpackhi_epi16(a, b)); }
+	};
+
+	template<> struct ops<uint32_t> : vops
+	{
+		enum { N = 8 };
+
+		static inline vec load(const uint32_t *p)	{ return _mm256_loadu_si256((const __m256i*)p); }
+		static inline vec set1(uint32_t n)		{ return _mm256_set1_epi32((int)n); }
+		static inline vec add(vec a, vec b)		{ return _mm256_add_epi32(a, b); }
+		static inline vec srl1(vec a)			{ return _mm256_srli_epi32(a, 1); }
+		static inline vec srl2(vec a)			{ return _mm256_srli_epi32(a, 2); }
+		static inline vec srl3(vec a)			{ return _mm256_srli_epi32(a, 3); }
+
+		static inline void store2(uint32_t *dst, vec a, vec b)
+			{ vstore_lanes(dst, _mm256_unpacklo_epi32(a, b), _mm256_unpackhi_epi32(a, b)); }
+	};
+
+#include "scanline_kernel.hpp"
+}
+GSFT_SIMD_END
+#endif /* GSFT_SIMD_AVX2 */
+
+
+/**
+ * scanline_simd_available(): Check if a SIMD version can be used.
+ * @param cpuFlags CPU flags.
+ * @return Non-zero if a SIMD version can be used.
+ */
+static inline int scanline_simd_available(uint32_t cpuFlags)
+{
+#if defined(GSFT_SIMD_SSE2_ALWAYS)
+	((void)cpuFlags);
+	return 1;
+#elif defined(GSFT_SIMD_SSE2)
+	return !!(cpuFlags & (MDP_CPUFLAG_X86_SSE2 | MDP_CPUFLAG_X86_AVX2));
+#else
+	((void)cpuFlags);
+	return 0;
+#endif
+}
+
+
+/**
+ * scanline_render(): Render an image using the fastest available version.
+ * @param brightness Scanline brightness, in eighths. (SCANLINE_BRIGHTNESS)
+ * @param interp If true, interpolate the pixels.
+ * @param pixel Pixel type. (uint16_t, uint32_t)
+ * @param dst Destination image.
+ * @param dstPitch Destination pitch, in bytes.
+ * @param src Source image.
+ * @param srcPitch Source pitch, in bytes.
+ * @param width Source width.
+ * @param height Source height.
+ * @param masks Color masks.
+ * @param cpuFlags CPU flags.
+ */
+template<int brightness, bool interp, typename pixel>
+static void scanline_render(pixel *dst, int dstPitch,
+			    const pixel *src, int srcPitch,
+			    int width, int height,
+			    const scanline_masks<pixel> &masks, uint32_t cpuFlags)
+{
+	typedef void (*scanline_line_fn)(const pixel *src, int srcPitch, int x, int width,
+					 const scanline_masks<pixel> &masks,
+					 pixel *dst0, pixel *dst1);
+	scanline_line_fn scanline_line = scanline_scalar::scanline_line<brightness, interp, pixel>;
+#if defined(GSFT_SIMD_AVX2)
+	if (cpuFlags & MDP_CPUFLAG_X86_AVX2)
+		scanline_line = scanline_avx2::scanline_line<brightness, interp, pixel>;
+	else
+#endif
+#if defined(GSFT_SIMD_SSE2)
+#if !defined(GSFT_SIMD_SSE2_ALWAYS)
+	if (cpuFlags & MDP_CPUFLAG_X86_SSE2)
+#endif
+		scanline_line = scanline_sse2::scanline_line<brightness, interp, pixel>;
+#endif
+	((void)cpuFlags);
+
+	dstPitch /= sizeof(pixel);
+	srcPitch /= sizeof(pixel);
+
+	for (int y = 0; y < height; y++)
+	{
+		scanline_line(src, srcPitch, 0, width, masks, dst, dst + dstPitch);
+		src += srcPitch;
+		dst += (dstPitch * 2);
+	}
+}
+
+
+/**
+ * scanline_blit(): Render an image using the fastest available version.
+ * @param brightness Scanline brightness, in eighths. (SCANLINE_BRIGHTNESS)
+ * @param interp If true, interpolate the pixels.
+ * @param render_info Render information.
+ * @return MDP error code.
+ */
+template<int brightness, bool interp>
+static inline int scanline_blit(const mdp_render_info_t *render_info)
+{
+	if (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) !=
+	    MDP_RENDER_VMODE_GET_DST(render_info->vmodeFlags))
+	{
+		// Renderer only supports identical src/dst modes.
+		return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
+	}
+
+	switch (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags))
+	{
+		case MDP_RENDER_VMODE_RGB_555:
+			scanline_render<brightness, interp, uint16_t>(
+				    (uint16_t*)render_info->destScreen, render_info->destPitch,
+				    (const uint16_t*)render_info->mdScreen, render_info->srcPitch,
+				    render_info->width, render_info->height,
+				    scanline_masks_15, render_info->cpuFlags);
+			break;
+
+		case MDP_RENDER_VMODE_RGB_565:
+			scanline_render<brightness, interp, uint16_t>(
+				    (uint16_t*)render_info->destScreen, render_info->destPitch,
+				    (const uint16_t*)render_info->mdScreen, render_info->srcPitch,
+				    render_info->width, render_info->height,
+				    scanline_masks_16, render_info->cpuFlags);
+			break;
+
+		case MDP_RENDER_VMODE_RGB_888:
+			scanline_render<brightness, interp, uint32_t>(
+				    (uint32_t*)render_info->destScreen, render_info->destPitch,
+				    (const uint32_t*)render_info->mdScreen, render_info->srcPitch,
+				    render_info->width, render_info->height,
+				    scanline_masks_32, render_info->cpuFlags);
+			break;
+
+		default:
+			// Unsupported video mode.
+			return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
+	}
+
+	return MDP_ERR_OK;
+}
+
+#endif /* MDP_RENDER_SCANLINE_COMMON_HPP */
@@ -0,0 +1,138 @@
+/***************************************************************************
+ * MDP: Scanline and Interpolated renderers. (kernels)                     *
+ *                                                                         *
+ * Copyright (c) 1999-2002 by Stéphane Dallongeville                       *
+ * Copyright (c) 2003-2004 by Stéphane Akhoun                              *
+ * Copyright (c) 2008-2010 by David Korth                                  *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * This file is included once for each instruction set by scanline.hpp.
+ * There are no include guards.
+ *
+ * Required definitions:
+ * - ops<pixel>: Vector operations for one pixel type. (See scanline.hpp.)
+ */
+
+/**
+ * scanline_vmasks: Color masks, loaded into vectors.
+ */
+template<typename pixel>
+struct scanline_vmasks
+{
+	typedef ops<pixel> op;
+	typedef typename op::vec vec;
+
+	vec div2, div4, div8;
+
+	explicit scanline_vmasks(const scanline_masks<pixel> &m)
+		: div2(op::set1(m.div2))
+		, div4(op::set1(m.div4))
+		, div8(op::set1(m.div8))
+	{ }
+};
+
+/**
+ * scanline_blend(): Average two pixels.
+ * Same as BLEND() in the original renderers.
+ */
+template<typename pixel>
+static inline typename ops<pixel>::vec scanline_blend(
+		typename ops<pixel>::vec a, typename ops<pixel>::vec b,
+		const scanline_vmasks<pixel> &vm)
+{
+	typedef ops<pixel> op;
+	return op::add(op::vand(op::srl1(a), vm.div2),
+		       op::vand(op::srl1(b), vm.div2));
+}
+
+/**
+ * scanline_dim(): Apply the scanline brightness to a pixel.
+ * @param brightness Brightness, in eighths. (SCANLINE_BRIGHTNESS)
+ */
+template<int brightness, typename pixel>
+static inline typename ops<pixel>::vec scanline_dim(
+		typename ops<pixel>::vec a, const scanline_vmasks<pixel> &vm)
+{
+	typedef ops<pixel> op;
+	if (brightness >= SCANLINE_NONE)
+		return a;
+
+	typename op::vec r = op::zero();
+	if (brightness & 4)
+		r = op::add(r, op::vand(op::srl1(a), vm.div2));
+	if (brightness & 2)
+		r = op::add(r, op::vand(op::srl2(a), vm.div4));
+	if (brightness & 1)
+		r = op::add(r, op::vand(op::srl3(a), vm.div8));
+	return r;
+}
+
+/**
+ * scanline_line(): Render part of a line.
+ * Pixels that don't fill a whole vector are rendered by the scalar version.
+ * @param brightness Scanline brightness, in eighths. (SCANLINE_BRIGHTNESS)
+ * @param interp If true, interpolate the pixels.
+ * @param src Source row.
+ * @param srcPitch Source pitch, in pixels.
+ * @param x First source pixel.
+ * @param width Width of the source row.
+ * @param dst0 First destination row.
+ * @param dst1 Second destination row.
+ */
+template<int brightness, bool interp, typename pixel>
+static void scanline_line(const pixel *src, int srcPitch, int x, int width,
+			  const scanline_masks<pixel> &masks,
+			  pixel *dst0, pixel *dst1)
+{
+	typedef ops<pixel> op;
+	typedef typename op::vec vec;
+	const scanline_vmasks<pixel> vm(masks);
+
+	for (; x + (int)op::N <= width; x += op::N)
+	{
+		const vec C = op::load(&src[x]);
+
+		if (!interp)
+		{
+			op::store2(&dst0[x * 2], C, C);
+			const vec S = scanline_dim<brightness, pixel>(C, vm);
+			op::store2(&dst1[x * 2], S, S);
+			continue;
+		}
+
+		// The interpolated renderers read one pixel past the right
+		// edge of the image, and the line below the current line.
+		const vec CR = scanline_blend<pixel>(C, op::load(&src[x + 1]), vm);
+		op::store2(&dst0[x * 2], C, CR);
+
+		if (brightness == SCANLINE_BLACK)
+		{
+			op::store2(&dst1[x * 2], op::zero(), op::zero());
+			continue;
+		}
+
+		const vec D = op::load(&src[srcPitch + x]);
+		const vec DDR = scanline_blend<pixel>(D, op::load(&src[srcPitch + x + 1]), vm);
+		op::store2(&dst1[x * 2],
+			   scanline_dim<brightness, pixel>(scanline_blend<pixel>(C, D, vm), vm),
+			   scanline_dim<brightness, pixel>(scanline_blend<pixel>(CR, DDR, vm), vm));
+	}
+
+	if (x < width)
+		scanline_scalar::scanline_line<brightness, interp, pixel>(src, srcPitch, x, width, masks, dst0, dst1);
+}
@@ -33,6 +33,9 @@
 #include "mdp/mdp_cpuflags.h"
 #include "mdp/mdp_error.h"
 
+// C++ and SIMD versions.
+#include "../2xsai_common/sai.hpp"
+
 // x86 asm versions.
 #ifdef GENS_X86_ASM
 #include "mdp_render_super_2xsai_x86.h"
@@ -86,32 +89,25 @@ int MDP_FNCALL mdp_render_super_2xsai_cpp(const mdp_render_info_t *render_info)
 	if (!render_info)
 		return -MDP_ERR_RENDER_INVALID_RENDERINFO;
 	
-	if (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) !=
-	    MDP_RENDER_VMODE_GET_DST(render_info->vmodeFlags))
-	{
-		// Renderer only supports identical src/dst modes.
-		return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
-	}
-	
-	switch (MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags))
+#ifdef GENS_X86_ASM
+	// Use the MMX version for 16-bit color if SSE2 isn't available.
+	const uint32_t vmode = MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags);
+	if ((render_info->cpuFlags & MDP_CPUFLAG_X86_MMX) &&
+	    !sai_simd_available(render_info->cpuFlags) &&
+	    (vmode == MDP_RENDER_VMODE_RGB_555 || vmode == MDP_RENDER_VMODE_RGB_565) &&
+	    vmode == MDP_RENDER_VMODE_GET_DST(render_info->vmodeFlags))
 	{
-		case MDP_RENDER_VMODE_RGB_555:
-		case MDP_RENDER_VMODE_RGB_565:
-		{
-			const int mode565 = ((MDP_RENDER_VMODE_GET_SRC(render_info->vmodeFlags) == MDP_RENDER_VMODE_RGB_565) ? 1 : 0);
-			
-			mdp_render_super_2xsai_16_x86_mmx(
-				    (uint16_t*)render_info->destScreen,
-				    (uint16_t*)render_info->mdScreen,
-				    render_info->destPitch, render_info->srcPitch,
-				    render_info->width, render_info->height,
-				    mode565);
-			break;
-		}
-		default:
-			// Unsupported video mode.
-			return -MDP_ERR_RENDER_UNSUPPORTED_VMODE;
+		const int mode565 = (vmode == MDP_RENDER_VMODE_RGB_565 ? 1 : 0);
+		
+		mdp_render_super_2xsai_16_x86_mmx(
+			    (uint16_t*)render_info->destScreen,
+			    (uint16_t*)render_info->mdScreen,
+			    render_info->destPitch, render_info->srcPitch,
+			    render_info->width, render_info->height,
+			    mode565);
+		return MDP_ERR_OK;
 	}
+#endif /* GENS_X86_ASM */
 	
-	return MDP_ERR_OK;
+	return sai_blit<SAI_SUPER_2XSAI>(render_info);
 }